@@ -215,6 +215,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/2d/core/ImageFrameProvider.cc \
 					../../../../../../source/2d/core/ImageFrameProviderCore.cc \
 					../../../../../../source/2d/core/ParticleSystem.cc \
+					../../../../../../source/2d/core/ParticleIntegrator.cc \
 					../../../../../../source/2d/core/RenderProxy.cc \
 					../../../../../../source/2d/core/SpriteBase.cc \
 					../../../../../../source/2d/core/SpriteBatch.cc \
@@ -249,6 +250,8 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/assets/assetBase.cc \
 					../../../../../../source/assets/assetFieldTypes.cc \
 					../../../../../../source/assets/assetManager.cc \
+					../../../../../../source/assets/assetTypeCache.cc \
+					../../../../../../source/assets/assetManifestCache.cc \
 					../../../../../../source/assets/assetQuery.cc \
 					../../../../../../source/assets/assetTagsManifest.cc \
 					../../../../../../source/assets/declaredAssets.cc \
@@ -341,6 +344,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/graphics/bitmapPng.cc \
 					../../../../../../source/graphics/color.cc \
 					../../../../../../source/graphics/dgl.cc \
+					../../../../../../source/graphics/glRecorder.cc \
 					../../../../../../source/graphics/dglMatrix.cc \
 					../../../../../../source/graphics/DynamicTexture.cc \
 					../../../../../../source/graphics/gBitmap.cc \
@@ -470,6 +474,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/console/consoleDoc.cc \
 					../../../../../../source/console/consoleFunctions.cc \
 					../../../../../../source/console/consoleLogger.cc \
+					../../../../../../source/console/consoleLogWriter.cc \
 					../../../../../../source/console/consoleObject.cc \
 					../../../../../../source/console/consoleParser.cc \
 					../../../../../../source/console/consoleTypes.cc \
@@ -509,6 +514,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/platform/menus/popupMenu.cc \
 					../../../../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../../../../source/platform/Tickable.cc \
+					../../../../../../source/platform/threads/jobScheduler.cc \
 					../../../../../../source/platformAndroid/android_native_app_glue.c \
 					../../../../../../source/platformAndroid/AndroidAlerts.cpp \
 					../../../../../../source/platformAndroid/AndroidAudio.cpp \
@@ -607,6 +613,22 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/gui/editor/guiSeparatorCtrl.cc
 #					../../../../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../../../../source/testing/tests/platformMemoryTests.cc \
+#					../../../../../../source/testing/tests/particleIntegratorTests.cc \
+#					../../../../../../source/testing/tests/sceneConcurrentTickTests.cc \
+#					../../../../../../source/testing/tests/glRecorderTests.cc \
+#					../../../../../../source/testing/tests/stringTableTests.cc \
+#					../../../../../../source/testing/tests/consoleLogWriterTests.cc \
+#					../../../../../../source/testing/tests/bitmapFontTests.cc \
+#					../../../../../../source/testing/tests/tamlBinaryTests.cc \
+#					../../../../../../source/testing/tests/assetTypeCacheTests.cc \
+#					../../../../../../source/testing/tests/assetAsyncAcquireTests.cc \
+#					../../../../../../source/testing/tests/assetManifestCacheTests.cc \
+#					../../../../../../source/testing/tests/simFieldDictionaryTests.cc \
+#					../../../../../../source/testing/tests/simDictionaryTests.cc \
+#					../../../../../../source/testing/tests/sceneContactListenerTests.cc \
+#					../../../../../../source/testing/tests/consoleMethodCacheTests.cc \
+#					../../../../../../source/testing/tests/consoleTypedValueTests.cc \
+#					../../../../../../source/testing/tests/particleAssetFieldTests.cc \
 #					../../../../../../source/testing/tests/platformStringTests.cc \
 #					../../../../../../source/testing/unitTesting.cc
 
@@ -0,0 +1,5 @@
+#ifndef _ALUTTYPES_H_
+#define _ALUTTYPES_H_
+
+
+#endif /* _ALUTTYPES_H_ */
@@ -0,0 +1,5 @@
+#ifndef _ALUTYPES_H_
+#define _ALUTYPES_H_
+
+
+#endif /* _ALUTYPES_H_ */
@@ -91,6 +91,7 @@ public:
 
     // Asset validation.
     virtual bool    isAssetValid( void ) const;
+    virtual U32     getAssetMemorySize( void ) const                    { return sizeof(AnimationAsset) + mAnimationFrames.memSize() + mNamedAnimationFrames.memSize() + mValidatedFrames.memSize() + mValidatedNameFrames.memSize(); }
 
     /// Declare Console Object.
     DECLARE_CONOBJECT(AnimationAsset);
@@ -98,7 +98,8 @@ ConsoleSetType( TypeFontAssetPtr )
 //------------------------------------------------------------------------------
 
 FontAsset::FontAsset() :    mFontFile(StringTable->EmptyString),
-                                    mBitmapFont()
+                                    mBitmapFont(),
+                                    mFontDataVersion(0)
 {
 }
 
@@ -207,8 +208,35 @@ void FontAsset::onAssetRefresh( void )
 
 //-----------------------------------------------------------------------------
 
+U32 FontAsset::getAssetMemorySize( void ) const
+{
+    return sizeof(FontAsset) + mBitmapFont.getGlyphTableMemorySize();
+}
+
+//-----------------------------------------------------------------------------
+
+void FontAsset::getAssetSharedMemory( Vector<AssetSharedMemory>& sharedMemory ) const
+{
+    // The page textures may be shared through the texture manager.
+    for( std::vector<TextureHandle>::const_iterator textureItr = mBitmapFont.mTexture.begin(); textureItr != mBitmapFont.mTexture.end(); ++textureItr )
+    {
+        if ( textureItr->IsNull() )
+            continue;
+
+        AssetSharedMemory textureMemory;
+        textureMemory.mpResource = textureItr->getTextureObject();
+        textureMemory.mMemorySize = textureItr->getResidentMemorySize();
+        sharedMemory.push_back( textureMemory );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void FontAsset::buildFontData( void )
 {
+   // Invalidate any layouts using the previous font data.
+   mFontDataVersion++;
+
    FileStream fStream;
 
    if (!fStream.open(mFontFile, FileStream::Read))
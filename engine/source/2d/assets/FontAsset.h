@@ -53,6 +53,9 @@ public:
     AssetPtr<ImageAsset>            mImageAsset;
     BitmapFont                      mBitmapFont;
 
+private:
+    U32                             mFontDataVersion;
+
 public:
     FontAsset();
     virtual ~FontAsset();
@@ -68,6 +71,12 @@ public:
 
     inline TextureHandle&   getImageTexture(U16 pageID)                         { return mBitmapFont.mTexture[pageID]; }
 
+    /// Changes whenever the font data is rebuilt so layouts using it can be invalidated.
+    inline U32              getFontDataVersion( void ) const                    { return mFontDataVersion; }
+
+    virtual U32             getAssetMemorySize( void ) const;
+    virtual void            getAssetSharedMemory( Vector<AssetSharedMemory>& sharedMemory ) const;
+
     /// Declare Console Object.
     DECLARE_CONOBJECT(FontAsset);
 
@@ -1024,6 +1024,21 @@ ImageAsset::FrameArea& ImageAsset::getCellByName( const char* cellName)
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::getAssetSharedMemory( Vector<AssetSharedMemory>& sharedMemory ) const
+{
+    // Finish if no texture.
+    if ( mImageTextureHandle.IsNull() )
+        return;
+
+    // The texture may be shared through the texture manager.
+    AssetSharedMemory textureMemory;
+    textureMemory.mpResource = mImageTextureHandle.getTextureObject();
+    textureMemory.mMemorySize = mImageTextureHandle.getResidentMemorySize();
+    sharedMemory.push_back( textureMemory );
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
 {
     // Finish if no texture.
@@ -1161,6 +1176,11 @@ void ImageAsset::calculateImage( void )
         setTextureFilter( filterMode );
     }
 
+    // Pack the texture into a shared atlas page if enabled.
+    // NOTE: This must happen after the filter is set as pages are shared by filter mode.
+    if ( TextureManager::getTextureAtlasEnabled() )
+        TextureManager::addToTextureAtlas( (TextureObject*)mImageTextureHandle );
+
     // Calculate according to mode.
     if ( mExplicitMode )
     {
@@ -252,6 +252,8 @@ public:
     inline const void       bindImageTexture( void)                         { glBindTexture( GL_TEXTURE_2D, getImageTexture().getGLName() ); };
     
     virtual bool            isAssetValid( void ) const                      { return !mImageTextureHandle.IsNull(); }
+    virtual U32             getAssetMemorySize( void ) const                { return sizeof(ImageAsset) + mFrames.memSize() + mExplicitFrames.memSize(); }
+    virtual void            getAssetSharedMemory( Vector<AssetSharedMemory>& sharedMemory ) const;
 
     /// Explicit cell control.
     bool                    clearExplicitCells( void );
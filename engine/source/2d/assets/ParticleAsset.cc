@@ -44,6 +44,18 @@ static EnumTable::Enums particleAssetLifeModeLookup[] =
 
 static EnumTable LifeModeTable(sizeof(particleAssetLifeModeLookup) / sizeof(EnumTable::Enums), &particleAssetLifeModeLookup[0]);
 
+//------------------------------------------------------------------------------
+
+static EnumTable::Enums particleAssetFieldAccuracyLookup[] =
+{
+    { ParticleAsset::EXACT,     "EXACT" },
+    { ParticleAsset::BAKED,     "BAKED" },
+};
+
+//-----------------------------------------------------------------------------
+
+static EnumTable FieldAccuracyTable(sizeof(particleAssetFieldAccuracyLookup) / sizeof(EnumTable::Enums), &particleAssetFieldAccuracyLookup[0]);
+
 //-----------------------------------------------------------------------------
 
 ParticleAsset::LifeMode ParticleAsset::getParticleAssetLifeModeEnum( const char* label )
@@ -78,6 +90,40 @@ const char* ParticleAsset::getParticleAssetLifeModeDescription( const ParticleAs
 
 //-----------------------------------------------------------------------------
 
+ParticleAsset::FieldAccuracy ParticleAsset::getParticleAssetFieldAccuracyEnum( const char* label )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(particleAssetFieldAccuracyLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( dStricmp(particleAssetFieldAccuracyLookup[i].label, label) == 0)
+            return (ParticleAsset::FieldAccuracy)particleAssetFieldAccuracyLookup[i].index;
+    }
+
+    // Warn.
+    Con::warnf( "ParticleAsset::getParticleAssetFieldAccuracyEnum() - Invalid field accuracy '%s'.", label );
+
+    return ParticleAsset::INVALID_FIELDACCURACY;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* ParticleAsset::getParticleAssetFieldAccuracyDescription( const ParticleAsset::FieldAccuracy fieldAccuracy )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(particleAssetFieldAccuracyLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( particleAssetFieldAccuracyLookup[i].index == (S32)fieldAccuracy )
+            return particleAssetFieldAccuracyLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "ParticleAsset::getParticleAssetFieldAccuracyDescription() - Invalid field accuracy." );
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleType( particleAssetPtr, TypeParticleAssetPtr, sizeof(AssetPtr<ParticleAsset>), ASSET_ID_FIELD_PREFIX )
 
 //-----------------------------------------------------------------------------
@@ -123,7 +169,8 @@ ConsoleSetType( TypeParticleAssetPtr )
 
 ParticleAsset::ParticleAsset() :
                     mLifetime( 0.0f ),
-                    mLifeMode( INFINITE )
+                    mLifeMode( INFINITE ),
+                    mFieldAccuracy( EXACT )
 
 {
     // Set Vector Associations.
@@ -158,6 +205,7 @@ void ParticleAsset::initPersistFields()
 
     addProtectedField("Lifetime", TypeF32, Offset(mLifetime, ParticleAsset), &setLifetime, &defaultProtectedGetFn, &writeLifetime, "");
     addProtectedField("LifeMode", TypeEnum, Offset(mLifeMode, ParticleAsset), &setLifeMode, &defaultProtectedGetFn, &writeLifeMode, 1, &LifeModeTable);
+    addProtectedField("FieldAccuracy", TypeEnum, Offset(mFieldAccuracy, ParticleAsset), &setFieldAccuracy, &defaultProtectedGetFn, &writeFieldAccuracy, 1, &FieldAccuracyTable);
 }
 
 //------------------------------------------------------------------------------
@@ -176,6 +224,7 @@ void ParticleAsset::copyTo(SimObject* object)
    // Copy fields.
    pParticleAsset->setLifetime( getLifetime() );
    pParticleAsset->setLifeMode( getLifeMode() );
+   pParticleAsset->setFieldAccuracy( getFieldAccuracy() );
 
    // Copy particle fields.
    mParticleFields.copyTo( pParticleAsset->mParticleFields );
@@ -230,6 +279,21 @@ bool ParticleAsset::isAssetValid( void ) const
 
 //------------------------------------------------------------------------------
 
+U32 ParticleAsset::getAssetMemorySize( void ) const
+{
+    U32 memorySize = sizeof(ParticleAsset) + mParticleFields.getMemorySize() + mEmitters.memSize();
+
+    // Sum the emitters.
+    for( typeEmitterVector::const_iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        memorySize += (*emitterItr)->getMemorySize();
+    }
+
+    return memorySize;
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleAsset::setLifetime( const F32 lifetime )
 {
     // Ignore no change.
@@ -274,6 +338,38 @@ void ParticleAsset::setLifeMode( const LifeMode lifemode )
 
 //------------------------------------------------------------------------------
 
+void ParticleAsset::setFieldAccuracy( const FieldAccuracy fieldAccuracy )
+{
+    // Ignore no change.
+    if ( fieldAccuracy == mFieldAccuracy )
+        return;
+
+    // Is field accuracy valid?
+    if ( fieldAccuracy == INVALID_FIELDACCURACY )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAsset::setFieldAccuracy() - Field accuracy is invalid." );
+        return;
+    }
+
+    mFieldAccuracy = fieldAccuracy;
+
+    // Set the evaluation mode of the asset fields.
+    const bool bakedEvaluation = mFieldAccuracy == BAKED;
+    mParticleFields.setBakedEvaluation( bakedEvaluation );
+
+    // Set the evaluation mode of the emitter fields.
+    for ( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        (*emitterItr)->getParticleFields().setBakedEvaluation( bakedEvaluation );
+    }
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleAsset::initializeAsset( void )
 {
     // Call parent.
@@ -327,6 +423,9 @@ bool ParticleAsset::addEmitter( ParticleAssetEmitter* pParticleAssetEmitter )
     // Set the owner.
     pParticleAssetEmitter->setOwner( this );
 
+    // Use the same field evaluation as the asset.
+    pParticleAssetEmitter->getParticleFields().setBakedEvaluation( mFieldAccuracy == BAKED );
+
     // Add the emitter.
     mEmitters.push_back( pParticleAssetEmitter );
 
@@ -60,11 +60,21 @@ public:
         KILL
     };
 
+    /// Field Accuracy.
+    enum FieldAccuracy
+    {
+        INVALID_FIELDACCURACY,
+
+        EXACT,
+        BAKED
+    };
+
 private:
     typeEmitterVector                       mEmitters;
 
     F32                                     mLifetime;
     LifeMode                                mLifeMode;
+    FieldAccuracy                           mFieldAccuracy;
 
     /// Particle fields.
     ParticleAssetFieldCollection            mParticleFields;
@@ -88,11 +98,14 @@ public:
 
     // Asset validation.
     virtual bool isAssetValid( void ) const;
+    virtual U32 getAssetMemorySize( void ) const;
 
     void setLifetime( const F32 lifetime );
     F32 getLifetime( void ) const { return mLifetime; }
     void setLifeMode( const LifeMode lifemode );
     LifeMode getLifeMode( void ) const { return mLifeMode; }
+    void setFieldAccuracy( const FieldAccuracy fieldAccuracy );
+    FieldAccuracy getFieldAccuracy( void ) const { return mFieldAccuracy; }
 
     inline ParticleAssetFieldCollection& getParticleFields( void ) { return mParticleFields; }
 
@@ -154,6 +167,8 @@ public:
 
     static LifeMode getParticleAssetLifeModeEnum(const char* label);
     static const char* getParticleAssetLifeModeDescription( const LifeMode lifeMode );
+    static FieldAccuracy getParticleAssetFieldAccuracyEnum(const char* label);
+    static const char* getParticleAssetFieldAccuracyDescription( const FieldAccuracy fieldAccuracy );
 
     /// Declare Console Object.
     DECLARE_CONOBJECT(ParticleAsset);
@@ -170,6 +185,9 @@ protected:
 
     static bool setLifeMode(void* obj, const char* data)                    { static_cast<ParticleAsset*>(obj)->setLifeMode( ParticleAsset::getParticleAssetLifeModeEnum(data) ); return false; }
     static bool writeLifeMode( void* obj, StringTableEntry pFieldName )     { return static_cast<ParticleAsset*>(obj)->getLifeMode() != INFINITE; }
+
+    static bool setFieldAccuracy(void* obj, const char* data)               { static_cast<ParticleAsset*>(obj)->setFieldAccuracy( ParticleAsset::getParticleAssetFieldAccuracyEnum(data) ); return false; }
+    static bool writeFieldAccuracy( void* obj, StringTableEntry pFieldName ){ return static_cast<ParticleAsset*>(obj)->getFieldAccuracy() != EXACT; }
 };
 
 #endif // _PARTICLE_ASSET_H_
@@ -167,6 +167,7 @@ public:
     virtual void copyTo(SimObject* object);
 
     inline ParticleAsset* getOwner( void ) const { return mOwner; }
+    inline U32 getMemorySize( void ) const { return sizeof(ParticleAssetEmitter) + mParticleFields.getMemorySize(); }
     void setEmitterName( const char* pEmitterName );
     inline StringTableEntry getEmitterName( void ) const { return mEmitterName; }
     inline void setEmitterType( const EmitterType emitterType ) { mEmitterType = emitterType; refreshAsset(); }
@@ -64,10 +64,13 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mBakedEvaluation( false ),
+                        mBakedTimeScale( 0.0f )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mBakedValues );
 }
 
 //-----------------------------------------------------------------------------
@@ -170,6 +173,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Rebake as the time range may have changed.
+    bakeFieldValues();
 }
 
 //-----------------------------------------------------------------------------
@@ -202,6 +208,9 @@ bool ParticleAssetField::setRepeatTime( const F32 repeatTime )
     // Set repeat time.
     mRepeatTime = repeatTime;
 
+    // Rebake.
+    bakeFieldValues();
+
     // Return Okay.
     return true;
 }
@@ -293,6 +302,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Rebake.
+            bakeFieldValues();
+
             // Return Index.
             return index;
         }
@@ -309,6 +321,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Rebake.
+    bakeFieldValues();
+
     // Return Index.
     return index;
 }
@@ -336,6 +351,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Rebake.
+    bakeFieldValues();
+
     // Return Okay.
     return true;
 }
@@ -363,6 +381,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Rebake.
+    bakeFieldValues();
+
     // Return Okay.
     return true;
 }
@@ -417,11 +438,18 @@ const ParticleAssetField::DataKey& ParticleAssetField::getDataKey( const U32 ind
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::getFieldValue( F32 time ) const
+F32 ParticleAssetField::getExactFieldValue( F32 time ) const
+{
+    return getUnscaledFieldValue( time ) * mValueScale;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::getUnscaledFieldValue( F32 time ) const
 {
     // Return First Entry if it's the only one or we're using zero time.
     if ( mIsZero(time) || getDataKeyCount() < 2)
-        return mDataKeys[0].mValue * mValueScale;
+        return mDataKeys[0].mValue;
 
     // Clamp Key-Time.
     time = getMin(getMax( 0.0f, time ), mMaxTime);
@@ -434,7 +462,7 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
     // Return Last Value if we're on/past the last time.
     if ( time >= mDataKeys[maxKeyIndex].mTime )
-        return mDataKeys[maxKeyIndex].mValue * mValueScale;
+        return mDataKeys[maxKeyIndex].mValue;
 
     // Find Data-Key Indexes.
     U32 index1;
@@ -445,7 +473,7 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
     // If we're exactly on a Data-Key then return that key.
     if ( mIsEqual( mDataKeys[index1].mTime, time) )
-        return mDataKeys[index1].mValue * mValueScale;
+        return mDataKeys[index1].mValue;
 
     // Set Adjacent Indexes.
     index2 = index1--;
@@ -457,7 +485,49 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     const F32 dTime = (time-time1)/(time2-time1);
 
     // Return lerped Value.
-    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime)) * mValueScale;
+    return (mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime);
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::setBakedEvaluation( const bool bakedEvaluation )
+{
+    // Ignore no change.
+    if ( bakedEvaluation == mBakedEvaluation )
+        return;
+
+    mBakedEvaluation = bakedEvaluation;
+
+    // Bake (or discard) the values.
+    bakeFieldValues();
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::bakeFieldValues( void )
+{
+    // Calculate the time to sample scale.
+    // NOTE:-   A zero or vanishingly small time range cannot be sampled as the scale would not be finite.
+    const F32 timeScale = (F32)(BAKED_SAMPLE_COUNT-1) / mMaxTime;
+
+    // Discard the baked values if not baking, the field is constant or the time range cannot be sampled.
+    // NOTE:-   A constant field is already as fast as a baked one.
+    if ( !mBakedEvaluation || getDataKeyCount() < 2 || !(timeScale <= F32_MAX) )
+    {
+        mBakedValues.clear();
+        mBakedValues.compact();
+        return;
+    }
+
+    // Sample the field uniformly across its time range.
+    mBakedValues.setSize( BAKED_SAMPLE_COUNT );
+    const F32 sampleTime = mMaxTime / (F32)(BAKED_SAMPLE_COUNT-1);
+    for ( U32 sampleIndex = 0; sampleIndex < (U32)BAKED_SAMPLE_COUNT; ++sampleIndex )
+    {
+        mBakedValues[sampleIndex] = getUnscaledFieldValue( sampleTime * (F32)sampleIndex );
+    }
+
+    mBakedTimeScale = timeScale;
 }
 
 //-----------------------------------------------------------------------------
@@ -714,6 +784,9 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
 
     // Set the data keys.
     mDataKeys = keys;
+
+    // Bake the keys now the repeat time and value bounds are set.
+    bakeFieldValues();
 }
 
 //-----------------------------------------------------------------------------
@@ -58,6 +58,12 @@ public:
 
     static ParticleAssetField::DataKey BadDataKey;
 
+    enum
+    {
+        /// Number of uniformly spaced samples in a baked field.
+        BAKED_SAMPLE_COUNT = 256
+    };
+
 private:
     StringTableEntry mFieldName;
     F32 mRepeatTime;
@@ -71,6 +77,13 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    bool mBakedEvaluation;
+    F32 mBakedTimeScale;
+    Vector<F32> mBakedValues;
+
+    F32 getUnscaledFieldValue( F32 time ) const;
+    void bakeFieldValues( void );
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -104,7 +117,31 @@ public:
     F32 getDataKeyTime( const U32 index ) const;
     inline U32 getDataKeyCount( void ) const { return (U32)mDataKeys.size(); }
     const DataKey& getDataKey( const U32 index ) const;
-    F32 getFieldValue( F32 time ) const;
+    F32 getExactFieldValue( F32 time ) const;
+
+    /// Baked evaluation.
+    void setBakedEvaluation( const bool bakedEvaluation );
+    inline bool getBakedEvaluation( void ) const { return mBakedEvaluation; }
+    inline bool isBaked( void ) const { return mBakedValues.size() > 0; }
+
+    /// Heap memory held by the data keys and baked values.
+    inline U32 getMemorySize( void ) const { return mDataKeys.memSize() + mBakedValues.memSize(); }
+    inline F32 getBakedFieldValue( const F32 time ) const
+    {
+        // Sanity!
+        AssertFatal( mBakedValues.size() == BAKED_SAMPLE_COUNT, "ParticleAssetField::getBakedFieldValue() - Field is not baked." );
+
+        // Find the sample pair and lerp between them.
+        const F32 sample = getMin( getMax( 0.0f, time ), mMaxTime ) * mBakedTimeScale;
+        const U32 sampleIndex = getMin( (U32)sample, (U32)BAKED_SAMPLE_COUNT-2 );
+        const F32 sampleFraction = sample - (F32)sampleIndex;
+        const F32 value1 = mBakedValues[sampleIndex];
+        const F32 value2 = mBakedValues[sampleIndex+1];
+        return (value1 + (value2 - value1) * sampleFraction) * mValueScale;
+    }
+
+    /// Uses the baked values when baked evaluation is on and the field has more than one key.
+    inline F32 getFieldValue( const F32 time ) const { return isBaked() ? getBakedFieldValue( time ) : getExactFieldValue( time ); }
 
     static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
     static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
@@ -87,6 +87,32 @@ void ParticleAssetFieldCollection::addField( ParticleAssetField& particleAssetFi
 
 //-----------------------------------------------------------------------------
 
+void ParticleAssetFieldCollection::setBakedEvaluation( const bool bakedEvaluation )
+{
+    // Iterate the fields.
+    for( typeFieldHash::iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+    {
+        fieldItr->value->setBakedEvaluation( bakedEvaluation );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ParticleAssetFieldCollection::getMemorySize( void ) const
+{
+    U32 memorySize = mFields.size() * sizeof(ParticleAssetField*);
+
+    // Sum the field keys and baked values.
+    for( typeFieldHash::const_iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+    {
+        memorySize += fieldItr->value->getMemorySize();
+    }
+
+    return memorySize;
+}
+
+//-----------------------------------------------------------------------------
+
 ParticleAssetField* ParticleAssetFieldCollection::selectField( const char* pFieldName )
 {
     // Sanity!
@@ -61,6 +61,11 @@ public:
     inline const typeFieldHash& getFields( void ) const { return mFields; }
     ParticleAssetField* findField( const char* pFieldName );
 
+    void setBakedEvaluation( const bool bakedEvaluation );
+
+    /// Heap memory held by the fields.
+    U32 getMemorySize( void ) const;
+
     S32 setSingleDataKey( const F32 value );
     S32 addDataKey( F32 time, F32 value );
     bool removeDataKey( S32 index );
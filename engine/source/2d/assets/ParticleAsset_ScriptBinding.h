@@ -51,6 +51,29 @@ ConsoleMethodWithDocs( ParticleAsset, getLifeMode, ConsoleString, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the accuracy used to evaluate the particle fields.
+    @param fieldAccuracy The field accuracy, either EXACT or BAKED.
+    A field accuracy of EXACT evaluates the field keys every time a field is used.
+    A field accuracy of BAKED samples each field into a fixed-resolution table whenever its keys change and interpolates the table instead.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setFieldAccuracy, ConsoleVoid, 3, 3, (fieldAccuracy))
+{
+    object->setFieldAccuracy( ParticleAsset::getParticleAssetFieldAccuracyEnum( argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the accuracy used to evaluate the particle fields.
+    @return The field accuracy, either EXACT or BAKED.
+*/
+ConsoleMethodWithDocs( ParticleAsset, getFieldAccuracy, ConsoleString, 2, 2, ())
+{
+    return ParticleAsset::getParticleAssetFieldAccuracyDescription( object->getFieldAccuracy() );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the lifetime of the particle effect.
     @param lifeTime The lifetime of the particle effect.  This is used according to the 'lifeMode' setting.
     @return No return value.
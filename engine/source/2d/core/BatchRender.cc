@@ -34,7 +34,6 @@
 BatchRender::BatchRender() :
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
-    mTextureCoordCount( 0 ),
     mIndexCount( 0 ),
     mColorCount( 0 ),
     NoColor( -1.0f, -1.0f, -1.0f ),
@@ -46,14 +45,51 @@ BatchRender::BatchRender() :
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mAtlasEnabled( true ),
+    mpCommandBuffer( NULL )
 {
+    // Allocate the batch buffers.
+    mVertexBuffer = new BatchVertex[ BATCHRENDER_BUFFERSIZE ];
+    mIndexBuffer = new U16[ BATCHRENDER_BUFFERSIZE ];
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::BatchRender( BatchRenderCommandBuffer* pCommandBuffer ) :
+    mTriangleCount( 0 ),
+    mVertexCount( 0 ),
+    mIndexCount( 0 ),
+    mColorCount( 0 ),
+    NoColor( -1.0f, -1.0f, -1.0f ),
+    mVertexBuffer( NULL ),
+    mIndexBuffer( NULL ),
+    mStrictOrderMode( false ),
+    mpDebugStats( NULL ),
+    mBlendMode( true ),
+    mSrcBlendFactor( GL_SRC_ALPHA ),
+    mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
+    mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
+    mAlphaTestMode( -1.0f ),
+    mWireframeMode( false ),
+    mBatchEnabled( true ),
+    mAtlasEnabled( true ),
+    mpCommandBuffer( pCommandBuffer )
+{
+    // Sanity!
+    AssertFatal( pCommandBuffer != NULL, "BatchRender::BatchRender() - Cannot record into a NULL command buffer." );
+
+    // NOTE:    A recording batch renderer never batches itself so it has no batch buffers.
 }
 
 //-----------------------------------------------------------------------------
 
 BatchRender::~BatchRender()
 {
+    // Destroy the batch buffers.
+    delete [] mVertexBuffer;
+    delete [] mIndexBuffer;
+
     // Destroy index vectors in texture batch map.
     for ( textureBatchType::iterator itr = mTextureBatchMap.begin(); itr != mTextureBatchMap.end(); ++itr )
     {
@@ -114,9 +150,33 @@ void BatchRender::SubmitTriangles(
     AssertFatal( vertexCount % 3 == 0, "BatchRender::SubmitTriangles() - Invalid vertex count, cannot represent whole triangles." );
     AssertFatal( vertexCount <= BATCHRENDER_BUFFERSIZE, "BatchRender::SubmitTriangles() - Invalid vertex count." );
 
+    // Record if recording.
+    if ( mpCommandBuffer != NULL )
+    {
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mVertices, vertexCount );
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mTextures, vertexCount );
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mColors, vertexCount );
+
+        BatchRenderCommandBuffer::Command& command = mpCommandBuffer->addCommand( BatchRenderCommandBuffer::SUBMIT_TRIANGLES );
+        command.mVertexStart = mpCommandBuffer->mVertices.size();
+        command.mVertexCount = vertexCount;
+        command.mColorStart = mpCommandBuffer->mColors.size();
+        command.mpTexture = texture;
+
+        mpCommandBuffer->mVertices.increment( pVertexArray, vertexCount );
+        mpCommandBuffer->mTextures.increment( pTextureArray, vertexCount );
+        mpCommandBuffer->mColors.increment( pColorArray, vertexCount );
+        return;
+    }
+
     // Calculate triangle count.
     const U32 triangleCount = vertexCount / 3;
 
+    // Batch using the atlas page if the texture is packed into one.
+    TextureObject* pAtlasPage = mAtlasEnabled ? findAtlasPage( texture, pTextureArray, vertexCount ) : NULL;
+    TextureHandle atlasTexture( pAtlasPage );
+    TextureHandle& batchTexture = pAtlasPage != NULL ? atlasTexture : texture;
+
     if ( (mTriangleCount + triangleCount) > BATCHRENDER_MAXTRIANGLES )
     {
         // No room in the batch for the incoming request, so flush the current batch contents.
@@ -134,7 +194,7 @@ void BatchRender::SubmitTriangles(
     if ( mStrictOrderMode )
     {
         // Yes, so is there a texture change?
-        if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+        if ( batchTexture != mStrictOrderTextureHandle && mTriangleCount > 0 )
         {
             // Yes, so flush.
             flush( mpDebugStats->batchTextureChangeFlush );
@@ -152,27 +212,33 @@ void BatchRender::SubmitTriangles(
         }
 
         // Set strict order mode texture handle.
-        mStrictOrderTextureHandle = texture;
+        mStrictOrderTextureHandle = batchTexture;
     }
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::TRIANGLE, triangleCount, mVertexCount ) );
+        findTextureBatch( batchTexture )->push_back( TriangleRun( TriangleRun::TRIANGLE, triangleCount, mVertexCount ) );
     }
 
     // Load vertex info into batch buffers
-    for( U32 n = 0; n < triangleCount; ++n )
-    {
-		mColorBuffer[mColorCount++] = *(pColorArray++);
-		mColorBuffer[mColorCount++] = *(pColorArray++);
-		mColorBuffer[mColorCount++] = *(pColorArray++);
-		mVertexBuffer[mVertexCount++] = *(pVertexArray++);
-		mVertexBuffer[mVertexCount++] = *(pVertexArray++);
-		mVertexBuffer[mVertexCount++] = *(pVertexArray++);
-		mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+    BatchVertex* pBatchVertex = mVertexBuffer + mVertexCount;
+    for( U32 n = 0; n < vertexCount; ++n, ++pBatchVertex )
+    {
+        pBatchVertex->mPosition = *(pVertexArray++);
+        pBatchVertex->mTexture = *(pTextureArray++);
+        pBatchVertex->mColor = packColor( *(pColorArray++) );
 	}
+    mVertexCount += vertexCount;
+    mColorCount += vertexCount;
+
+    // Remap the texture coordinates into the atlas page.
+    if ( pAtlasPage != NULL )
+    {
+        remapAtlasCoords( texture, pAtlasPage, mVertexBuffer + mVertexCount - vertexCount, vertexCount );
+
+        // Stats.
+        mpDebugStats->batchAtlasRemaps++;
+    }
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted += triangleCount;
@@ -216,6 +282,41 @@ void BatchRender::SubmitQuad(
     // Debug Profiling.
     PROFILE_SCOPE(BatchRender_SubmitQuad);
 
+    // Record if recording.
+    if ( mpCommandBuffer != NULL )
+    {
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mVertices, 4 );
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mTextures, 4 );
+
+        BatchRenderCommandBuffer::Command& command = mpCommandBuffer->addCommand( BatchRenderCommandBuffer::SUBMIT_QUAD );
+        command.mVertexStart = mpCommandBuffer->mVertices.size();
+        command.mVertexCount = 4;
+        command.mpTexture = texture;
+        command.mColor = color;
+
+        Vector<Vector2>& vertices = mpCommandBuffer->mVertices;
+        vertices.push_back( vertexPos0 );
+        vertices.push_back( vertexPos1 );
+        vertices.push_back( vertexPos2 );
+        vertices.push_back( vertexPos3 );
+        Vector<Vector2>& textures = mpCommandBuffer->mTextures;
+        textures.push_back( texturePos0 );
+        textures.push_back( texturePos1 );
+        textures.push_back( texturePos2 );
+        textures.push_back( texturePos3 );
+        return;
+    }
+
+    // Batch using the atlas page if the texture is packed into one.
+    TextureObject* pAtlasPage = NULL;
+    if ( mAtlasEnabled )
+    {
+        const Vector2 texturePos[4] = { texturePos0, texturePos1, texturePos2, texturePos3 };
+        pAtlasPage = findAtlasPage( texture, texturePos, 4 );
+    }
+    TextureHandle atlasTexture( pAtlasPage );
+    TextureHandle& batchTexture = pAtlasPage != NULL ? atlasTexture : texture;
+
     // Would we exceed the triangle buffer size?
     if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
     {
@@ -244,7 +345,7 @@ void BatchRender::SubmitQuad(
     if ( mStrictOrderMode )
     {
         // Yes, so is there a texture change?
-        if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+        if ( batchTexture != mStrictOrderTextureHandle && mTriangleCount > 0 )
         {
             // Yes, so flush.
             flush( mpDebugStats->batchTextureChangeFlush );
@@ -259,34 +360,48 @@ void BatchRender::SubmitQuad(
         mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
 
         // Set strict order mode texture handle.
-        mStrictOrderTextureHandle = texture;
+        mStrictOrderTextureHandle = batchTexture;
     }
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, 1, mVertexCount ) );
+        findTextureBatch( batchTexture )->push_back( TriangleRun( TriangleRun::QUAD, 1, mVertexCount ) );
     }
 
+    // Add textured vertices.
+    // NOTE: We swap #2/#3 here.
+    BatchVertex* pBatchVertex = mVertexBuffer + mVertexCount;
+    pBatchVertex[0].mPosition = vertexPos0;
+    pBatchVertex[1].mPosition = vertexPos1;
+    pBatchVertex[2].mPosition = vertexPos3;
+    pBatchVertex[3].mPosition = vertexPos2;
+    pBatchVertex[0].mTexture = texturePos0;
+    pBatchVertex[1].mTexture = texturePos1;
+    pBatchVertex[2].mTexture = texturePos3;
+    pBatchVertex[3].mTexture = texturePos2;
+
     // Is a color specified?
     if ( color != NoColor )
     {
         // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
+        const ColorI packedColor = packColor( color );
+        pBatchVertex[0].mColor = packedColor;
+        pBatchVertex[1].mColor = packedColor;
+        pBatchVertex[2].mColor = packedColor;
+        pBatchVertex[3].mColor = packedColor;
+        mColorCount += 4;
     }
 
-    // Add textured vertices.
-    // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureCoordCount++] = texturePos0;
-    mTextureBuffer[mTextureCoordCount++] = texturePos1;
-    mTextureBuffer[mTextureCoordCount++] = texturePos3;
-    mTextureBuffer[mTextureCoordCount++] = texturePos2;
+    mVertexCount += 4;
+
+    // Remap the texture coordinates into the atlas page.
+    if ( pAtlasPage != NULL )
+    {
+        remapAtlasCoords( texture, pAtlasPage, pBatchVertex, 4 );
+
+        // Stats.
+        mpDebugStats->batchAtlasRemaps++;
+    }
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
@@ -312,8 +427,169 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::SubmitQuads(
+        const U32 quadCount,
+        const Vector2* pVertexArray,
+        const Vector2* pTextureArray,
+        TextureHandle& texture,
+        const ColorF& color )
+{
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitQuads);
+
+    // Finish if no quads.
+    if ( quadCount == 0 )
+        return;
+
+    // Record if recording.
+    if ( mpCommandBuffer != NULL )
+    {
+        const U32 vertexCount = quadCount * 4;
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mVertices, vertexCount );
+        BatchRenderCommandBuffer::growStorage( mpCommandBuffer->mTextures, vertexCount );
+
+        BatchRenderCommandBuffer::Command& command = mpCommandBuffer->addCommand( BatchRenderCommandBuffer::SUBMIT_QUAD );
+        command.mVertexStart = mpCommandBuffer->mVertices.size();
+        command.mVertexCount = vertexCount;
+        command.mpTexture = texture;
+        command.mColor = color;
+
+        mpCommandBuffer->mVertices.increment( pVertexArray, vertexCount );
+        mpCommandBuffer->mTextures.increment( pTextureArray, vertexCount );
+        return;
+    }
+
+    U32 quadIndex = 0;
+    while ( quadIndex < quadCount )
+    {
+        // Would we exceed the triangle buffer size?
+        if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
+        {
+            // Yes, so flush.
+            flush( mpDebugStats->batchBufferFullFlush );
+        }
+        // Do we have anything batched with a different color state?
+        else if ( mTriangleCount > 0 && (mColorCount == 0) != (color == NoColor) )
+        {
+            // Yes, so flush.
+            flush( mpDebugStats->batchColorStateFlush );
+        }
+
+        // Fetch the run of quads that fits into the batch.
+        const U32 runQuadCount = getMin( quadCount - quadIndex, (BATCHRENDER_MAXTRIANGLES - mTriangleCount) / 2 );
+        const U32 runVertexCount = runQuadCount * 4;
+        const Vector2* pRunVertexArray = pVertexArray + quadIndex * 4;
+        const Vector2* pRunTextureArray = pTextureArray + quadIndex * 4;
+
+        // Batch using the atlas page if the texture is packed into one.
+        TextureObject* pAtlasPage = mAtlasEnabled ? findAtlasPage( texture, pRunTextureArray, runVertexCount ) : NULL;
+        TextureHandle atlasTexture( pAtlasPage );
+        TextureHandle& batchTexture = pAtlasPage != NULL ? atlasTexture : texture;
+
+        // Strict order mode?
+        if ( mStrictOrderMode )
+        {
+            // Yes, so is there a texture change?
+            if ( batchTexture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+            {
+                // Yes, so flush.
+                flush( mpDebugStats->batchTextureChangeFlush );
+            }
+
+            // Add new indices.
+            for( U32 n = 0; n < runQuadCount; ++n )
+            {
+                const U16 vertexIndex = (U16)(mVertexCount + n * 4);
+                mIndexBuffer[mIndexCount++] = vertexIndex;
+                mIndexBuffer[mIndexCount++] = vertexIndex + 1;
+                mIndexBuffer[mIndexCount++] = vertexIndex + 2;
+                mIndexBuffer[mIndexCount++] = vertexIndex + 3;
+                mIndexBuffer[mIndexCount++] = vertexIndex + 2;
+                mIndexBuffer[mIndexCount++] = vertexIndex + 1;
+            }
+
+            // Set strict order mode texture handle.
+            mStrictOrderTextureHandle = batchTexture;
+        }
+        else
+        {
+            // No, so add triangle run.
+            findTextureBatch( batchTexture )->push_back( TriangleRun( TriangleRun::QUAD, runQuadCount, mVertexCount ) );
+        }
+
+        // Add textured vertices.
+        // NOTE: We swap #2/#3 here.
+        BatchVertex* pBatchVertex = mVertexBuffer + mVertexCount;
+        for( U32 n = 0; n < runQuadCount; ++n, pBatchVertex += 4, pRunVertexArray += 4, pRunTextureArray += 4 )
+        {
+            pBatchVertex[0].mPosition = pRunVertexArray[0];
+            pBatchVertex[1].mPosition = pRunVertexArray[1];
+            pBatchVertex[2].mPosition = pRunVertexArray[3];
+            pBatchVertex[3].mPosition = pRunVertexArray[2];
+            pBatchVertex[0].mTexture = pRunTextureArray[0];
+            pBatchVertex[1].mTexture = pRunTextureArray[1];
+            pBatchVertex[2].mTexture = pRunTextureArray[3];
+            pBatchVertex[3].mTexture = pRunTextureArray[2];
+        }
+
+        // Is a color specified?
+        if ( color != NoColor )
+        {
+            // Yes, so add colors.
+            const ColorI packedColor = packColor( color );
+            pBatchVertex = mVertexBuffer + mVertexCount;
+            for( U32 n = 0; n < runVertexCount; ++n )
+                pBatchVertex[n].mColor = packedColor;
+            mColorCount += runVertexCount;
+        }
+
+        mVertexCount += runVertexCount;
+
+        // Remap the texture coordinates into the atlas page.
+        if ( pAtlasPage != NULL )
+        {
+            remapAtlasCoords( texture, pAtlasPage, mVertexBuffer + mVertexCount - runVertexCount, runVertexCount );
+
+            // Stats.
+            mpDebugStats->batchAtlasRemaps++;
+        }
+
+        // Stats.
+        mpDebugStats->batchTrianglesSubmitted += runQuadCount * 2;
+
+        // Increase triangle count.
+        mTriangleCount += runQuadCount * 2;
+        quadIndex += runQuadCount;
+
+        // Have we reached the buffer limit?
+        if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
+        {
+            // Yes, so flush.
+            flush( mpDebugStats->batchBufferFullFlush );
+        }
+        // Is batching enabled?
+        else if ( !mBatchEnabled )
+        {
+            // No, so flush immediately.
+            flushInternal();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flush( U32& reasonMetric )
 {
+    // Record if recording.
+    if ( mpCommandBuffer != NULL )
+    {
+        mpCommandBuffer->addCommand( BatchRenderCommandBuffer::FLUSH ).mpReasonMetric = &reasonMetric;
+        return;
+    }
+
     // Finish if no triangles to flush.
     if ( mTriangleCount == 0 )
         return;
@@ -329,6 +605,13 @@ void BatchRender::flush( U32& reasonMetric )
 
 void BatchRender::flush( void )
 {
+    // Record if recording.
+    if ( mpCommandBuffer != NULL )
+    {
+        mpCommandBuffer->addCommand( BatchRenderCommandBuffer::FLUSH_ANONYMOUS );
+        return;
+    }
+
     // Finish if no triangles to flush.
     if ( mTriangleCount == 0 )
         return;
@@ -342,6 +625,74 @@ void BatchRender::flush( void )
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::replay( const BatchRenderCommandBuffer& commandBuffer, const U32 commandStart, const U32 commandCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_Replay);
+
+    // Sanity!
+    AssertFatal( mpCommandBuffer == NULL, "BatchRender::replay() - Cannot replay into a recording batch renderer." );
+    AssertFatal( commandStart + commandCount <= commandBuffer.getCommandCount(), "BatchRender::replay() - Invalid command range." );
+
+    // Replay the commands.
+    const BatchRenderCommandBuffer::Command* pCommand = commandBuffer.mCommands.address() + commandStart;
+    for ( U32 n = 0; n < commandCount; ++n, ++pCommand )
+    {
+        switch( pCommand->mType )
+        {
+            case BatchRenderCommandBuffer::SUBMIT_TRIANGLES:
+                {
+                    TextureHandle texture( pCommand->mpTexture );
+                    SubmitTriangles(
+                        pCommand->mVertexCount,
+                        commandBuffer.mVertices.address() + pCommand->mVertexStart,
+                        commandBuffer.mTextures.address() + pCommand->mVertexStart,
+                        commandBuffer.mColors.address() + pCommand->mColorStart,
+                        texture );
+                }
+                break;
+
+            case BatchRenderCommandBuffer::SUBMIT_QUAD:
+                {
+                    TextureHandle texture( pCommand->mpTexture );
+                    SubmitQuads(
+                        pCommand->mVertexCount / 4,
+                        commandBuffer.mVertices.address() + pCommand->mVertexStart,
+                        commandBuffer.mTextures.address() + pCommand->mVertexStart,
+                        texture,
+                        pCommand->mColor );
+                }
+                break;
+
+            case BatchRenderCommandBuffer::BLEND_MODE:
+                setBlendMode( pCommand->mSrcBlendFactor, pCommand->mDstBlendFactor, pCommand->mColor );
+                break;
+
+            case BatchRenderCommandBuffer::BLEND_OFF:
+                setBlendOff();
+                break;
+
+            case BatchRenderCommandBuffer::ALPHA_TEST_MODE:
+                setAlphaTestMode( pCommand->mAlphaTestMode );
+                break;
+
+            case BatchRenderCommandBuffer::STRICT_ORDER_MODE:
+                setStrictOrderMode( pCommand->mStrictOrderMode, pCommand->mForceFlush );
+                break;
+
+            case BatchRenderCommandBuffer::FLUSH:
+                flush( *pCommand->mpReasonMetric );
+                break;
+
+            case BatchRenderCommandBuffer::FLUSH_ANONYMOUS:
+                flush();
+                break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flushInternal( void )
 {
     // Debug Profiling.
@@ -398,8 +749,8 @@ void BatchRender::flushInternal( void )
 
     // Enable vertex and texture arrays.
     glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+    glVertexPointer( 2, GL_FLOAT, sizeof(BatchVertex), &mVertexBuffer[0].mPosition );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(BatchVertex), &mVertexBuffer[0].mTexture );
 
     // Use the texture coordinates if not in wireframe mode.
     if ( !mWireframeMode )
@@ -410,7 +761,7 @@ void BatchRender::flushInternal( void )
     {
         // Yes, so enable color array.
         glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), &mVertexBuffer[0].mColor );
     }
 
     // Strict order mode?
@@ -474,6 +825,9 @@ void BatchRender::flushInternal( void )
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
+
+                        // Move to the next quad.
+                        triangleIndex += 4;
                     }
                 }
                 else if ( primitiveMode == TriangleRun::TRIANGLE )
@@ -537,7 +891,6 @@ void BatchRender::flushInternal( void )
     // Reset batch state.
     mTriangleCount = 0;
     mVertexCount = 0;
-    mTextureCoordCount = 0;
     mIndexCount = 0;
     mColorCount = 0;
 }
@@ -585,4 +938,57 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
     return pIndexVector;
 }
 
+//-----------------------------------------------------------------------------
+
+TextureObject* BatchRender::findAtlasPage( TextureHandle& texture, const Vector2* pTextureArray, const U32 textureCount ) const
+{
+    // Fetch the texture object.
+    TextureObject* pTextureObject = texture;
+
+    // Finish if the texture isn't packed into an atlas page.
+    if ( pTextureObject == NULL || pTextureObject->getAtlasPage() == NULL )
+        return NULL;
+
+    // Fetch the atlas page.
+    TextureObject* pAtlasPage = pTextureObject->getAtlasPage();
+
+    // Finish if the filter has changed since the texture was packed.
+    if ( pAtlasPage->getFilter() != pTextureObject->getFilter() )
+        return NULL;
+
+    // Only the bitmap area is packed so any coordinates outside it must use the original texture.
+    const F32 epsilon = 1.0e-4f;
+    const F32 maxU = ((F32)pTextureObject->getBitmapWidth() / (F32)pTextureObject->getTextureWidth()) + epsilon;
+    const F32 maxV = ((F32)pTextureObject->getBitmapHeight() / (F32)pTextureObject->getTextureHeight()) + epsilon;
+    for( U32 n = 0; n < textureCount; ++n )
+    {
+        const Vector2& texturePos = pTextureArray[n];
+
+        if ( texturePos.x < -epsilon || texturePos.x > maxU || texturePos.y < -epsilon || texturePos.y > maxV )
+            return NULL;
+    }
 
+    return pAtlasPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::remapAtlasCoords( TextureHandle& texture, TextureObject* pAtlasPage, BatchVertex* pVertexArray, const U32 vertexCount ) const
+{
+    // Fetch the texture object.
+    TextureObject* pTextureObject = texture;
+
+    // Calculate the mapping from the texture into the atlas page.
+    const F32 pageWidthScale = 1.0f / (F32)pAtlasPage->getTextureWidth();
+    const F32 pageHeightScale = 1.0f / (F32)pAtlasPage->getTextureHeight();
+    const Vector2 scale( (F32)pTextureObject->getTextureWidth() * pageWidthScale, (F32)pTextureObject->getTextureHeight() * pageHeightScale );
+    const Vector2 offset( (F32)pTextureObject->getAtlasOffsetX() * pageWidthScale, (F32)pTextureObject->getAtlasOffsetY() * pageHeightScale );
+
+    // Remap the texture coordinates.
+    for( U32 n = 0; n < vertexCount; ++n )
+    {
+        Vector2& texturePos = pVertexArray[n].mTexture;
+        texturePos.x = offset.x + texturePos.x * scale.x;
+        texturePos.y = offset.y + texturePos.y * scale.y;
+    }
+}
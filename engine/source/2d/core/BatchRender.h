@@ -58,6 +58,90 @@ class SceneRenderRequest;
 
 //-----------------------------------------------------------------------------
 
+/// A buffer of batch render commands recorded by a batch renderer in record mode.
+/// Recording touches no render state and no GL so it can be done on any thread; the
+/// commands are then replayed, in order, into a real batch renderer on the main thread.
+/// NOTE:   Textures are stored as raw texture objects so recording never touches texture reference counts.
+class BatchRenderCommandBuffer
+{
+    friend class BatchRender;
+
+public:
+    enum CommandType
+    {
+        SUBMIT_TRIANGLES,
+        SUBMIT_QUAD,
+        BLEND_MODE,
+        BLEND_OFF,
+        ALPHA_TEST_MODE,
+        STRICT_ORDER_MODE,
+        FLUSH,
+        FLUSH_ANONYMOUS,
+    };
+
+    struct Command
+    {
+        CommandType     mType;
+        U32             mVertexStart;
+        U32             mVertexCount;
+        U32             mColorStart;
+        TextureObject*  mpTexture;
+        ColorF          mColor;
+        GLenum          mSrcBlendFactor;
+        GLenum          mDstBlendFactor;
+        F32             mAlphaTestMode;
+        bool            mStrictOrderMode;
+        bool            mForceFlush;
+        U32*            mpReasonMetric;
+    };
+
+private:
+    Vector<Command>     mCommands;
+    Vector<Vector2>     mVertices;
+    Vector<Vector2>     mTextures;
+    Vector<ColorF>      mColors;
+
+    /// Add a command.
+    inline Command& addCommand( const CommandType commandType )
+    {
+        growStorage( mCommands, 1 );
+        mCommands.increment();
+        Command& command = mCommands.last();
+        command.mType = commandType;
+        return command;
+    }
+
+    /// Grow storage geometrically so that recording large scenes does not reallocate per command.
+    template<class T> static inline void growStorage( Vector<T>& storage, const U32 count )
+    {
+        const U32 required = storage.size() + count;
+        if ( required > storage.capacity() )
+            storage.reserve( getMax( required, storage.capacity() * 2 ) );
+    }
+
+public:
+    BatchRenderCommandBuffer()
+    {
+        VECTOR_SET_ASSOCIATION( mCommands );
+        VECTOR_SET_ASSOCIATION( mVertices );
+        VECTOR_SET_ASSOCIATION( mTextures );
+        VECTOR_SET_ASSOCIATION( mColors );
+    }
+
+    /// Clear the recorded commands (storage is kept for reuse).
+    inline void clear( void )
+    {
+        mCommands.clear();
+        mVertices.clear();
+        mTextures.clear();
+        mColors.clear();
+    }
+
+    inline U32 getCommandCount( void ) const { return mCommands.size(); }
+};
+
+//-----------------------------------------------------------------------------
+
 class BatchRender
 {
 private:
@@ -80,6 +164,15 @@ private:
         U32 mStartIndex;
     };
 
+    /// Interleaved batch vertex.
+    /// NOTE: Colors are packed as RGBA8 which is what fixed-function GL converts them to anyway.
+    struct BatchVertex
+    {
+        Vector2 mPosition;
+        Vector2 mTexture;
+        ColorI  mColor;
+    };
+
     typedef Vector<TriangleRun> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
 
@@ -88,14 +181,11 @@ private:
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
-    U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
+    BatchVertex*        mVertexBuffer;
+    U16*                mIndexBuffer;
    
     U32                 mTriangleCount;
     U32                 mVertexCount;
-    U32                 mTextureCoordCount;
     U32                 mIndexCount;
     U32                 mColorCount;
 
@@ -111,9 +201,13 @@ private:
 
     bool                mWireframeMode;
     bool                mBatchEnabled;
+    bool                mAtlasEnabled;
+
+    BatchRenderCommandBuffer* mpCommandBuffer;
 
 public:
     BatchRender();
+    explicit BatchRender( BatchRenderCommandBuffer* pCommandBuffer );
     virtual ~BatchRender();
 
 	static const U32 maxVertexCount = BATCHRENDER_BUFFERSIZE; 
@@ -125,6 +219,16 @@ public:
         if ( !forceFlush && strictOrder == mStrictOrderMode )
             return;
 
+        // Record if recording.
+        if ( mpCommandBuffer != NULL )
+        {
+            BatchRenderCommandBuffer::Command& command = mpCommandBuffer->addCommand( BatchRenderCommandBuffer::STRICT_ORDER_MODE );
+            command.mStrictOrderMode = strictOrder;
+            command.mForceFlush = forceFlush;
+            mStrictOrderMode = strictOrder;
+            return;
+        }
+
         // Flush.
         flushInternal();
 
@@ -138,6 +242,17 @@ public:
     /// Turns-on blend mode with the specified blend factors and color.
     inline void setBlendMode( GLenum srcFactor, GLenum dstFactor, const ColorF& blendColor = ColorF(1.0f, 1.0f, 1.0f, 1.0f))
     {
+        // Record if recording.
+        // NOTE:    Blend state is not tracked when recording so changes are filtered when replayed.
+        if ( mpCommandBuffer != NULL )
+        {
+            BatchRenderCommandBuffer::Command& command = mpCommandBuffer->addCommand( BatchRenderCommandBuffer::BLEND_MODE );
+            command.mSrcBlendFactor = srcFactor;
+            command.mDstBlendFactor = dstFactor;
+            command.mColor = blendColor;
+            return;
+        }
+
         // Ignore no change.
         if (    mBlendMode &&
                 mSrcBlendFactor == srcFactor &&
@@ -157,6 +272,13 @@ public:
     /// Turns-off blend mode.
     inline void setBlendOff( void )
     {
+        // Record if recording.
+        if ( mpCommandBuffer != NULL )
+        {
+            mpCommandBuffer->addCommand( BatchRenderCommandBuffer::BLEND_OFF );
+            return;
+        }
+
         // Ignore no change,
         if ( !mBlendMode )
             return;
@@ -173,6 +295,13 @@ public:
     /// Set alpha-test mode.
     void setAlphaTestMode( const F32 alphaTestMode )
     {
+        // Record if recording.
+        if ( mpCommandBuffer != NULL )
+        {
+            mpCommandBuffer->addCommand( BatchRenderCommandBuffer::ALPHA_TEST_MODE ).mAlphaTestMode = alphaTestMode;
+            return;
+        }
+
         // Ignore no change.
         if ( mIsEqual( mAlphaTestMode, alphaTestMode ) )
             return;
@@ -218,6 +347,12 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets whether textures packed into a texture atlas are batched using their atlas page.
+    inline void setAtlasEnabled( const bool enabled ) { mAtlasEnabled = enabled; }
+
+    /// Gets whether textures packed into a texture atlas are batched using their atlas page.
+    inline bool getAtlasEnabled( void ) const { return mAtlasEnabled; }
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
@@ -252,6 +387,15 @@ public:
             TextureHandle& texture,
             const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
 
+    /// Submit a run of quads sharing a texture and color for batching.
+    /// Each quad uses four consecutive vertices and textures indexed as SubmitQuad.
+    void SubmitQuads(
+            const U32 quadCount,
+            const Vector2* pVertexArray,
+            const Vector2* pTextureArray,
+            TextureHandle& texture,
+            const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
+
     /// Render a quad immediately without affecting current batch.
     /// All render state should be set beforehand directly.
     /// Vertex and textures are indexed as:
@@ -287,12 +431,34 @@ public:
     /// Flush (render) any pending batches.
     void flush( void );
 
+    /// Gets whether this batch renderer is recording into a command buffer.
+    inline bool isRecording( void ) const { return mpCommandBuffer != NULL; }
+
+    /// Replay a range of recorded commands into this batch renderer.
+    void replay( const BatchRenderCommandBuffer& commandBuffer, const U32 commandStart, const U32 commandCount );
+
 private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Find the atlas page the texture coordinates can be remapped into (if any).
+    TextureObject* findAtlasPage( TextureHandle& texture, const Vector2* pTextureArray, const U32 textureCount ) const;
+
+    /// Remap the texture coordinates of batched vertices into the atlas page.
+    void remapAtlasCoords( TextureHandle& texture, TextureObject* pAtlasPage, BatchVertex* pVertexArray, const U32 vertexCount ) const;
+
+    /// Pack a color into the batch vertex format.
+    static inline ColorI packColor( const ColorF& color )
+    {
+        return ColorI(
+            U8( mClampF( color.red, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.green, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.blue, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.alpha, 0.0f, 1.0f ) * 255.0f + 0.5f ) );
+    }
 };
 
 #endif
\ No newline at end of file
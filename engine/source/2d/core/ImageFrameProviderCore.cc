@@ -170,6 +170,22 @@ bool ImageFrameProviderCore::update( const F32 elapsedTime )
 
 //------------------------------------------------------------------------------
 
+bool ImageFrameProviderCore::isUpdateIsolated( void ) const
+{
+    // A static provider only ever turns-off tick processing.
+    if ( isStaticFrameProvider() )
+        return !isProcessingTicks();
+
+    // Finish if there's no animation to end.
+    if ( mpAnimationAsset == NULL || mpAnimationAsset->isNull() || isAnimationFinished() || isAnimationPaused() )
+        return true;
+
+    // A cycling animation never ends so never performs the end callback.
+    return (*mpAnimationAsset)->getAnimationCycle();
+}
+
+//------------------------------------------------------------------------------
+
 void ImageFrameProviderCore::processTick( void )
 {
     // Update using tick period.
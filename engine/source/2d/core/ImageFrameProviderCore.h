@@ -98,6 +98,7 @@ public:
     virtual void advanceTime( F32 timeDelta ) {};
     virtual void setProcessTicks( bool tick  ) { Tickable::setProcessTicks( mSelfTick ? tick : false ); }
     bool updateAnimation( const F32 elapsedTime );
+    bool isUpdateIsolated( void ) const; ///< True if an update cannot perform callbacks or change tick processing.
 
     virtual bool validRender( void ) const;
 
@@ -0,0 +1,556 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/ParticleIntegrator.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+// SSE2 is part of the x86-64 baseline so it is used whenever the compiler targets it.
+#if !defined(__EMSCRIPTEN__) && ( defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) )
+#define PARTICLE_INTEGRATOR_SSE
+#include <emmintrin.h>
+
+// AVX is compiled per-function and only selected when the CPU reports support for it.
+#if defined(_MSC_VER)
+#define PARTICLE_INTEGRATOR_AVX
+#define PARTICLE_INTEGRATOR_AVX_FUNCTION
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__GNUC__) && ( defined(__clang__) || __GNUC__ >= 5 )
+#define PARTICLE_INTEGRATOR_AVX
+#define PARTICLE_INTEGRATOR_AVX_FUNCTION __attribute__((target("avx")))
+#include <immintrin.h>
+#endif
+#endif
+
+//-----------------------------------------------------------------------------
+
+ParticleIntegrator::InstructionSet ParticleIntegrator::smInstructionSet = ParticleIntegrator::getBestInstructionSet();
+
+//-----------------------------------------------------------------------------
+
+ParticleIntegrator::InstructionSet ParticleIntegrator::getBestInstructionSet( void )
+{
+#if defined(PARTICLE_INTEGRATOR_AVX)
+#if defined(_MSC_VER)
+    // Check both the CPU flag and that the OS saves the YMM registers.
+    int cpuInfo[4];
+    __cpuid( cpuInfo, 1 );
+    const bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+    const bool avx = (cpuInfo[2] & (1 << 28)) != 0;
+    if ( osxsave && avx && (_xgetbv(0) & 0x6) == 0x6 )
+        return INSTRUCTION_SET_AVX;
+#else
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx") )
+        return INSTRUCTION_SET_AVX;
+#endif
+#endif
+
+#if defined(PARTICLE_INTEGRATOR_SSE)
+    return INSTRUCTION_SET_SSE;
+#else
+    return INSTRUCTION_SET_SCALAR;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool ParticleIntegrator::setInstructionSet( const InstructionSet instructionSet )
+{
+    // Ignore if the instruction set is better than the best available.
+    if ( instructionSet > getBestInstructionSet() )
+    {
+        // Warn.
+        Con::warnf( "ParticleIntegrator::setInstructionSet() - The instruction set '%s' is not supported.", getInstructionSetDescription(instructionSet) );
+        return false;
+    }
+
+    smInstructionSet = instructionSet;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* ParticleIntegrator::getInstructionSetDescription( const InstructionSet instructionSet )
+{
+    switch( instructionSet )
+    {
+        case INSTRUCTION_SET_SCALAR:    return "Scalar";
+        case INSTRUCTION_SET_SSE:       return "SSE";
+        case INSTRUCTION_SET_AVX:       return "AVX";
+    }
+
+    return "Undefined";
+}
+
+//-----------------------------------------------------------------------------
+// Scalar kernels.
+// These are also used to finish the tail of a batch the vector kernels cannot fill.
+//-----------------------------------------------------------------------------
+
+static void integratePropertiesScalar( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::LifeSamples& lifeSamples, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 sampleIndex, const U32 count )
+{
+    for ( U32 index = 0; index < count; ++index )
+    {
+        const U32 particleIndex = startIndex + index;
+        const U32 lifeIndex = sampleIndex + index;
+
+        // Copy old tick position.
+        particleStore.mPreTickPositionX[particleIndex] = particleStore.mPostTickPositionX[particleIndex];
+        particleStore.mPreTickPositionY[particleIndex] = particleStore.mPostTickPositionY[particleIndex];
+
+        // Scale size.
+        particleStore.mRenderSizeX[particleIndex] = mClampF( particleStore.mSizeX[particleIndex] * lifeSamples.mSizeX[lifeIndex], parameters.mSizeXMin, parameters.mSizeXMax );
+        particleStore.mRenderSizeY[particleIndex] = parameters.mFixedAspect ?
+            particleStore.mRenderSizeX[particleIndex] :
+            mClampF( particleStore.mSizeY[particleIndex] * lifeSamples.mSizeY[lifeIndex], parameters.mSizeYMin, parameters.mSizeYMax );
+
+        // Scale speed, fixed-force and random-motion.
+        particleStore.mRenderSpeed[particleIndex] = mClampF( particleStore.mSpeed[particleIndex] * lifeSamples.mSpeed[lifeIndex], parameters.mSpeedMin, parameters.mSpeedMax );
+        particleStore.mRenderFixedForce[particleIndex] = mClampF( particleStore.mFixedForce[particleIndex] * lifeSamples.mFixedForce[lifeIndex], parameters.mFixedForceMin, parameters.mFixedForceMax );
+        particleStore.mRenderRandomMotion[particleIndex] = mClampF( particleStore.mRandomMotion[particleIndex] * lifeSamples.mRandomMotion[lifeIndex], parameters.mRandomMotionMin, parameters.mRandomMotionMax );
+
+        // Calculate the color.
+        particleStore.mColorRed[particleIndex] = mClampF( lifeSamples.mRed[lifeIndex], parameters.mRedMin, parameters.mRedMax );
+        particleStore.mColorGreen[particleIndex] = mClampF( lifeSamples.mGreen[lifeIndex], parameters.mGreenMin, parameters.mGreenMax );
+        particleStore.mColorBlue[particleIndex] = mClampF( lifeSamples.mBlue[lifeIndex], parameters.mBlueMin, parameters.mBlueMax );
+        particleStore.mColorAlpha[particleIndex] = mClampF( lifeSamples.mAlpha[lifeIndex] * parameters.mAlphaScale, parameters.mAlphaMin, parameters.mAlphaMax );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void integrateMotionScalar( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const F32 elapsedTime = parameters.mElapsedTime;
+
+    for ( U32 particleIndex = startIndex; particleIndex < startIndex + count; ++particleIndex )
+    {
+        // Do we have any fixed force?
+        if ( mNotZero( particleStore.mRenderFixedForce[particleIndex] ) )
+        {
+            // Yes, so time-integrate a fixed force to the velocity.
+            const Vector2 fixedForce = parameters.mFixedForceDirection * (particleStore.mRenderFixedForce[particleIndex] * parameters.mForceScale) * elapsedTime;
+            particleStore.mVelocityX[particleIndex] += fixedForce.x;
+            particleStore.mVelocityY[particleIndex] += fixedForce.y;
+        }
+
+        // Adjust particle position.
+        const F32 displacementScale = particleStore.mRenderSpeed[particleIndex] * elapsedTime;
+        particleStore.mPositionX[particleIndex] += particleStore.mVelocityX[particleIndex] * displacementScale;
+        particleStore.mPositionY[particleIndex] += particleStore.mVelocityY[particleIndex] * displacementScale;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void integrateBoundsScalar( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    for ( U32 particleIndex = startIndex; particleIndex < startIndex + count; ++particleIndex )
+    {
+        const F32 renderSizeX = particleStore.mRenderSizeX[particleIndex];
+        const F32 renderSizeY = particleStore.mRenderSizeY[particleIndex];
+        const F32 rotationSin = particleStore.mRotationSin[particleIndex];
+        const F32 rotationCos = particleStore.mRotationCos[particleIndex];
+        const F32 positionX = particleStore.mPositionX[particleIndex];
+        const F32 positionY = particleStore.mPositionY[particleIndex];
+
+        // Transform the scaled local AABB into the world OOBB.
+        for ( U32 corner = 0; corner < 4; ++corner )
+        {
+            const F32 localX = parameters.mLocalAABB[corner].x * renderSizeX;
+            const F32 localY = parameters.mLocalAABB[corner].y * renderSizeY;
+            particleStore.mRenderOOBBX[corner][particleIndex] = (rotationCos * localX - rotationSin * localY) + positionX;
+            particleStore.mRenderOOBBY[corner][particleIndex] = (rotationSin * localX + rotationCos * localY) + positionY;
+        }
+
+        // Set post tick position.
+        particleStore.mPostTickPositionX[particleIndex] = positionX;
+        particleStore.mPostTickPositionY[particleIndex] = positionY;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// SSE kernels.
+//-----------------------------------------------------------------------------
+
+#if defined(PARTICLE_INTEGRATOR_SSE)
+
+static inline __m128 clampSSE( const __m128 value, const __m128 minValue, const __m128 maxValue )
+{
+    // Matches mClampF().
+    return _mm_max_ps( _mm_min_ps( value, maxValue ), minValue );
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 integratePropertiesSSE( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::LifeSamples& lifeSamples, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const __m128 sizeXMin = _mm_set1_ps( parameters.mSizeXMin );
+    const __m128 sizeXMax = _mm_set1_ps( parameters.mSizeXMax );
+    const __m128 sizeYMin = _mm_set1_ps( parameters.mSizeYMin );
+    const __m128 sizeYMax = _mm_set1_ps( parameters.mSizeYMax );
+    const __m128 speedMin = _mm_set1_ps( parameters.mSpeedMin );
+    const __m128 speedMax = _mm_set1_ps( parameters.mSpeedMax );
+    const __m128 fixedForceMin = _mm_set1_ps( parameters.mFixedForceMin );
+    const __m128 fixedForceMax = _mm_set1_ps( parameters.mFixedForceMax );
+    const __m128 randomMotionMin = _mm_set1_ps( parameters.mRandomMotionMin );
+    const __m128 randomMotionMax = _mm_set1_ps( parameters.mRandomMotionMax );
+    const __m128 redMin = _mm_set1_ps( parameters.mRedMin );
+    const __m128 redMax = _mm_set1_ps( parameters.mRedMax );
+    const __m128 greenMin = _mm_set1_ps( parameters.mGreenMin );
+    const __m128 greenMax = _mm_set1_ps( parameters.mGreenMax );
+    const __m128 blueMin = _mm_set1_ps( parameters.mBlueMin );
+    const __m128 blueMax = _mm_set1_ps( parameters.mBlueMax );
+    const __m128 alphaMin = _mm_set1_ps( parameters.mAlphaMin );
+    const __m128 alphaMax = _mm_set1_ps( parameters.mAlphaMax );
+    const __m128 alphaScale = _mm_set1_ps( parameters.mAlphaScale );
+
+    const U32 vectorCount = count & ~3U;
+    for ( U32 index = 0; index < vectorCount; index += 4 )
+    {
+        // The store streams are only element aligned when the batch start is arbitrary.
+        const U32 particleIndex = startIndex + index;
+
+        _mm_storeu_ps( particleStore.mPreTickPositionX + particleIndex, _mm_loadu_ps( particleStore.mPostTickPositionX + particleIndex ) );
+        _mm_storeu_ps( particleStore.mPreTickPositionY + particleIndex, _mm_loadu_ps( particleStore.mPostTickPositionY + particleIndex ) );
+
+        const __m128 renderSizeX = clampSSE( _mm_mul_ps( _mm_loadu_ps( particleStore.mSizeX + particleIndex ), _mm_loadu_ps( lifeSamples.mSizeX + index ) ), sizeXMin, sizeXMax );
+        _mm_storeu_ps( particleStore.mRenderSizeX + particleIndex, renderSizeX );
+        _mm_storeu_ps( particleStore.mRenderSizeY + particleIndex, parameters.mFixedAspect ?
+            renderSizeX :
+            clampSSE( _mm_mul_ps( _mm_loadu_ps( particleStore.mSizeY + particleIndex ), _mm_loadu_ps( lifeSamples.mSizeY + index ) ), sizeYMin, sizeYMax ) );
+
+        _mm_storeu_ps( particleStore.mRenderSpeed + particleIndex, clampSSE( _mm_mul_ps( _mm_loadu_ps( particleStore.mSpeed + particleIndex ), _mm_loadu_ps( lifeSamples.mSpeed + index ) ), speedMin, speedMax ) );
+        _mm_storeu_ps( particleStore.mRenderFixedForce + particleIndex, clampSSE( _mm_mul_ps( _mm_loadu_ps( particleStore.mFixedForce + particleIndex ), _mm_loadu_ps( lifeSamples.mFixedForce + index ) ), fixedForceMin, fixedForceMax ) );
+        _mm_storeu_ps( particleStore.mRenderRandomMotion + particleIndex, clampSSE( _mm_mul_ps( _mm_loadu_ps( particleStore.mRandomMotion + particleIndex ), _mm_loadu_ps( lifeSamples.mRandomMotion + index ) ), randomMotionMin, randomMotionMax ) );
+
+        _mm_storeu_ps( particleStore.mColorRed + particleIndex, clampSSE( _mm_loadu_ps( lifeSamples.mRed + index ), redMin, redMax ) );
+        _mm_storeu_ps( particleStore.mColorGreen + particleIndex, clampSSE( _mm_loadu_ps( lifeSamples.mGreen + index ), greenMin, greenMax ) );
+        _mm_storeu_ps( particleStore.mColorBlue + particleIndex, clampSSE( _mm_loadu_ps( lifeSamples.mBlue + index ), blueMin, blueMax ) );
+        _mm_storeu_ps( particleStore.mColorAlpha + particleIndex, clampSSE( _mm_mul_ps( _mm_loadu_ps( lifeSamples.mAlpha + index ), alphaScale ), alphaMin, alphaMax ) );
+    }
+
+    return vectorCount;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 integrateMotionSSE( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const __m128 elapsedTime = _mm_set1_ps( parameters.mElapsedTime );
+    const __m128 forceScale = _mm_set1_ps( parameters.mForceScale );
+    const __m128 forceDirectionX = _mm_set1_ps( parameters.mFixedForceDirection.x );
+    const __m128 forceDirectionY = _mm_set1_ps( parameters.mFixedForceDirection.y );
+    const __m128 epsilon = _mm_set1_ps( FLT_EPSILON );
+    const __m128 absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+
+    const U32 vectorCount = count & ~3U;
+    for ( U32 index = 0; index < vectorCount; index += 4 )
+    {
+        const U32 particleIndex = startIndex + index;
+
+        // Only apply the fixed force where it is not zero (matches mNotZero()).
+        const __m128 renderFixedForce = _mm_loadu_ps( particleStore.mRenderFixedForce + particleIndex );
+        const __m128 forceMask = _mm_cmpnlt_ps( _mm_and_ps( renderFixedForce, absMask ), epsilon );
+        const __m128 force = _mm_mul_ps( renderFixedForce, forceScale );
+        const __m128 forceX = _mm_and_ps( _mm_mul_ps( _mm_mul_ps( forceDirectionX, force ), elapsedTime ), forceMask );
+        const __m128 forceY = _mm_and_ps( _mm_mul_ps( _mm_mul_ps( forceDirectionY, force ), elapsedTime ), forceMask );
+        const __m128 velocityX = _mm_add_ps( _mm_loadu_ps( particleStore.mVelocityX + particleIndex ), forceX );
+        const __m128 velocityY = _mm_add_ps( _mm_loadu_ps( particleStore.mVelocityY + particleIndex ), forceY );
+        _mm_storeu_ps( particleStore.mVelocityX + particleIndex, velocityX );
+        _mm_storeu_ps( particleStore.mVelocityY + particleIndex, velocityY );
+
+        // Adjust particle position.
+        const __m128 displacementScale = _mm_mul_ps( _mm_loadu_ps( particleStore.mRenderSpeed + particleIndex ), elapsedTime );
+        _mm_storeu_ps( particleStore.mPositionX + particleIndex, _mm_add_ps( _mm_loadu_ps( particleStore.mPositionX + particleIndex ), _mm_mul_ps( velocityX, displacementScale ) ) );
+        _mm_storeu_ps( particleStore.mPositionY + particleIndex, _mm_add_ps( _mm_loadu_ps( particleStore.mPositionY + particleIndex ), _mm_mul_ps( velocityY, displacementScale ) ) );
+    }
+
+    return vectorCount;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 integrateBoundsSSE( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const U32 vectorCount = count & ~3U;
+    for ( U32 index = 0; index < vectorCount; index += 4 )
+    {
+        const U32 particleIndex = startIndex + index;
+
+        const __m128 renderSizeX = _mm_loadu_ps( particleStore.mRenderSizeX + particleIndex );
+        const __m128 renderSizeY = _mm_loadu_ps( particleStore.mRenderSizeY + particleIndex );
+        const __m128 rotationSin = _mm_loadu_ps( particleStore.mRotationSin + particleIndex );
+        const __m128 rotationCos = _mm_loadu_ps( particleStore.mRotationCos + particleIndex );
+        const __m128 positionX = _mm_loadu_ps( particleStore.mPositionX + particleIndex );
+        const __m128 positionY = _mm_loadu_ps( particleStore.mPositionY + particleIndex );
+
+        // Transform the scaled local AABB into the world OOBB.
+        for ( U32 corner = 0; corner < 4; ++corner )
+        {
+            const __m128 localX = _mm_mul_ps( _mm_set1_ps( parameters.mLocalAABB[corner].x ), renderSizeX );
+            const __m128 localY = _mm_mul_ps( _mm_set1_ps( parameters.mLocalAABB[corner].y ), renderSizeY );
+            _mm_storeu_ps( particleStore.mRenderOOBBX[corner] + particleIndex, _mm_add_ps( _mm_sub_ps( _mm_mul_ps( rotationCos, localX ), _mm_mul_ps( rotationSin, localY ) ), positionX ) );
+            _mm_storeu_ps( particleStore.mRenderOOBBY[corner] + particleIndex, _mm_add_ps( _mm_add_ps( _mm_mul_ps( rotationSin, localX ), _mm_mul_ps( rotationCos, localY ) ), positionY ) );
+        }
+
+        // Set post tick position.
+        _mm_storeu_ps( particleStore.mPostTickPositionX + particleIndex, positionX );
+        _mm_storeu_ps( particleStore.mPostTickPositionY + particleIndex, positionY );
+    }
+
+    return vectorCount;
+}
+
+#endif // PARTICLE_INTEGRATOR_SSE
+
+//-----------------------------------------------------------------------------
+// AVX kernels.
+//-----------------------------------------------------------------------------
+
+#if defined(PARTICLE_INTEGRATOR_AVX)
+
+PARTICLE_INTEGRATOR_AVX_FUNCTION static inline __m256 clampAVX( const __m256 value, const __m256 minValue, const __m256 maxValue )
+{
+    // Matches mClampF().
+    return _mm256_max_ps( _mm256_min_ps( value, maxValue ), minValue );
+}
+
+//-----------------------------------------------------------------------------
+
+PARTICLE_INTEGRATOR_AVX_FUNCTION static U32 integratePropertiesAVX( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::LifeSamples& lifeSamples, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const __m256 sizeXMin = _mm256_set1_ps( parameters.mSizeXMin );
+    const __m256 sizeXMax = _mm256_set1_ps( parameters.mSizeXMax );
+    const __m256 sizeYMin = _mm256_set1_ps( parameters.mSizeYMin );
+    const __m256 sizeYMax = _mm256_set1_ps( parameters.mSizeYMax );
+    const __m256 speedMin = _mm256_set1_ps( parameters.mSpeedMin );
+    const __m256 speedMax = _mm256_set1_ps( parameters.mSpeedMax );
+    const __m256 fixedForceMin = _mm256_set1_ps( parameters.mFixedForceMin );
+    const __m256 fixedForceMax = _mm256_set1_ps( parameters.mFixedForceMax );
+    const __m256 randomMotionMin = _mm256_set1_ps( parameters.mRandomMotionMin );
+    const __m256 randomMotionMax = _mm256_set1_ps( parameters.mRandomMotionMax );
+    const __m256 redMin = _mm256_set1_ps( parameters.mRedMin );
+    const __m256 redMax = _mm256_set1_ps( parameters.mRedMax );
+    const __m256 greenMin = _mm256_set1_ps( parameters.mGreenMin );
+    const __m256 greenMax = _mm256_set1_ps( parameters.mGreenMax );
+    const __m256 blueMin = _mm256_set1_ps( parameters.mBlueMin );
+    const __m256 blueMax = _mm256_set1_ps( parameters.mBlueMax );
+    const __m256 alphaMin = _mm256_set1_ps( parameters.mAlphaMin );
+    const __m256 alphaMax = _mm256_set1_ps( parameters.mAlphaMax );
+    const __m256 alphaScale = _mm256_set1_ps( parameters.mAlphaScale );
+
+    const U32 vectorCount = count & ~7U;
+    for ( U32 index = 0; index < vectorCount; index += 8 )
+    {
+        const U32 particleIndex = startIndex + index;
+
+        _mm256_storeu_ps( particleStore.mPreTickPositionX + particleIndex, _mm256_loadu_ps( particleStore.mPostTickPositionX + particleIndex ) );
+        _mm256_storeu_ps( particleStore.mPreTickPositionY + particleIndex, _mm256_loadu_ps( particleStore.mPostTickPositionY + particleIndex ) );
+
+        const __m256 renderSizeX = clampAVX( _mm256_mul_ps( _mm256_loadu_ps( particleStore.mSizeX + particleIndex ), _mm256_loadu_ps( lifeSamples.mSizeX + index ) ), sizeXMin, sizeXMax );
+        _mm256_storeu_ps( particleStore.mRenderSizeX + particleIndex, renderSizeX );
+        _mm256_storeu_ps( particleStore.mRenderSizeY + particleIndex, parameters.mFixedAspect ?
+            renderSizeX :
+            clampAVX( _mm256_mul_ps( _mm256_loadu_ps( particleStore.mSizeY + particleIndex ), _mm256_loadu_ps( lifeSamples.mSizeY + index ) ), sizeYMin, sizeYMax ) );
+
+        _mm256_storeu_ps( particleStore.mRenderSpeed + particleIndex, clampAVX( _mm256_mul_ps( _mm256_loadu_ps( particleStore.mSpeed + particleIndex ), _mm256_loadu_ps( lifeSamples.mSpeed + index ) ), speedMin, speedMax ) );
+        _mm256_storeu_ps( particleStore.mRenderFixedForce + particleIndex, clampAVX( _mm256_mul_ps( _mm256_loadu_ps( particleStore.mFixedForce + particleIndex ), _mm256_loadu_ps( lifeSamples.mFixedForce + index ) ), fixedForceMin, fixedForceMax ) );
+        _mm256_storeu_ps( particleStore.mRenderRandomMotion + particleIndex, clampAVX( _mm256_mul_ps( _mm256_loadu_ps( particleStore.mRandomMotion + particleIndex ), _mm256_loadu_ps( lifeSamples.mRandomMotion + index ) ), randomMotionMin, randomMotionMax ) );
+
+        _mm256_storeu_ps( particleStore.mColorRed + particleIndex, clampAVX( _mm256_loadu_ps( lifeSamples.mRed + index ), redMin, redMax ) );
+        _mm256_storeu_ps( particleStore.mColorGreen + particleIndex, clampAVX( _mm256_loadu_ps( lifeSamples.mGreen + index ), greenMin, greenMax ) );
+        _mm256_storeu_ps( particleStore.mColorBlue + particleIndex, clampAVX( _mm256_loadu_ps( lifeSamples.mBlue + index ), blueMin, blueMax ) );
+        _mm256_storeu_ps( particleStore.mColorAlpha + particleIndex, clampAVX( _mm256_mul_ps( _mm256_loadu_ps( lifeSamples.mAlpha + index ), alphaScale ), alphaMin, alphaMax ) );
+    }
+
+    return vectorCount;
+}
+
+//-----------------------------------------------------------------------------
+
+PARTICLE_INTEGRATOR_AVX_FUNCTION static U32 integrateMotionAVX( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const __m256 elapsedTime = _mm256_set1_ps( parameters.mElapsedTime );
+    const __m256 forceScale = _mm256_set1_ps( parameters.mForceScale );
+    const __m256 forceDirectionX = _mm256_set1_ps( parameters.mFixedForceDirection.x );
+    const __m256 forceDirectionY = _mm256_set1_ps( parameters.mFixedForceDirection.y );
+    const __m256 epsilon = _mm256_set1_ps( FLT_EPSILON );
+    const __m256 absMask = _mm256_castsi256_ps( _mm256_set1_epi32( 0x7fffffff ) );
+
+    const U32 vectorCount = count & ~7U;
+    for ( U32 index = 0; index < vectorCount; index += 8 )
+    {
+        const U32 particleIndex = startIndex + index;
+
+        // Only apply the fixed force where it is not zero (matches mNotZero()).
+        const __m256 renderFixedForce = _mm256_loadu_ps( particleStore.mRenderFixedForce + particleIndex );
+        const __m256 forceMask = _mm256_cmp_ps( _mm256_and_ps( renderFixedForce, absMask ), epsilon, _CMP_NLT_UQ );
+        const __m256 force = _mm256_mul_ps( renderFixedForce, forceScale );
+        const __m256 forceX = _mm256_and_ps( _mm256_mul_ps( _mm256_mul_ps( forceDirectionX, force ), elapsedTime ), forceMask );
+        const __m256 forceY = _mm256_and_ps( _mm256_mul_ps( _mm256_mul_ps( forceDirectionY, force ), elapsedTime ), forceMask );
+        const __m256 velocityX = _mm256_add_ps( _mm256_loadu_ps( particleStore.mVelocityX + particleIndex ), forceX );
+        const __m256 velocityY = _mm256_add_ps( _mm256_loadu_ps( particleStore.mVelocityY + particleIndex ), forceY );
+        _mm256_storeu_ps( particleStore.mVelocityX + particleIndex, velocityX );
+        _mm256_storeu_ps( particleStore.mVelocityY + particleIndex, velocityY );
+
+        // Adjust particle position.
+        const __m256 displacementScale = _mm256_mul_ps( _mm256_loadu_ps( particleStore.mRenderSpeed + particleIndex ), elapsedTime );
+        _mm256_storeu_ps( particleStore.mPositionX + particleIndex, _mm256_add_ps( _mm256_loadu_ps( particleStore.mPositionX + particleIndex ), _mm256_mul_ps( velocityX, displacementScale ) ) );
+        _mm256_storeu_ps( particleStore.mPositionY + particleIndex, _mm256_add_ps( _mm256_loadu_ps( particleStore.mPositionY + particleIndex ), _mm256_mul_ps( velocityY, displacementScale ) ) );
+    }
+
+    return vectorCount;
+}
+
+//-----------------------------------------------------------------------------
+
+PARTICLE_INTEGRATOR_AVX_FUNCTION static U32 integrateBoundsAVX( ParticleSystem::ParticleStore& particleStore, const ParticleIntegrator::Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    const U32 vectorCount = count & ~7U;
+    for ( U32 index = 0; index < vectorCount; index += 8 )
+    {
+        const U32 particleIndex = startIndex + index;
+
+        const __m256 renderSizeX = _mm256_loadu_ps( particleStore.mRenderSizeX + particleIndex );
+        const __m256 renderSizeY = _mm256_loadu_ps( particleStore.mRenderSizeY + particleIndex );
+        const __m256 rotationSin = _mm256_loadu_ps( particleStore.mRotationSin + particleIndex );
+        const __m256 rotationCos = _mm256_loadu_ps( particleStore.mRotationCos + particleIndex );
+        const __m256 positionX = _mm256_loadu_ps( particleStore.mPositionX + particleIndex );
+        const __m256 positionY = _mm256_loadu_ps( particleStore.mPositionY + particleIndex );
+
+        // Transform the scaled local AABB into the world OOBB.
+        for ( U32 corner = 0; corner < 4; ++corner )
+        {
+            const __m256 localX = _mm256_mul_ps( _mm256_set1_ps( parameters.mLocalAABB[corner].x ), renderSizeX );
+            const __m256 localY = _mm256_mul_ps( _mm256_set1_ps( parameters.mLocalAABB[corner].y ), renderSizeY );
+            _mm256_storeu_ps( particleStore.mRenderOOBBX[corner] + particleIndex, _mm256_add_ps( _mm256_sub_ps( _mm256_mul_ps( rotationCos, localX ), _mm256_mul_ps( rotationSin, localY ) ), positionX ) );
+            _mm256_storeu_ps( particleStore.mRenderOOBBY[corner] + particleIndex, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( rotationSin, localX ), _mm256_mul_ps( rotationCos, localY ) ), positionY ) );
+        }
+
+        // Set post tick position.
+        _mm256_storeu_ps( particleStore.mPostTickPositionX + particleIndex, positionX );
+        _mm256_storeu_ps( particleStore.mPostTickPositionY + particleIndex, positionY );
+    }
+
+    return vectorCount;
+}
+
+#endif // PARTICLE_INTEGRATOR_AVX
+
+//-----------------------------------------------------------------------------
+
+void ParticleIntegrator::integrateProperties( ParticleSystem::ParticleStore& particleStore, const LifeSamples& lifeSamples, const Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    // Sanity!
+    AssertFatal( count <= BATCH_SIZE, "ParticleIntegrator::integrateProperties() - Batch is too large." );
+    AssertFatal( startIndex + count <= particleStore.getCount(), "ParticleIntegrator::integrateProperties() - Batch is out of range." );
+
+    U32 vectorCount = 0;
+
+    switch( smInstructionSet )
+    {
+#if defined(PARTICLE_INTEGRATOR_AVX)
+        case INSTRUCTION_SET_AVX:
+            vectorCount = integratePropertiesAVX( particleStore, lifeSamples, parameters, startIndex, count );
+            break;
+#endif
+#if defined(PARTICLE_INTEGRATOR_SSE)
+        case INSTRUCTION_SET_SSE:
+            vectorCount = integratePropertiesSSE( particleStore, lifeSamples, parameters, startIndex, count );
+            break;
+#endif
+        default:
+            break;
+    }
+
+    // Finish the remainder.
+    integratePropertiesScalar( particleStore, lifeSamples, parameters, startIndex + vectorCount, vectorCount, count - vectorCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleIntegrator::integrateMotion( ParticleSystem::ParticleStore& particleStore, const Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    // Sanity!
+    AssertFatal( startIndex + count <= particleStore.getCount(), "ParticleIntegrator::integrateMotion() - Batch is out of range." );
+
+    U32 vectorCount = 0;
+
+    switch( smInstructionSet )
+    {
+#if defined(PARTICLE_INTEGRATOR_AVX)
+        case INSTRUCTION_SET_AVX:
+            vectorCount = integrateMotionAVX( particleStore, parameters, startIndex, count );
+            break;
+#endif
+#if defined(PARTICLE_INTEGRATOR_SSE)
+        case INSTRUCTION_SET_SSE:
+            vectorCount = integrateMotionSSE( particleStore, parameters, startIndex, count );
+            break;
+#endif
+        default:
+            break;
+    }
+
+    // Finish the remainder.
+    integrateMotionScalar( particleStore, parameters, startIndex + vectorCount, count - vectorCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleIntegrator::integrateBounds( ParticleSystem::ParticleStore& particleStore, const Parameters& parameters, const U32 startIndex, const U32 count )
+{
+    // Sanity!
+    AssertFatal( startIndex + count <= particleStore.getCount(), "ParticleIntegrator::integrateBounds() - Batch is out of range." );
+
+    U32 vectorCount = 0;
+
+    switch( smInstructionSet )
+    {
+#if defined(PARTICLE_INTEGRATOR_AVX)
+        case INSTRUCTION_SET_AVX:
+            vectorCount = integrateBoundsAVX( particleStore, parameters, startIndex, count );
+            break;
+#endif
+#if defined(PARTICLE_INTEGRATOR_SSE)
+        case INSTRUCTION_SET_SSE:
+            vectorCount = integrateBoundsSSE( particleStore, parameters, startIndex, count );
+            break;
+#endif
+        default:
+            break;
+    }
+
+    // Finish the remainder.
+    integrateBoundsScalar( particleStore, parameters, startIndex + vectorCount, count - vectorCount );
+}
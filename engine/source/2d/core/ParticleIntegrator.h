@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PARTICLE_INTEGRATOR_H_
+#define _PARTICLE_INTEGRATOR_H_
+
+#ifndef _PARTICLE_SYSTEM_H_
+#include "2d/core/ParticleSystem.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Batched particle integration.
+/// The integrator streams the particles of a single emitter through SSE or AVX kernels (or a scalar fallback)
+/// four or eight particles at a time.  Anything that cannot be vectorized such as field evaluation, random motion,
+/// animation and orientation is done by the caller between the kernel stages.
+class ParticleIntegrator
+{
+public:
+    enum
+    {
+        /// Maximum particles processed per batch so the batch scratch stays cache resident.
+        BATCH_SIZE = 256
+    };
+
+    enum InstructionSet
+    {
+        INSTRUCTION_SET_SCALAR,
+        INSTRUCTION_SET_SSE,
+        INSTRUCTION_SET_AVX
+    };
+
+    /// Emitter parameters constant across a batch.
+    struct Parameters
+    {
+        F32                     mElapsedTime;
+        F32                     mForceScale;
+        bool                    mFixedAspect;
+        bool                    mSingleParticle;
+        Vector2                 mFixedForceDirection;
+        Vector2                 mLocalAABB[4];
+
+        /// Clamp ranges.
+        F32                     mSizeXMin, mSizeXMax;
+        F32                     mSizeYMin, mSizeYMax;
+        F32                     mSpeedMin, mSpeedMax;
+        F32                     mFixedForceMin, mFixedForceMax;
+        F32                     mRandomMotionMin, mRandomMotionMax;
+        F32                     mRedMin, mRedMax;
+        F32                     mGreenMin, mGreenMax;
+        F32                     mBlueMin, mBlueMax;
+        F32                     mAlphaMin, mAlphaMax;
+        F32                     mAlphaScale;
+    };
+
+    /// Life field samples for a batch, indexed from the start of the batch.
+    struct LifeSamples
+    {
+        F32                     mSizeX[BATCH_SIZE];
+        F32                     mSizeY[BATCH_SIZE];
+        F32                     mSpeed[BATCH_SIZE];
+        F32                     mFixedForce[BATCH_SIZE];
+        F32                     mRandomMotion[BATCH_SIZE];
+        F32                     mRed[BATCH_SIZE];
+        F32                     mGreen[BATCH_SIZE];
+        F32                     mBlue[BATCH_SIZE];
+        F32                     mAlpha[BATCH_SIZE];
+    };
+
+private:
+    static InstructionSet       smInstructionSet;
+
+public:
+    /// Instruction set.
+    static InstructionSet getBestInstructionSet( void );
+    static bool setInstructionSet( const InstructionSet instructionSet );
+    static inline InstructionSet getInstructionSet( void ) { return smInstructionSet; }
+    static const char* getInstructionSetDescription( const InstructionSet instructionSet );
+
+    /// Stage #1: Copy the tick position and scale the render properties by the life samples.
+    static void integrateProperties( ParticleSystem::ParticleStore& particleStore, const LifeSamples& lifeSamples, const Parameters& parameters, const U32 startIndex, const U32 count );
+
+    /// Stage #2: Apply the fixed force and integrate the position (random motion must already be applied to the velocity).
+    static void integrateMotion( ParticleSystem::ParticleStore& particleStore, const Parameters& parameters, const U32 startIndex, const U32 count );
+
+    /// Stage #3: Calculate the world OOBB (rotation must already be calculated) and set the post-tick position.
+    static void integrateBounds( ParticleSystem::ParticleStore& particleStore, const Parameters& parameters, const U32 startIndex, const U32 count );
+};
+
+#endif // _PARTICLE_INTEGRATOR_H_
@@ -28,6 +28,200 @@ ParticleSystem* ParticleSystem::Instance = NULL;
 
 //------------------------------------------------------------------------------
 
+ParticleSystem::ParticleStore::ParticleStore() :
+    mFrameProviders( NULL ),
+    mCount( 0 ),
+    mCapacity( 0 ),
+    mpStreamBlock( NULL )
+{
+    // Reset the streams.
+    F32** pStreams[STREAM_COUNT];
+    getStreams( pStreams );
+    for ( U32 n = 0; n < STREAM_COUNT; ++n )
+        *pStreams[n] = NULL;
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleStore::~ParticleStore()
+{
+    // Free all the particles.
+    freeAllParticles();
+
+    // Free the streams.
+    if ( mpStreamBlock != NULL )
+        dFree( mpStreamBlock );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::getStreams( F32** pStreams[STREAM_COUNT] )
+{
+    U32 n = 0;
+    pStreams[n++] = &mParticleLifetime;
+    pStreams[n++] = &mParticleAge;
+    pStreams[n++] = &mPositionX;
+    pStreams[n++] = &mPositionY;
+    pStreams[n++] = &mVelocityX;
+    pStreams[n++] = &mVelocityY;
+    pStreams[n++] = &mOrientationAngle;
+    pStreams[n++] = &mRotationSin;
+    pStreams[n++] = &mRotationCos;
+    pStreams[n++] = &mRenderSizeX;
+    pStreams[n++] = &mRenderSizeY;
+    pStreams[n++] = &mRenderSpeed;
+    pStreams[n++] = &mRenderFixedForce;
+    pStreams[n++] = &mRenderRandomMotion;
+    for ( U32 corner = 0; corner < 4; ++corner )
+    {
+        pStreams[n++] = &mRenderOOBBX[corner];
+        pStreams[n++] = &mRenderOOBBY[corner];
+    }
+    pStreams[n++] = &mSizeX;
+    pStreams[n++] = &mSizeY;
+    pStreams[n++] = &mSpeed;
+    pStreams[n++] = &mSpin;
+    pStreams[n++] = &mFixedForce;
+    pStreams[n++] = &mRandomMotion;
+    pStreams[n++] = &mColorRed;
+    pStreams[n++] = &mColorGreen;
+    pStreams[n++] = &mColorBlue;
+    pStreams[n++] = &mColorAlpha;
+    pStreams[n++] = &mPreTickPositionX;
+    pStreams[n++] = &mPreTickPositionY;
+    pStreams[n++] = &mPostTickPositionX;
+    pStreams[n++] = &mPostTickPositionY;
+
+    // Sanity!
+    AssertFatal( n == STREAM_COUNT, "ParticleSystem::ParticleStore::getStreams() - Stream count mismatch." );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::reserve( const U32 capacity )
+{
+    // Finish if we've already the capacity.
+    if ( capacity <= mCapacity )
+        return;
+
+    // Calculate the new capacity rounding so that each stream starts aligned.
+    U32 newCapacity = getMax( getMax( capacity, mCapacity * 2 ), (U32)MINIMUM_CAPACITY );
+    newCapacity = (newCapacity + CAPACITY_GRANULARITY - 1) & ~(CAPACITY_GRANULARITY - 1);
+
+    // Allocate a single block for all the streams.
+    const dsize_t streamSize = newCapacity * sizeof(F32);
+    void* pNewStreamBlock = dMalloc( (streamSize * STREAM_COUNT) + (newCapacity * sizeof(FrameProviderNode*)) + STREAM_ALIGNMENT );
+    U8* pStreamBase = (U8*)( ((uintptr_t)pNewStreamBlock + (STREAM_ALIGNMENT - 1)) & ~(uintptr_t)(STREAM_ALIGNMENT - 1) );
+
+    // Move the streams into the new block.
+    F32** pStreams[STREAM_COUNT];
+    getStreams( pStreams );
+    for ( U32 n = 0; n < STREAM_COUNT; ++n )
+    {
+        F32* pNewStream = (F32*)(pStreamBase + (streamSize * n));
+
+        if ( mCount > 0 )
+            dMemcpy( pNewStream, *pStreams[n], mCount * sizeof(F32) );
+
+        *pStreams[n] = pNewStream;
+    }
+
+    // Move the frame providers into the new block.
+    FrameProviderNode** pNewFrameProviders = (FrameProviderNode**)(pStreamBase + (streamSize * STREAM_COUNT));
+    if ( mCount > 0 )
+        dMemcpy( pNewFrameProviders, mFrameProviders, mCount * sizeof(FrameProviderNode*) );
+    mFrameProviders = pNewFrameProviders;
+
+    // Free the old block.
+    if ( mpStreamBlock != NULL )
+        dFree( mpStreamBlock );
+
+    mpStreamBlock = pNewStreamBlock;
+    mCapacity = newCapacity;
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleStore::createParticle( void )
+{
+    // Ensure we've space for the particle.
+    reserve( mCount + 1 );
+
+    // Allocate the frame provider.
+    mFrameProviders[mCount] = ParticleSystem::Instance->createFrameProvider();
+
+    // Append the particle (newest last).
+    return mCount++;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::freeParticles( const U32* pParticleIndices, const U32 particleIndexCount )
+{
+    // Finish if nothing to free.
+    if ( particleIndexCount == 0 )
+        return;
+
+    // Sanity!
+    AssertFatal( pParticleIndices != NULL, "ParticleSystem::ParticleStore::freeParticles() - Invalid particle indices." );
+
+    // Free the frame providers.
+    for ( U32 n = 0; n < particleIndexCount; ++n )
+    {
+        // Sanity!
+        AssertFatal( pParticleIndices[n] < mCount, "ParticleSystem::ParticleStore::freeParticles() - Particle index out of range." );
+        AssertFatal( n == 0 || pParticleIndices[n] > pParticleIndices[n-1], "ParticleSystem::ParticleStore::freeParticles() - Particle indices must be ascending." );
+
+        ParticleSystem::Instance->freeFrameProvider( mFrameProviders[pParticleIndices[n]] );
+    }
+
+    // Fetch the streams.
+    F32** pStreams[STREAM_COUNT];
+    getStreams( pStreams );
+
+    // Compact each run of surviving particles down.
+    // NOTE:    The compaction is stable so the particle age order is preserved.
+    U32 writeIndex = pParticleIndices[0];
+    for ( U32 n = 0; n < particleIndexCount; ++n )
+    {
+        // Calculate the surviving run after the freed particle.
+        const U32 runStart = pParticleIndices[n] + 1;
+        const U32 runEnd = (n + 1) < particleIndexCount ? pParticleIndices[n+1] : mCount;
+        const U32 runCount = runEnd - runStart;
+
+        // Skip an empty run.
+        if ( runCount == 0 )
+            continue;
+
+        // Move the run.
+        for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+        {
+            F32* pStream = *pStreams[stream];
+            dMemmove( pStream + writeIndex, pStream + runStart, runCount * sizeof(F32) );
+        }
+        dMemmove( mFrameProviders + writeIndex, mFrameProviders + runStart, runCount * sizeof(FrameProviderNode*) );
+
+        writeIndex += runCount;
+    }
+
+    // Set the new count.
+    mCount -= particleIndexCount;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::freeAllParticles( void )
+{
+    // Free the frame providers.
+    for ( U32 n = 0; n < mCount; ++n )
+        ParticleSystem::Instance->freeFrameProvider( mFrameProviders[n] );
+
+    // Reset the count.
+    mCount = 0;
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleSystem::Init( void )
 {
     // Create the particle system.
@@ -46,10 +240,10 @@ void ParticleSystem::destroy( void )
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+                    mFrameProviderPoolBlockSize(512)
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    // Reset the free frame provider head.
+    mpFreeFrameProviderNodes = NULL;
 
     // Reset the active particle count.
     mActiveParticleCount = 0;
@@ -59,76 +253,72 @@ ParticleSystem::ParticleSystem() :
 
 ParticleSystem::~ParticleSystem()
 {
-    // Destroy all the particle pool blocks.
-    for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
+    // Destroy all the frame provider pool blocks.
+    for ( U32 n = 0; n < (U32)mFrameProviderPool.size(); n++ )
+        delete [] mFrameProviderPool[n];
 
-    // Clear the particle pool.
-    mParticlePool.clear();
+    // Clear the frame provider pool.
+    mFrameProviderPool.clear();
 
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    // Reset the free frame provider head.
+    mpFreeFrameProviderNodes = NULL;
 }
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
+ParticleSystem::FrameProviderNode* ParticleSystem::createFrameProvider( void )
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    // Have we got any free frame provider nodes?
+    if ( mpFreeFrameProviderNodes == NULL )
     {
         // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+        FrameProviderNode* pFreePoolBlock = new FrameProviderNode[mFrameProviderPoolBlockSize];
 
         // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
+        mFrameProviderPool.push_back( pFreePoolBlock );
 
         // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
+        for ( U32 n = 0; n < (mFrameProviderPoolBlockSize-1); n++ )
         {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
+            pFreePoolBlock[n].mNextFreeNode = pFreePoolBlock+n+1;
         }
 
         // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+        pFreePoolBlock[mFrameProviderPoolBlockSize-1].mNextFreeNode = mpFreeFrameProviderNodes;
 
         // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
+        mpFreeFrameProviderNodes = pFreePoolBlock;
     }
 
     // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+    FrameProviderNode* pFreeFrameProviderNode = mpFreeFrameProviderNodes;
 
     // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
+    mpFreeFrameProviderNodes = mpFreeFrameProviderNodes->mNextFreeNode;
 
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+    // Reset the free node reference.
+    pFreeFrameProviderNode->mNextFreeNode = NULL;
 
     // Increase the active particle count.
     mActiveParticleCount++;
 
-    return pFreeParticleNode;
+    return pFreeFrameProviderNode;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
+void ParticleSystem::freeFrameProvider( FrameProviderNode* pFrameProviderNode )
 {
-    // Reset the particle.
-    pParticleNode->resetState();
+    // Deallocate the assets.
+    pFrameProviderNode->mFrameProvider.deallocateAssets();
+
+    // Reset the frame provider.
+    pFrameProviderNode->resetState();
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
     // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+    pFrameProviderNode->mNextFreeNode = mpFreeFrameProviderNodes;
+    mpFreeFrameProviderNodes = pFrameProviderNode;
 
     // Decrease the active particle count.
     mActiveParticleCount--;
 }
-
@@ -32,64 +32,103 @@
 class ParticleSystem
 {
 public:
-    /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
+    /// Particle frame provider node.
+    struct FrameProviderNode : public IFactoryObjectReset
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
+        /// Free node linkage.
+        FrameProviderNode*      mNextFreeNode;
 
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
+        /// Frame provider.
+        ImageFrameProviderCore  mFrameProvider;
+
+        FrameProviderNode() : mNextFreeNode( NULL ) {}
 
+        virtual void resetState( void )
+        {
+            mFrameProvider.resetState();
+        }
+    };
+
+    /// Particle store.
+    /// NOTE:   Particles are stored as a structure-of-arrays, oldest particle first, so that
+    ///         integration and rendering stream linearly through memory.
+    class ParticleStore
+    {
+    public:
         /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
-        ImageFrameProviderCore  mFrameProvider;
+        F32*                    mParticleLifetime;
+        F32*                    mParticleAge;
+        F32*                    mPositionX;
+        F32*                    mPositionY;
+        F32*                    mVelocityX;
+        F32*                    mVelocityY;
+        F32*                    mOrientationAngle;
+        F32*                    mRotationSin;
+        F32*                    mRotationCos;
 
         /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
+        F32*                    mRenderSizeX;
+        F32*                    mRenderSizeY;
+        F32*                    mRenderSpeed;
+        F32*                    mRenderFixedForce;
+        F32*                    mRenderRandomMotion;
+        F32*                    mRenderOOBBX[4];
+        F32*                    mRenderOOBBY[4];
 
         /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
-
-        /// Physics particles
-        bool                    mPhysicsParticles;
-        b2ParticleGroupDef      mParticleGroup;
-        b2ParticleSystem*       mParticleSystem;
+        F32*                    mSizeX;
+        F32*                    mSizeY;
+        F32*                    mSpeed;
+        F32*                    mSpin;
+        F32*                    mFixedForce;
+        F32*                    mRandomMotion;
+        F32*                    mColorRed;
+        F32*                    mColorGreen;
+        F32*                    mColorBlue;
+        F32*                    mColorAlpha;
 
         /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
+        F32*                    mPreTickPositionX;
+        F32*                    mPreTickPositionY;
+        F32*                    mPostTickPositionX;
+        F32*                    mPostTickPositionY;
 
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
+        /// Frame providers.
+        FrameProviderNode**     mFrameProviders;
 
-        virtual void resetState( void )
+    private:
+        enum
         {
-            mFrameProvider.resetState();
-        }
+            STREAM_COUNT        = 36,
+            STREAM_ALIGNMENT    = 32,
+            CAPACITY_GRANULARITY= STREAM_ALIGNMENT / sizeof(F32),
+            MINIMUM_CAPACITY    = 64
+        };
+
+        U32                     mCount;
+        U32                     mCapacity;
+        void*                   mpStreamBlock;
+
+        void reserve( const U32 capacity );
+        void getStreams( F32** pStreams[STREAM_COUNT] );
+
+    public:
+        ParticleStore();
+        ~ParticleStore();
+
+        inline U32 getCount( void ) const { return mCount; }
+        inline U32 getCapacity( void ) const { return mCapacity; }
+
+        U32 createParticle( void );
+        void freeParticles( const U32* pParticleIndices, const U32 particleIndexCount );
+        void freeAllParticles( void );
     };
 
 private:
-    const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
-    U32                     mActiveParticleCount;
+    const U32                   mFrameProviderPoolBlockSize;
+    Vector<FrameProviderNode*>  mFrameProviderPool;
+    FrameProviderNode*          mpFreeFrameProviderNodes;
+    U32                         mActiveParticleCount;
 
 public:
     static void Init( void );
@@ -99,11 +138,11 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
-    ParticleNode* createParticle( void );
-    void freeParticle( ParticleNode* pParticleNode );
+    FrameProviderNode* createFrameProvider( void );
+    void freeFrameProvider( FrameProviderNode* pFrameProviderNode );
 
     inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
-    inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+    inline U32 getAllocatedParticleCount( void ) const { return (U32)mFrameProviderPool.size() * mFrameProviderPoolBlockSize; }
 };
 
 #endif // _PARTICLE_SYSTEM_H_
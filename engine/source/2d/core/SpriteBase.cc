@@ -73,6 +73,18 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
 
 //------------------------------------------------------------------------------
 
+bool SpriteBase::getConcurrentTickAllowed( const Scene::TickStage tickStage ) const
+{
+    // Finish if the parent does not allow it.
+    if ( !Parent::getConcurrentTickAllowed( tickStage ) )
+        return false;
+
+    // Updating the image frame provider can perform animation callbacks.
+    return tickStage != Scene::TICK_STAGE_INTEGRATE || ImageFrameProvider::isUpdateIsolated();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBase::validRender( void ) const
 {
     return ImageFrameProvider::validRender();
@@ -44,6 +44,7 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool getConcurrentTickAllowed( const Scene::TickStage tickStage ) const;
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
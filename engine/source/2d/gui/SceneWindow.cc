@@ -2066,7 +2066,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 19.25f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -2106,12 +2106,23 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     {
         // Rendering.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Render", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>, %sConcurrent=%d<%d>",
             debugStats.fps, debugStats.minFPS, debugStats.maxFPS,
             debugStats.frameCount,
             debugStats.renderPicked, debugStats.maxRenderPicked,
             debugStats.renderRequests, debugStats.maxRenderRequests,
-            debugStats.renderFallbacks, debugStats.maxRenderFallbacks );
+            debugStats.renderFallbacks, debugStats.maxRenderFallbacks,
+            pScene->getConcurrentRender() ? "" : "(OFF) ",
+            debugStats.renderConcurrentRequests, debugStats.maxRenderConcurrentRequests );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // Render layers.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Layers", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Reused=%d<%d>, IncrementallySorted=%d<%d>, FullySorted=%d<%d>",
+            debugStats.renderLayersReused, debugStats.maxRenderLayersReused,
+            debugStats.renderLayersIncrementallySorted, debugStats.maxRenderLayersIncrementallySorted,
+            debugStats.renderLayersFullySorted, debugStats.maxRenderLayersFullySorted );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
@@ -2157,13 +2168,15 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
 
         // Batching #1.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Batching", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- %sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>, %sAtlas=%d<%d>",
             pScene->getBatchingEnabled() ? "" : "(OFF) ",
             debugStats.batchTrianglesSubmitted, debugStats.maxBatchTrianglesSubmitted,
             debugStats.batchMaxTriangleDrawn,
             debugStats.batchMaxVertexBuffer,
             debugStats.batchDrawCallsStrict, debugStats.maxBatchDrawCallsStrict,
-            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted                   
+            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted,
+            pScene->getBatchAtlasEnabled() ? "" : "(OFF) ",
+            debugStats.batchAtlasRemaps, debugStats.maxBatchAtlasRemaps
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -2233,6 +2246,18 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Ticking.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Ticking", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sPre=%0.2f<%0.2f>, Integrate=%0.2f<%0.2f>, Post=%0.2f<%0.2f>, Concurrent=%d<%d>, Deferred=%d<%d>",
+            pScene->getConcurrentTick() ? "" : "(OFF) ",
+            debugStats.tickPreIntegrateTime, debugStats.maxTickPreIntegrateTime,
+            debugStats.tickIntegrateTime, debugStats.maxTickIntegrateTime,
+            debugStats.tickPostIntegrateTime, debugStats.maxTickPostIntegrateTime,
+            debugStats.tickConcurrentObjects, debugStats.maxTickConcurrentObjects,
+            debugStats.tickDeferredObjects, debugStats.maxTickDeferredObjects );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Physics spatial tree.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Partition", NULL );
         const b2World* pWorld = pScene->getWorld();
@@ -78,6 +78,12 @@ public:
         if ( renderPicked > maxRenderPicked ) maxRenderPicked = renderPicked;
         if ( renderRequests > maxRenderRequests ) maxRenderRequests = renderRequests;
         if ( renderFallbacks > maxRenderFallbacks ) maxRenderFallbacks = renderFallbacks;
+        if ( renderConcurrentRequests > maxRenderConcurrentRequests ) maxRenderConcurrentRequests = renderConcurrentRequests;
+
+        // Render layer caching.
+        if ( renderLayersReused > maxRenderLayersReused ) maxRenderLayersReused = renderLayersReused;
+        if ( renderLayersIncrementallySorted > maxRenderLayersIncrementallySorted ) maxRenderLayersIncrementallySorted = renderLayersIncrementallySorted;
+        if ( renderLayersFullySorted > maxRenderLayersFullySorted ) maxRenderLayersFullySorted = renderLayersFullySorted;
 
         // Batching.
         if ( batchTrianglesSubmitted > maxBatchTrianglesSubmitted ) maxBatchTrianglesSubmitted = batchTrianglesSubmitted;
@@ -93,10 +99,18 @@ public:
         if ( batchLayerFlush > maxBatchLayerFlush ) maxBatchLayerFlush = batchLayerFlush;
         if ( batchNoBatchFlush > maxBatchNoBatchFlush ) maxBatchNoBatchFlush = batchNoBatchFlush;
         if ( batchAnonymousFlush > maxBatchAnonymousFlush ) maxBatchAnonymousFlush = batchAnonymousFlush;
+        if ( batchAtlasRemaps > maxBatchAtlasRemaps ) maxBatchAtlasRemaps = batchAtlasRemaps;
 
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
 
+        // Tick stages.
+        if ( tickPreIntegrateTime > maxTickPreIntegrateTime ) maxTickPreIntegrateTime = tickPreIntegrateTime;
+        if ( tickIntegrateTime > maxTickIntegrateTime ) maxTickIntegrateTime = tickIntegrateTime;
+        if ( tickPostIntegrateTime > maxTickPostIntegrateTime ) maxTickPostIntegrateTime = tickPostIntegrateTime;
+        if ( tickConcurrentObjects > maxTickConcurrentObjects ) maxTickConcurrentObjects = tickConcurrentObjects;
+        if ( tickDeferredObjects > maxTickDeferredObjects ) maxTickDeferredObjects = tickDeferredObjects;
+
         // World profile.
         if ( worldProfile.step > maxWorldProfile.step ) maxWorldProfile.step = worldProfile.step;
         if ( worldProfile.collide > maxWorldProfile.collide ) maxWorldProfile.collide = worldProfile.collide;
@@ -132,6 +146,18 @@ public:
         renderFallbacks = 0;
         maxRenderFallbacks = 0;
 
+        renderConcurrentRequests = 0;
+        maxRenderConcurrentRequests = 0;
+
+        renderLayersReused = 0;
+        maxRenderLayersReused = 0;
+
+        renderLayersIncrementallySorted = 0;
+        maxRenderLayersIncrementallySorted = 0;
+
+        renderLayersFullySorted = 0;
+        maxRenderLayersFullySorted = 0;
+
         bodyCount = 0;
         maxBodyCount = 0;
 
@@ -186,11 +212,29 @@ public:
         batchAnonymousFlush = 0;
         maxBatchAnonymousFlush = 0;
 
+        batchAtlasRemaps = 0;
+        maxBatchAtlasRemaps = 0;
+
         particlesAlloc = 0;
         particlesFree = 0;
         particlesUsed = 0;
         maxParticlesUsed = 0;
 
+        tickPreIntegrateTime = 0.0f;
+        maxTickPreIntegrateTime = 0.0f;
+
+        tickIntegrateTime = 0.0f;
+        maxTickIntegrateTime = 0.0f;
+
+        tickPostIntegrateTime = 0.0f;
+        maxTickPostIntegrateTime = 0.0f;
+
+        tickConcurrentObjects = 0;
+        maxTickConcurrentObjects = 0;
+
+        tickDeferredObjects = 0;
+        maxTickDeferredObjects = 0;
+
         fps = 0.0f;
         minFPS = 10000.0f;
         maxFPS = 0.0f;
@@ -222,6 +266,18 @@ public:
     U32     renderFallbacks;
     U32     maxRenderFallbacks;
 
+    U32     renderConcurrentRequests;
+    U32     maxRenderConcurrentRequests;
+
+    U32     renderLayersReused;
+    U32     maxRenderLayersReused;
+
+    U32     renderLayersIncrementallySorted;
+    U32     maxRenderLayersIncrementallySorted;
+
+    U32     renderLayersFullySorted;
+    U32     maxRenderLayersFullySorted;
+
     U32     bodyCount;
     U32     maxBodyCount;
 
@@ -276,11 +332,29 @@ public:
     U32     batchAnonymousFlush;
     U32     maxBatchAnonymousFlush;
 
+    U32     batchAtlasRemaps;
+    U32     maxBatchAtlasRemaps;
+
     U32     particlesAlloc;
     U32     particlesFree;
     U32     particlesUsed;
     U32     maxParticlesUsed;
 
+    F32     tickPreIntegrateTime;
+    F32     maxTickPreIntegrateTime;
+
+    F32     tickIntegrateTime;
+    F32     maxTickIntegrateTime;
+
+    F32     tickPostIntegrateTime;
+    F32     maxTickPostIntegrateTime;
+
+    U32     tickConcurrentObjects;
+    U32     maxTickConcurrentObjects;
+
+    U32     tickDeferredObjects;
+    U32     maxTickDeferredObjects;
+
     F32     fps;
     F32     minFPS;
     F32     maxFPS;
@@ -56,6 +56,14 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
+#ifndef _PLATFORM_TIMER_H_
+#include "platform/platformTimer.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -74,6 +82,13 @@ static ContactFilter mContactFilter;
 static U32 sSceneCount = 0;
 static U32 sSceneMasterIndex = 0;
 
+// Concurrent tick chunk size.
+static const U32 sConcurrentTickChunkSize = 64;
+
+// Concurrent render chunk size and the minimum eligible render requests in a layer to render it concurrently.
+static const U32 sConcurrentRenderChunkSize = 32;
+static const U32 sConcurrentRenderMinimumRequests = 128;
+
 // Joint custom node names.
 static StringTableEntry jointCustomNodeName               = StringTable->insert( "Joints" );
 static StringTableEntry jointCollideConnectedName         = StringTable->insert( "CollideConnected" );
@@ -153,6 +168,11 @@ Scene::Scene() :
     mVelocityIterations(8),
     mPositionIterations(3),
 
+    /// Concurrent ticking.
+    mConcurrentTick(false),
+    mConcurrentTickActive(false),
+    mConcurrentTickStage(TICK_STAGE_PREINTEGRATE),
+
     /// Joint access.
     mJointMasterId(1),
 
@@ -164,6 +184,14 @@ Scene::Scene() :
     mDebugMask(0X00000000),
     mpDebugSceneObject(NULL),
 
+    /// Layer render caching.
+    mLayerRenderCacheStamp(0),
+
+    /// Concurrent rendering.
+    mConcurrentRender(false),
+    mpConcurrentRenderState(NULL),
+    mpConcurrentRenderQueue(NULL),
+
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
     
@@ -171,19 +199,39 @@ Scene::Scene() :
     mIsEditorScene(0),
     mUpdateCallback(false),
     mRenderCallback(false),
-    mSceneIndex(0)
+    mSceneIndex(0),
+
+    /// Contact batches.
+    mBatchContactCallback(false)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mConcurrentTickObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
     VECTOR_SET_ASSOCIATION( mEndContacts );
+    VECTOR_SET_ASSOCIATION( mTickBeginContacts );
+    VECTOR_SET_ASSOCIATION( mTickEndContacts );
+    VECTOR_SET_ASSOCIATION( mContactListeners );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
+    VECTOR_SET_ASSOCIATION( mLayerRenderOrder );
+    VECTOR_SET_ASSOCIATION( mConcurrentRenderRanges );
+
+    // Initialize concurrent renderers.
+    // NOTE:    These are created on demand.
+    for ( U32 n = 0; n < JobScheduler::MAX_PARTICIPANTS; ++n )
+        mpConcurrentRenderers[n] = NULL;
      
     // Initialize layer sort mode.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
        mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
 
+    // Initialize layer render caches.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+       mLayerRenderCaches[n].mpRenderQueue = NULL;
+    releaseLayerRenderCaches();
+
     // Set debug stats for batch renderer.
     mBatchRenderer.setDebugStats( &mDebugStats );
 
@@ -200,6 +248,16 @@ Scene::Scene() :
 
 Scene::~Scene()
 {
+    // Release layer render caches.
+    releaseLayerRenderCaches();
+
+    // Destroy concurrent renderers.
+    for ( U32 n = 0; n < JobScheduler::MAX_PARTICIPANTS; ++n )
+    {
+        delete mpConcurrentRenderers[n];
+        mpConcurrentRenderers[n] = NULL;
+    }
+
     // Unregister the scene controllers set.
     if ( mControllers.notNull() )
         mControllers->deleteObject();
@@ -263,6 +321,9 @@ void Scene::onRemove()
     // Process Delete Requests.
     processDeleteRequests(true);
 
+    // Release layer render caches.
+    releaseLayerRenderCaches();
+
     // Delete ground body.
     mpWorld->DestroyBody( mpGroundBody );
     mpGroundBody = NULL;
@@ -323,6 +384,13 @@ void Scene::initPersistFields()
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+    addField("BatchContactCallback", TypeBool, Offset(mBatchContactCallback, Scene), &writeBatchContactCallback, "Whether contacts are delivered to script once per tick with 'onSceneContacts' instead of per-contact collision callbacks.");
+
+    // Integration.
+    addField("ConcurrentTick", TypeBool, Offset(mConcurrentTick, Scene), &writeConcurrentTick, "Whether eligible scene objects are integrated concurrently on the job scheduler or not.");
+
+    // Render output.
+    addField("ConcurrentRender", TypeBool, Offset(mConcurrentRender, Scene), &writeConcurrentRender, "Whether eligible render requests are recorded concurrently on the job scheduler or not.");
 }
 
 //-----------------------------------------------------------------------------
@@ -449,22 +517,48 @@ void Scene::forwardContacts( void )
 
 //-----------------------------------------------------------------------------
 
-void Scene::dispatchBeginContactCallbacks( void )
+void Scene::gatherTickContacts( void )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchBeginContactCallbacks);
+    PROFILE_SCOPE(Scene_GatherTickContacts);
 
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchBeginContactCallbacks() - Invalid assumption about max manifold points." );
+    // Clear the tick contacts.
+    mTickBeginContacts.clear();
+    mTickEndContacts.clear();
 
-    // Fetch contact count.
-    const U32 contactCount = mBeginContacts.size();
+    // Gather end contacts.
+    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    {
+        // Fetch contact.
+        const TickContact& tickContact = *contactItr;
 
-    // Finish if no contacts.
-    if ( contactCount == 0 )
-        return;
+        // Fetch scene objects.
+        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
 
-    // Iterate all contacts.
+        // Skip if either object is being deleted.
+        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+            continue;
+
+        // Skip if both objects don't have collision callback active.
+        if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
+            continue;
+
+        // Add the scene contact.
+        mTickEndContacts.increment();
+        SceneContact& sceneContact = mTickEndContacts.last();
+        static_cast<TickContact&>(sceneContact) = tickContact;
+        sceneContact.mSceneObjectIdA = pSceneObjectA->getId();
+        sceneContact.mSceneObjectIdB = pSceneObjectB->getId();
+        sceneContact.mShapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        sceneContact.mShapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+        // Sanity!
+        AssertFatal( sceneContact.mShapeIndexA >= 0, "Scene::gatherTickContacts() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( sceneContact.mShapeIndexB >= 0, "Scene::gatherTickContacts() - Cannot find shape index reported on physics proxy of a fixture." );
+    }
+
+    // Gather begin contacts.
     for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
     {
         // Fetch contact.
@@ -482,89 +576,198 @@ void Scene::dispatchBeginContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+        // Add the scene contact.
+        mTickBeginContacts.increment();
+        SceneContact& sceneContact = mTickBeginContacts.last();
+        static_cast<TickContact&>(sceneContact) = tickContact;
+        sceneContact.mSceneObjectIdA = pSceneObjectA->getId();
+        sceneContact.mSceneObjectIdB = pSceneObjectB->getId();
+        sceneContact.mShapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        sceneContact.mShapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
 
         // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( sceneContact.mShapeIndexA >= 0, "Scene::gatherTickContacts() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( sceneContact.mShapeIndexB >= 0, "Scene::gatherTickContacts() - Cannot find shape index reported on physics proxy of a fixture." );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContacts( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchContacts);
+
+    // Gather the tick contacts.
+    gatherTickContacts();
+
+    const U32 beginContactCount = mTickBeginContacts.size();
+    const U32 endContactCount = mTickEndContacts.size();
+
+    // Finish if no contacts.
+    if ( beginContactCount == 0 && endContactCount == 0 )
+        return;
+
+    // Inform the contact listeners.
+    for ( U32 n = 0; n < (U32)mContactListeners.size(); ++n )
+    {
+        mContactListeners[n]->onSceneContacts(
+            this,
+            mTickBeginContacts.address(), beginContactCount,
+            mTickEndContacts.address(), endContactCount );
+    }
+
+    // Are we batching the contact callback?
+    if ( mBatchContactCallback )
+    {
+        // Yes, so does the scene handle the contacts callback?
+        if ( isMethod( "onSceneContacts" ) )
+        {
+            // Yes, so perform script callback on the Scene.
+            // NOTE:    The contacts are fetched with "getBeginContact" and "getEndContact".
+            char beginCountBuffer[16];
+            char endCountBuffer[16];
+            dSprintf( beginCountBuffer, sizeof(beginCountBuffer), "%d", beginContactCount );
+            dSprintf( endCountBuffer, sizeof(endCountBuffer), "%d", endContactCount );
+            Con::executef( this, 3, "onSceneContacts", beginCountBuffer, endCountBuffer );
+        }
+        return;
+    }
+
+    // Dispatch the per-contact callbacks.
+    dispatchEndContactCallbacks();
+    dispatchBeginContactCallbacks();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::formatContactInfo( const SceneContact& sceneContact, const bool beginContact, const bool swapObjects, char* pBuffer, const U32 bufferSize )
+{
+    // Sanity!
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::formatContactInfo() - Invalid assumption about max manifold points." );
+
+    // Fetch shape indices so the object can see things from its point of view.
+    const S32 shapeIndexA = swapObjects ? sceneContact.mShapeIndexB : sceneContact.mShapeIndexA;
+    const S32 shapeIndexB = swapObjects ? sceneContact.mShapeIndexA : sceneContact.mShapeIndexB;
+
+    // Fetch the point count.
+    const U32 pointCount = beginContact ? sceneContact.mPointCount : 0;
 
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
+    // Fetch normal and contact points.
+    const b2Vec2& normal = sceneContact.mWorldManifold.normal;
+    const b2Vec2& point1 = sceneContact.mWorldManifold.points[0];
+    const b2Vec2& point2 = sceneContact.mWorldManifold.points[1];
+    const F32 normalX = swapObjects ? normal.x : -normal.x;
+    const F32 normalY = swapObjects ? normal.y : -normal.y;
+
+    if ( pointCount == 2 )
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            normalX, normalY,
+            point1.x, point1.y,
+            sceneContact.mNormalImpulses[0],
+            sceneContact.mTangentImpulses[0],
+            point2.x, point2.y,
+            sceneContact.mNormalImpulses[1],
+            sceneContact.mTangentImpulses[1] );
+    }
+    else if ( pointCount == 1 )
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            normalX, normalY,
+            point1.x, point1.y,
+            sceneContact.mNormalImpulses[0],
+            sceneContact.mTangentImpulses[0] );
+    }
+    else
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d",
+            shapeIndexA, shapeIndexB );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addContactListener( SceneContactListener* pContactListener )
+{
+    // Sanity!
+    AssertFatal( pContactListener != NULL, "Scene::addContactListener() - Cannot add a NULL contact listener." );
+
+    // Ignore if already added.
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr == pContactListener )
+            return;
+    }
+
+    mContactListeners.push_back( pContactListener );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeContactListener( SceneContactListener* pContactListener )
+{
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr == pContactListener )
+        {
+            mContactListeners.erase( listenerItr );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchBeginContactCallbacks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchBeginContactCallbacks);
+
+    // Fetch contact count.
+    const U32 contactCount = mTickBeginContacts.size();
+
+    // Finish if no contacts.
+    if ( contactCount == 0 )
+        return;
+
+    // Fetch the scene collision callback.
+    Namespace* pNamespace = getNamespace();
+    const bool sceneCollisionCallback = pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL;
+
+    // Iterate all contacts.
+    for ( U32 contactIndex = 0; contactIndex < contactCount; ++contactIndex )
+    {
+        // Fetch contact.
+        const SceneContact& sceneContact = mTickBeginContacts[contactIndex];
+
+        // Fetch scene objects.
+        SceneObject* pSceneObjectA = sceneContact.mpSceneObjectA;
+        SceneObject* pSceneObjectB = sceneContact.mpSceneObjectB;
+
+        // Skip if either object has been deleted by an earlier callback.
+        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+            continue;
 
         // Format objects.
         char sceneObjectABuffer[16];
         char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", sceneContact.mSceneObjectIdA );
+        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", sceneContact.mSceneObjectIdB );
 
         // Format miscellaneous information twice so object b can see things from his point of view.
         char miscInfoBufferA[128];
         char miscInfoBufferB[128];
-        if ( pointCount == 2 )
-        {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                -normal.x, -normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-               shapeIndexB, shapeIndexA,
-               normal.x, normal.y,
-               point1.x, point1.y,
-               normalImpulse1,
-               tangentImpulse1,
-               point2.x, point2.y,
-               normalImpulse2,
-               tangentImpulse2);
-        }
-        else if ( pointCount == 1 )
-        {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                -normal.x, -normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-               shapeIndexB, shapeIndexA,
-               normal.x, normal.y,
-               point1.x, point1.y,
-               normalImpulse1,
-               tangentImpulse1);
-        }
-        else
-        {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d",
-               shapeIndexB, shapeIndexA);
-        }
+        formatContactInfo( sceneContact, true, false, miscInfoBufferA, sizeof(miscInfoBufferA) );
+        formatContactInfo( sceneContact, true, true, miscInfoBufferB, sizeof(miscInfoBufferB) );
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
+        if ( sceneCollisionCallback )
         {
             // Yes, so perform script callback on the Scene.
             Con::executef( this, 4, "onSceneCollision",
@@ -628,55 +831,43 @@ void Scene::dispatchEndContactCallbacks( void )
     // Debug Profiling.
     PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
 
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
-
     // Fetch contact count.
-    const U32 contactCount = mEndContacts.size();
+    const U32 contactCount = mTickEndContacts.size();
 
     // Finish if no contacts.
     if ( contactCount == 0 )
         return;
 
+    // Fetch the scene collision callback.
+    Namespace* pNamespace = getNamespace();
+    const bool sceneEndCollisionCallback = pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL;
+
     // Iterate all contacts.
-    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    for ( U32 contactIndex = 0; contactIndex < contactCount; ++contactIndex )
     {
         // Fetch contact.
-        const TickContact& tickContact = *contactItr;
+        const SceneContact& sceneContact = mTickEndContacts[contactIndex];
 
         // Fetch scene objects.
-        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
-        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+        SceneObject* pSceneObjectA = sceneContact.mpSceneObjectA;
+        SceneObject* pSceneObjectB = sceneContact.mpSceneObjectB;
 
-        // Skip if either object is being deleted.
+        // Skip if either object has been deleted by an earlier callback.
         if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
             continue;
 
-        // Skip if both objects don't have collision callback active.
-        if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
-            continue;
-
-        // Fetch shape index.
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
-
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
         // Format objects.
         char sceneObjectABuffer[16];
         char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", sceneContact.mSceneObjectIdA );
+        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", sceneContact.mSceneObjectIdB );
 
         // Format miscellaneous information.
         char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+        formatContactInfo( sceneContact, false, false, miscInfoBuffer, sizeof(miscInfoBuffer) );
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
+        if ( sceneEndCollisionCallback )
         {
             // Yes, so does the scene handle the collision callback?
             Con::executef( this, 4, "onSceneEndCollision",
@@ -811,24 +1002,28 @@ void Scene::processTick( void )
         mDebugStats.objectsVisible = objectsVisible;
         mDebugStats.objectsAwake   = objectsAwake;
 
+        // Reset tick stats.
+        mDebugStats.tickConcurrentObjects = 0;
+        mDebugStats.tickDeferredObjects   = 0;
+
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
 
-        // Fetch ticked scene object count.
-        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+        // Tick stage timer.
+        PlatformTimer tickStageTimer;
 
         // ****************************************************
         // Pre-integrate objects.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PreIntegrate);
 
             // Pre-integrate.
-            mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            tickStageTimer.reset();
+            integrateTickStage( TICK_STAGE_PREINTEGRATE, pDebugStats );
+            mDebugStats.tickPreIntegrateTime = tickStageTimer.getElapsedMs();
         }
 
         // ****************************************************
@@ -886,28 +1081,28 @@ void Scene::processTick( void )
         // Integrate objects.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_IntegrateObject);
 
             // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+            tickStageTimer.reset();
+            integrateTickStage( TICK_STAGE_INTEGRATE, pDebugStats );
+            mDebugStats.tickIntegrateTime = tickStageTimer.getElapsedMs();
         }
 
         // ****************************************************
         // Post-Integrate Stage.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PostIntegrate);
 
             // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            tickStageTimer.reset();
+            integrateTickStage( TICK_STAGE_POSTINTEGRATE, pDebugStats );
+            mDebugStats.tickPostIntegrateTime = tickStageTimer.getElapsedMs();
         }
 
         // Scene update callback.
@@ -922,9 +1117,8 @@ void Scene::processTick( void )
         // Only dispatch contacts if a "normal" scene.
         if ( isNormalScene )
         {
-            // Dispatch contacts callbacks.
-            dispatchEndContactCallbacks();
-            dispatchBeginContactCallbacks();
+            // Dispatch contacts.
+            dispatchContacts();
         }
 
         // Clear ticked scene objects.
@@ -937,6 +1131,117 @@ void Scene::processTick( void )
 
 //-----------------------------------------------------------------------------
 
+static inline void integrateSceneObject( SceneObject* pSceneObject, const Scene::TickStage tickStage, const F32 totalTime, DebugStats* pDebugStats )
+{
+    switch( tickStage )
+    {
+        case Scene::TICK_STAGE_PREINTEGRATE:
+            pSceneObject->preIntegrate( totalTime, Tickable::smTickSec, pDebugStats );
+            break;
+
+        case Scene::TICK_STAGE_INTEGRATE:
+            pSceneObject->integrateObject( totalTime, Tickable::smTickSec, pDebugStats );
+            break;
+
+        case Scene::TICK_STAGE_POSTINTEGRATE:
+            pSceneObject->postIntegrate( totalTime, Tickable::smTickSec, pDebugStats );
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateTickStage( const TickStage tickStage, DebugStats* pDebugStats )
+{
+    // Fetch ticked scene object count.
+    const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+
+    // Fetch the job scheduler.
+    JobScheduler* pJobScheduler = JobScheduler::Instance;
+
+    // Are we ticking concurrently?
+    if ( !mConcurrentTick || pJobScheduler == NULL || pJobScheduler->getWorkerCount() == 0 )
+    {
+        // No, so iterate ticked scene objects.
+        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            integrateSceneObject( mTickedSceneObjects[i], tickStage, mSceneTime, pDebugStats );
+        }
+
+        return;
+    }
+
+    // Integrate each run of objects that can be integrated concurrently on the job scheduler and the objects
+    // that must be integrated on the main thread in between them, so every object ticks in the same order as a serial tick.
+    // NOTE:    Objects that perform script callbacks or touch the physics world must be integrated on the main thread.
+    mConcurrentTickStage = tickStage;
+    mConcurrentTickObjects.clear();
+    for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+    {
+        SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+        // Add to the current run if it can be integrated concurrently.
+        if ( pSceneObject->getConcurrentTickAllowed( tickStage ) )
+        {
+            mConcurrentTickObjects.push_back( pSceneObject );
+            continue;
+        }
+
+        // Finish the current run before integrating this object.
+        integrateConcurrentTickObjects( pJobScheduler, pDebugStats );
+
+        // Integrate on the main thread.
+        pDebugStats->tickDeferredObjects++;
+        integrateSceneObject( pSceneObject, tickStage, mSceneTime, pDebugStats );
+    }
+
+    // Finish the last run.
+    integrateConcurrentTickObjects( pJobScheduler, pDebugStats );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateConcurrentTickObjects( JobScheduler* pJobScheduler, DebugStats* pDebugStats )
+{
+    // Finish if the run is empty.
+    if ( mConcurrentTickObjects.size() == 0 )
+        return;
+
+    // Update tick stats.
+    pDebugStats->tickConcurrentObjects += (U32)mConcurrentTickObjects.size();
+
+    // Integrate concurrent objects.
+    mConcurrentTickActive = true;
+    pJobScheduler->parallelFor( (U32)mConcurrentTickObjects.size(), sConcurrentTickChunkSize, &Scene::concurrentTickJob, this );
+    mConcurrentTickActive = false;
+
+    // Apply any world proxy and render dirty updates deferred whilst integrating concurrently.
+    for ( typeSceneObjectVector::iterator sceneObjectItr = mConcurrentTickObjects.begin(); sceneObjectItr != mConcurrentTickObjects.end(); ++sceneObjectItr )
+    {
+        if ( mConcurrentTickStage == TICK_STAGE_INTEGRATE )
+            (*sceneObjectItr)->updateDeferredWorldProxy();
+
+        (*sceneObjectItr)->updateDeferredRenderDirty();
+    }
+
+    mConcurrentTickObjects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::concurrentTickJob( void* pJobContext, const U32 startIndex, const U32 endIndex )
+{
+    Scene* pScene = static_cast<Scene*>( pJobContext );
+
+    // Integrate the scene objects in the range.
+    for ( U32 i = startIndex; i < endIndex; ++i )
+    {
+        integrateSceneObject( pScene->mConcurrentTickObjects[i], pScene->mConcurrentTickStage, pScene->mSceneTime, &pScene->mDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::interpolateTick( F32 timeDelta )
 {
     // Finish if scene is paused.
@@ -980,6 +1285,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->renderPicked                   = 0;
     pDebugStats->renderRequests                 = 0;
     pDebugStats->renderFallbacks                = 0;
+    pDebugStats->renderConcurrentRequests       = 0;
+    pDebugStats->renderLayersReused             = 0;
+    pDebugStats->renderLayersIncrementallySorted = 0;
+    pDebugStats->renderLayersFullySorted        = 0;
     pDebugStats->batchTrianglesSubmitted        = 0;
     pDebugStats->batchDrawCallsStrict           = 0;
     pDebugStats->batchDrawCallsSorted           = 0;
@@ -993,6 +1302,7 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->batchLayerFlush                = 0;
     pDebugStats->batchNoBatchFlush              = 0;
     pDebugStats->batchAnonymousFlush            = 0;
+    pDebugStats->batchAtlasRemaps               = 0;
 
     // Set batch renderer wireframe mode.
     mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
@@ -1029,96 +1339,23 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         // Debug Profiling.
         PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
 
-        // Fetch the primary scene render queue.
-        SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();      
-
         // Yes so step through layers.
         for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
         {
             // Fetch layer.
             typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
 
-            // Fetch layer object count.
-            const U32 layerObjectCount = layerResults.size();
-
             // Are there any objects to render in this layer?
-            if ( layerObjectCount > 0 )
+            if ( layerResults.size() > 0 )
             {
-                // Yes, so increase render picked.
-                pDebugStats->renderPicked += layerObjectCount;
-
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
-
-                    // Skip if the object should not render.
-                    if ( !pSceneObject->shouldRender() )
-                        continue;
-
-                    // Can the scene object prepare a render?
-                    if ( pSceneObject->canPrepareRender() )
-                    {
-                        // Yes. so is it batch isolated.
-                        if ( pSceneObject->getBatchIsolated() )
-                        {
-                            // Yes, so create a default render request  on the primary queue.
-                            SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-
-                            // Create a new isolated render queue.
-                            pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
-
-                            // Prepare in the isolated queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
-
-                            // Increase render request count.
-                            pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
-
-                            // Adjust for the extra private render request.
-                            pDebugStats->renderRequests -= 1;
-                        }
-                        else
-                        {
-                            // No, so prepare in primary queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
-                        }
-                    }
-                    else
-                    {
-                        // No, so create a default render request for it.
-                        Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-                    }
-                }
+                // Yes, so prepare the layer render queue.
+                SceneRenderQueue* pSceneRenderQueue = prepareLayerRender( pSceneRenderState, layer, layerResults );
 
                 // Fetch render requests.
                 SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
 
-                // Fetch render request count.
-                const U32 renderRequestCount = (U32)sceneRenderRequests.size();
-
-                // Increase render request count.
-                pDebugStats->renderRequests += renderRequestCount;
-
-                // Do we have more than a single render request?
-                if ( renderRequestCount > 1 )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
-
-                    // Yes, so fetch layer sort mode.
-                    SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
-
-                    // Temporarily switch to normal sort if batch sort but batcher disabled.
-                    if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
-                        mode = SceneRenderQueue::RENDER_SORT_NEWEST;
-
-                    // Set render queue mode.
-                    pSceneRenderQueue->setSortMode( mode );
-
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
-                }
+                // Record the render requests concurrently if we can.
+                const bool concurrentRender = recordLayerRender( pSceneRenderState, pSceneRenderQueue );
 
                 // Iterate render requests.
                 for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
@@ -1129,6 +1366,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Fetch render request.
                     SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
 
+                    // Fetch render request index.
+                    const U32 renderRequestIndex = (U32)(renderRequestItr - sceneRenderRequests.begin());
+
                     // Fetch scene render object.
                     SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
              
@@ -1198,8 +1438,15 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     }
                     else
                     {
+                        // No, so was the object recorded concurrently?
+                        if ( concurrentRender && mConcurrentRenderRanges[renderRequestIndex].mRecorded )
+                        {
+                            // Yes, so replay the recorded commands.
+                            const ConcurrentRenderRange& concurrentRenderRange = mConcurrentRenderRanges[renderRequestIndex];
+                            mBatchRenderer.replay( *concurrentRenderRange.mpCommandBuffer, concurrentRenderRange.mCommandStart, concurrentRenderRange.mCommandCount );
+                        }
                         // No, so can the object render?
-                        if ( pSceneRenderObject->validRender() )
+                        else if ( pSceneRenderObject->validRender() )
                         {
                             // Yes, so render object.
                             pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
@@ -1231,14 +1478,17 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Render object overlay.
                     pSceneObject->sceneRenderOverlay( pSceneRenderState );
                 }
-            }
 
-            // Reset render queue.
-            pSceneRenderQueue->resetState();
+                // Cache the render queue if the layer isn't keeping it.
+                if ( pSceneRenderQueue != mLayerRenderCaches[layer].mpRenderQueue )
+                    SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
+            }
+            else
+            {
+                // No, so release any cached render queue.
+                releaseLayerRenderCache( layer );
+            }
         }
-
-        // Cache render queue..
-        SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
     }
 
     // Draw controllers.
@@ -1300,6 +1550,366 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
 //-----------------------------------------------------------------------------
 
+bool Scene::recordLayerRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Fetch the job scheduler.
+    JobScheduler* pJobScheduler = JobScheduler::Instance;
+
+    // Fetch render requests.
+    SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+    const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+
+    // Finish if we're not rendering concurrently or there are too few render requests to bother.
+    if ( !mConcurrentRender || pJobScheduler == NULL || pJobScheduler->getWorkerCount() == 0 || renderRequestCount < sConcurrentRenderMinimumRequests )
+        return false;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RecordLayerRender);
+
+    // Mark the render requests that can be recorded concurrently.
+    // NOTE:    Batch isolated objects render from their own queue and objects that cannot render use their
+    //          fallback so both are always rendered on the main thread.
+    mConcurrentRenderRanges.setSize( renderRequestCount );
+    U32 concurrentRequestCount = 0;
+    for ( U32 n = 0; n < renderRequestCount; ++n )
+    {
+        SceneRenderObject* pSceneRenderObject = sceneRenderRequests[n]->mpSceneRenderObject;
+
+        ConcurrentRenderRange& concurrentRenderRange = mConcurrentRenderRanges[n];
+        concurrentRenderRange.mRecorded =
+            pSceneRenderObject->getConcurrentRenderAllowed() &&
+            pSceneRenderObject->isBatchRendered() &&
+            !pSceneRenderObject->getBatchIsolated() &&
+            pSceneRenderObject->validRender();
+        concurrentRenderRange.mpCommandBuffer = NULL;
+        concurrentRenderRange.mCommandStart = 0;
+        concurrentRenderRange.mCommandCount = 0;
+
+        if ( concurrentRenderRange.mRecorded )
+            concurrentRequestCount++;
+    }
+
+    // Finish if there are too few render requests to bother.
+    if ( concurrentRequestCount < sConcurrentRenderMinimumRequests )
+        return false;
+
+    // Prepare a recorder for each participant.
+    const U32 participantCount = pJobScheduler->getWorkerCount() + 1;
+    for ( U32 n = 0; n < participantCount; ++n )
+    {
+        // Create the recorder if needed.
+        if ( mpConcurrentRenderers[n] == NULL )
+            mpConcurrentRenderers[n] = new BatchRender( &mConcurrentRenderBuffers[n] );
+
+        BatchRender* pRecorder = mpConcurrentRenderers[n];
+        pRecorder->setDebugStats( pSceneRenderState->mpDebugStats );
+        pRecorder->setWireframeMode( mBatchRenderer.getWireframeMode() );
+        mConcurrentRenderBuffers[n].clear();
+    }
+
+    // Update render stats.
+    pSceneRenderState->mpDebugStats->renderConcurrentRequests += concurrentRequestCount;
+
+    // Record the render requests.
+    mpConcurrentRenderState = pSceneRenderState;
+    mpConcurrentRenderQueue = pSceneRenderQueue;
+    pJobScheduler->parallelFor( renderRequestCount, sConcurrentRenderChunkSize, &Scene::concurrentRenderJob, this );
+    mpConcurrentRenderState = NULL;
+    mpConcurrentRenderQueue = NULL;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::concurrentRenderJob( void* pJobContext, const U32 startIndex, const U32 endIndex )
+{
+    Scene* pScene = static_cast<Scene*>( pJobContext );
+
+    // Fetch the recorder for this participant.
+    // NOTE:    Each participant records into its own command buffer and notes the range of commands for each
+    //          render request so the main thread can replay them in the sorted render order.
+    const U32 participantIndex = JobScheduler::getCurrentParticipantIndex();
+    BatchRender* pRecorder = pScene->mpConcurrentRenderers[participantIndex];
+    BatchRenderCommandBuffer* pCommandBuffer = &pScene->mConcurrentRenderBuffers[participantIndex];
+
+    // Fetch render requests.
+    SceneRenderQueue* pSceneRenderQueue = pScene->mpConcurrentRenderQueue;
+    SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+    const bool strictOrderMode = pSceneRenderQueue->getStrictOrderMode();
+
+    // Record the render requests in the range.
+    for ( U32 i = startIndex; i < endIndex; ++i )
+    {
+        ConcurrentRenderRange& concurrentRenderRange = pScene->mConcurrentRenderRanges[i];
+
+        // Skip if the request is rendered on the main thread.
+        if ( !concurrentRenderRange.mRecorded )
+            continue;
+
+        // Match the strict order mode the main thread asserts before each request.
+        pRecorder->setStrictOrderMode( strictOrderMode );
+
+        // Record the render request.
+        SceneRenderRequest* pSceneRenderRequest = sceneRenderRequests[i];
+        concurrentRenderRange.mpCommandBuffer = pCommandBuffer;
+        concurrentRenderRange.mCommandStart = pCommandBuffer->getCommandCount();
+        pSceneRenderRequest->mpSceneRenderObject->sceneRender( pScene->mpConcurrentRenderState, pSceneRenderRequest, pRecorder );
+        concurrentRenderRange.mCommandCount = pCommandBuffer->getCommandCount() - concurrentRenderRange.mCommandStart;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderQueue* Scene::prepareLayerRender( const SceneRenderState* pSceneRenderState, const U32 layer, typeWorldQueryResultVector& layerResults )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_PrepareLayerRender);
+
+    // Fetch debug stats.
+    DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
+
+    // Fetch the layer render cache.
+    LayerRenderCache& layerRenderCache = mLayerRenderCaches[layer];
+
+    // Fetch layer sort mode.
+    SceneRenderQueue::RenderSort sortMode = mLayerSortModes[layer];
+
+    // Temporarily switch to normal sort if batch sort but batcher disabled.
+    if ( !mBatchRenderer.getBatchEnabled() && sortMode == SceneRenderQueue::RENDER_SORT_BATCH )
+        sortMode = SceneRenderQueue::RENDER_SORT_NEWEST;
+
+    // Increase render picked.
+    pDebugStats->renderPicked += (U32)layerResults.size();
+
+    // Is the cached render queue valid for this render?
+    // NOTE:    Each render host has its own view of the scene so only the most recent one is cached.
+    const bool cacheValid =
+        layerRenderCache.mpRenderQueue != NULL &&
+        layerRenderCache.mpRenderHost == pSceneRenderState->mpRenderHost &&
+        layerRenderCache.mSortMode == sortMode;
+
+    // Size the render order to the cached objects.
+    // NOTE:    Objects that were cached are placed in their cached render order and any others are appended.
+    const U32 cachedObjectCount = cacheValid ? layerRenderCache.mObjectCount : 0;
+    mLayerRenderOrder.setSize( cachedObjectCount );
+    if ( cachedObjectCount > 0 )
+        dMemset( mLayerRenderOrder.address(), 0, sizeof(SceneObject*) * cachedObjectCount );
+
+    U32 renderObjectCount = 0;
+    U32 cachedRenderObjectCount = 0;
+    bool cacheable = true;
+
+    // Iterate query results.
+    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+        // Skip if the object should not render.
+        if ( !pSceneObject->shouldRender() )
+            continue;
+
+        renderObjectCount++;
+
+        // Objects that prepare their own render requests do so depending on the view so cannot be cached.
+        if ( pSceneObject->canPrepareRender() )
+            cacheable = false;
+
+        // Was the object in the cached render queue?
+        if ( cacheValid && pSceneObject->mRenderCacheStamp == layerRenderCache.mCacheStamp )
+        {
+            // Yes, so place it in its cached render order.
+            mLayerRenderOrder[pSceneObject->mRenderCacheIndex] = pSceneObject;
+            cachedRenderObjectCount++;
+        }
+        else
+        {
+            // No, so append it.
+            mLayerRenderOrder.push_back( pSceneObject );
+        }
+    }
+
+    // Can we reuse the cached render queue as is?
+    if (    cacheable &&
+            cacheValid &&
+            !layerRenderCache.mDirty &&
+            renderObjectCount == cachedObjectCount &&
+            cachedRenderObjectCount == cachedObjectCount )
+    {
+        // Yes, so increase render request count.
+        pDebugStats->renderRequests += (U32)layerRenderCache.mpRenderQueue->getRenderRequests().size();
+
+        // Increase layers reused.
+        pDebugStats->renderLayersReused++;
+
+        return layerRenderCache.mpRenderQueue;
+    }
+
+    // Create a render queue.
+    SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();
+
+    // Can the layer be cached?
+    if ( !cacheable )
+    {
+        // No, so release any cached render queue.
+        releaseLayerRenderCache( layer );
+
+        // Iterate query results.
+        for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+            // Skip if the object should not render.
+            if ( !pSceneObject->shouldRender() )
+                continue;
+
+            // Can the scene object prepare a render?
+            if ( pSceneObject->canPrepareRender() )
+            {
+                // Yes. so is it batch isolated.
+                if ( pSceneObject->getBatchIsolated() )
+                {
+                    // Yes, so create a default render request  on the primary queue.
+                    SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+
+                    // Create a new isolated render queue.
+                    pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
+
+                    // Prepare in the isolated queue.
+                    pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
+
+                    // Increase render request count.
+                    pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+
+                    // Adjust for the extra private render request.
+                    pDebugStats->renderRequests -= 1;
+                }
+                else
+                {
+                    // No, so prepare in primary queue.
+                    pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
+                }
+            }
+            else
+            {
+                // No, so create a default render request for it.
+                Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+            }
+        }
+    }
+    else
+    {
+        // Yes, so create a default render request for each object in render order.
+        for( typeSceneObjectVector::iterator renderOrderItr = mLayerRenderOrder.begin(); renderOrderItr != mLayerRenderOrder.end(); ++renderOrderItr )
+        {
+            // Skip cached objects that are no longer rendered.
+            if ( *renderOrderItr == NULL )
+                continue;
+
+            Scene::createDefaultRenderRequest( pSceneRenderQueue, *renderOrderItr );
+        }
+    }
+
+    // Fetch render requests.
+    SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+
+    // Fetch render request count.
+    const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+
+    // Increase render request count.
+    pDebugStats->renderRequests += renderRequestCount;
+
+    // Do we have more than a single render request?
+    if ( renderRequestCount > 1 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
+
+        // Yes, so set render queue mode.
+        pSceneRenderQueue->setSortMode( sortMode );
+
+        // Sort the render requests incrementally if they're in the cached order, otherwise fully.
+        // NOTE:    The incremental sort is allowed as many moves as there are requests before it sorts fully.
+        bool incrementalSort = false;
+        if ( cacheable && cacheValid )
+            incrementalSort = pSceneRenderQueue->sortIncremental( renderRequestCount );
+        else
+            pSceneRenderQueue->sort();
+
+        // Increase layers sorted.
+        if ( incrementalSort )
+            pDebugStats->renderLayersIncrementallySorted++;
+        else
+            pDebugStats->renderLayersFullySorted++;
+    }
+
+    // Finish if the layer cannot be cached.
+    if ( !cacheable )
+        return pSceneRenderQueue;
+
+    // Release the previous cached render queue.
+    releaseLayerRenderCache( layer );
+
+    // Generate a new cache stamp.
+    // NOTE:    A stamp of zero is never used so that new objects never match.
+    if ( ++mLayerRenderCacheStamp == 0 )
+        ++mLayerRenderCacheStamp;
+
+    // Stamp the objects with their render order.
+    for ( U32 index = 0; index < renderRequestCount; ++index )
+    {
+        SceneObject* pSceneObject = static_cast<SceneObject*>( sceneRenderRequests[index]->mpSceneRenderObject );
+        pSceneObject->mRenderCacheStamp = mLayerRenderCacheStamp;
+        pSceneObject->mRenderCacheIndex = index;
+    }
+
+    // Cache the render queue.
+    layerRenderCache.mpRenderQueue = pSceneRenderQueue;
+    layerRenderCache.mpRenderHost = pSceneRenderState->mpRenderHost;
+    layerRenderCache.mSortMode = sortMode;
+    layerRenderCache.mObjectCount = renderRequestCount;
+    layerRenderCache.mCacheStamp = mLayerRenderCacheStamp;
+    layerRenderCache.mDirty = false;
+
+    return pSceneRenderQueue;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::releaseLayerRenderCache( const U32 layer )
+{
+    // Fetch the layer render cache.
+    LayerRenderCache& layerRenderCache = mLayerRenderCaches[layer];
+
+    // Cache any render queue.
+    if ( layerRenderCache.mpRenderQueue != NULL )
+    {
+        SceneRenderQueueFactory.cacheObject( layerRenderCache.mpRenderQueue );
+        layerRenderCache.mpRenderQueue = NULL;
+    }
+
+    // Reset the cache.
+    layerRenderCache.mpRenderHost = NULL;
+    layerRenderCache.mSortMode = SceneRenderQueue::RENDER_SORT_INVALID;
+    layerRenderCache.mObjectCount = 0;
+    layerRenderCache.mCacheStamp = 0;
+    layerRenderCache.mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::releaseLayerRenderCaches( void )
+{
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+    {
+        releaseLayerRenderCache( layer );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::clearScene( bool deleteObjects )
 {
     while( mSceneObjects.size() > 0 )
@@ -1362,6 +1972,9 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Add scene object.
     mSceneObjects.push_back( pSceneObject );
 
+    // Flag the object layer as render dirty.
+    setLayerRenderDirty( pSceneObject->getSceneLayer() );
+
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
@@ -1407,6 +2020,9 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         (dynamic_cast<SceneWindow*>(mAttachedSceneWindows[i]))->removeFromInputEventPick(pSceneObject);
     }
 
+    // Flag the object layer as render dirty.
+    setLayerRenderDirty( pSceneObject->getSceneLayer() );
+
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
@@ -1496,7 +2112,7 @@ const AssetPtr<AssetBase>* Scene::getAssetPreload( const S32 index ) const
 
 //-----------------------------------------------------------------------------
 
-void Scene::addAssetPreload( const char* pAssetId )
+void Scene::addAssetPreload( const char* pAssetId, const bool async )
 {
     // Sanity!
     AssertFatal( pAssetId != NULL, "Scene::addAssetPreload() - Cannot add a NULL asset preload." );
@@ -1512,6 +2128,28 @@ void Scene::addAssetPreload( const char* pAssetId )
             return;
     }
 
+    // Is the preload asynchronous?
+    if ( async )
+    {
+        // Yes, so create asset pointer.
+        AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>();
+
+        // Was the asset acquire queued?
+        if ( !pAssetPtr->setAssetIdAsync( pAssetId ) )
+        {
+            // No, so warn.
+            Con::warnf( "Scene::addAssetPreload() - Failed to asynchronously acquire asset '%s' so not added as a preload.", pAssetId );
+
+            // No, so delete the asset pointer.
+            delete pAssetPtr;
+            return;
+        }
+
+        // Add asset.
+        mAssetPreloads.push_back( pAssetPtr );
+        return;
+    }
+
     // Create asset pointer.
     AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>( pAssetId );
 
@@ -1532,6 +2170,21 @@ void Scene::addAssetPreload( const char* pAssetId )
 
 //-----------------------------------------------------------------------------
 
+S32 Scene::getAssetPreloadPendingCount( void ) const
+{
+    S32 pendingCount = 0;
+
+    for( typeAssetPtrVector::const_iterator assetItr = mAssetPreloads.begin(); assetItr != mAssetPreloads.end(); ++assetItr )
+    {
+        if ( (*assetItr)->isPending() )
+            pendingCount++;
+    }
+
+    return pendingCount;
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::removeAssetPreload( const char* pAssetId )
 {
     // Sanity!
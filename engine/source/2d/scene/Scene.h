@@ -67,6 +67,10 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
 #ifndef _BEHAVIOR_COMPONENT_H_
 #include "component/behaviors/behaviorComponent.h"
 #endif
@@ -81,6 +85,7 @@ extern EnumTable jointTypeTable;
 
 ///-----------------------------------------------------------------------------
 
+class Scene;
 class SceneObject;
 class SceneWindow;
 
@@ -157,6 +162,33 @@ struct TickContact
 
 ///-----------------------------------------------------------------------------
 
+struct SceneContact : public TickContact
+{
+    SimObjectId     mSceneObjectIdA;
+    SimObjectId     mSceneObjectIdB;
+    S32             mShapeIndexA;
+    S32             mShapeIndexB;
+};
+
+///-----------------------------------------------------------------------------
+
+class SceneContactListener
+{
+public:
+    virtual ~SceneContactListener() {}
+
+    /// Called once per tick with the contacts that began and ended during the tick.
+    /// Scene objects must not be deleted or removed from the scene during the call.
+    virtual void onSceneContacts(
+        Scene* pScene,
+        const SceneContact* pBeginContacts,
+        const U32 beginContactCount,
+        const SceneContact* pEndContacts,
+        const U32 endContactCount ) = 0;
+};
+
+///-----------------------------------------------------------------------------
+
 class Scene :
     public BehaviorComponent,
     public TamlChildren,
@@ -171,6 +203,8 @@ public:
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef Vector<SceneContact>                typeSceneContactVector;
+    typedef Vector<SceneContactListener*>       typeContactListenerVector;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
     /// Scene Debug Options.
@@ -193,6 +227,14 @@ public:
         SCENE_DEBUG_SORT_POINTS        = BIT(21),
     };
 
+    /// Tick stages.
+    enum TickStage
+    {
+        TICK_STAGE_PREINTEGRATE,
+        TICK_STAGE_INTEGRATE,
+        TICK_STAGE_POSTINTEGRATE,
+    };
+
     /// Pick mode.
     enum PickMode
     {
@@ -224,6 +266,12 @@ private:
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
 
+    /// Concurrent ticking.
+    bool                        mConcurrentTick;
+    bool                        mConcurrentTickActive;
+    TickStage                   mConcurrentTickStage;
+    typeSceneObjectVector       mConcurrentTickObjects;
+
     /// Joint access.
     typeJointHash               mJoints;
     typeReverseJointHash        mReverseJoints;
@@ -247,9 +295,39 @@ private:
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
 
+    /// Layer render caching.
+    struct LayerRenderCache
+    {
+        SceneRenderQueue*               mpRenderQueue;
+        const SimObject*                mpRenderHost;
+        SceneRenderQueue::RenderSort    mSortMode;
+        U32                             mObjectCount;
+        U32                             mCacheStamp;
+        bool                            mDirty;
+    };
+    LayerRenderCache            mLayerRenderCaches[MAX_LAYERS_SUPPORTED];
+    U32                         mLayerRenderCacheStamp;
+    typeSceneObjectVector       mLayerRenderOrder;
+
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
 
+    /// Concurrent rendering.
+    struct ConcurrentRenderRange
+    {
+        bool                        mRecorded;
+        BatchRenderCommandBuffer*   mpCommandBuffer;
+        U32                         mCommandStart;
+        U32                         mCommandCount;
+    };
+    typedef Vector<ConcurrentRenderRange> typeConcurrentRenderRangeVector;
+    bool                            mConcurrentRender;
+    BatchRender*                    mpConcurrentRenderers[JobScheduler::MAX_PARTICIPANTS];
+    BatchRenderCommandBuffer        mConcurrentRenderBuffers[JobScheduler::MAX_PARTICIPANTS];
+    typeConcurrentRenderRangeVector mConcurrentRenderRanges;
+    const SceneRenderState*         mpConcurrentRenderState;
+    SceneRenderQueue*               mpConcurrentRenderQueue;
+
     /// Window rendering.
     SceneWindow*                mpCurrentRenderWindow;
 
@@ -268,12 +346,34 @@ private:
     typeContactVector           mEndContacts;
     U32                         mSceneIndex;
 
+    /// Contact batches.
+    bool                        mBatchContactCallback;
+    typeSceneContactVector      mTickBeginContacts;
+    typeSceneContactVector      mTickEndContacts;
+    typeContactListenerVector   mContactListeners;
+
 private:   
     /// Contacts.
     void                        forwardContacts( void );
+    void                        gatherTickContacts( void );
+    void                        dispatchContacts( void );
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
 
+    /// Integration.
+    void                        integrateTickStage( const TickStage tickStage, DebugStats* pDebugStats );
+    void                        integrateConcurrentTickObjects( JobScheduler* pJobScheduler, DebugStats* pDebugStats );
+    static void                 concurrentTickJob( void* pJobContext, const U32 startIndex, const U32 endIndex );
+
+    /// Concurrent rendering.
+    bool                        recordLayerRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
+    static void                 concurrentRenderJob( void* pJobContext, const U32 startIndex, const U32 endIndex );
+
+    /// Layer render caching.
+    SceneRenderQueue*           prepareLayerRender( const SceneRenderState* pSceneRenderState, const U32 layer, typeWorldQueryResultVector& layerResults );
+    void                        releaseLayerRenderCache( const U32 layer );
+    void                        releaseLayerRenderCaches( void );
+
     /// Joint definition.
     struct CommonJointDefinition
     {
@@ -324,9 +424,14 @@ public:
     virtual void            processTick();
     virtual void            interpolateTick( F32 delta );
     virtual void            advanceTime( F32 timeDelta ) {};
+    inline void             setConcurrentTick( const bool status )      { mConcurrentTick = status; }
+    inline bool             getConcurrentTick( void ) const             { return mConcurrentTick; }
+    inline bool             getConcurrentTickActive( void ) const       { return mConcurrentTickActive; }
 
     /// Render output.
     void                    sceneRender( const SceneRenderState* pSceneRenderState );
+    inline void             setConcurrentRender( const bool status )    { mConcurrentRender = status; }
+    inline bool             getConcurrentRender( void ) const           { return mConcurrentRender; }
 
     /// World.
     inline b2World*         getWorld( void ) const                      { return mpWorld; }
@@ -358,7 +463,8 @@ public:
 
     inline S32              getAssetPreloadCount( void ) const          { return mAssetPreloads.size(); }
     const AssetPtr<AssetBase>* getAssetPreload( const S32 index ) const;
-    void                    addAssetPreload( const char* pAssetId );
+    void                    addAssetPreload( const char* pAssetId, const bool async = false );
+    S32                     getAssetPreloadPendingCount( void ) const;
     void                    removeAssetPreload( const char* pAssetId );
     void                    clearAssetPreloads( void );
 
@@ -637,6 +743,9 @@ public:
     void setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode );
     SceneRenderQueue::RenderSort getLayerSortMode( const U32 layer );
 
+    /// Layer render caching (main thread only).
+    inline void             setLayerRenderDirty( const U32 layer )      { if ( layer < MAX_LAYERS_SUPPORTED ) mLayerRenderCaches[layer].mDirty = true; }
+
     /// Window attachments.
     void                    attachSceneWindow( SceneWindow* pSceneWindow2D );
     void                    detachSceneWindow( SceneWindow* pSceneWindow2D );
@@ -657,6 +766,8 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchAtlasEnabled( const bool enabled )  { mBatchRenderer.setAtlasEnabled( enabled ); }
+    inline bool             getBatchAtlasEnabled( void ) const          { return mBatchRenderer.getAtlasEnabled(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
     inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
     static U32              getGlobalSceneCount( void );
@@ -665,6 +776,15 @@ public:
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
     inline bool             getRenderCallback( void ) const             { return mRenderCallback; }
+
+    /// Contact batches.
+    inline void             setBatchContactCallback( const bool callback ) { mBatchContactCallback = callback; }
+    inline bool             getBatchContactCallback( void ) const       { return mBatchContactCallback; }
+    void                    addContactListener( SceneContactListener* pContactListener );
+    void                    removeContactListener( SceneContactListener* pContactListener );
+    inline const typeSceneContactVector& getTickBeginContacts( void ) const { return mTickBeginContacts; }
+    inline const typeSceneContactVector& getTickEndContacts( void ) const { return mTickEndContacts; }
+    static void             formatContactInfo( const SceneContact& sceneContact, const bool beginContact, const bool swapObjects, char* pBuffer, const U32 bufferSize );
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
@@ -723,6 +843,13 @@ protected:
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeBatchContactCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getBatchContactCallback(); }
+
+    // Integration.
+    static bool writeConcurrentTick( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getConcurrentTick(); }
+
+    // Render output.
+    static bool writeConcurrentRender( void* obj, StringTableEntry pFieldName )     { return static_cast<Scene*>(obj)->getConcurrentRender(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
@@ -49,6 +49,10 @@ public:
 
     virtual bool getBatchIsolated( void ) = 0;
 
+    /// Whether the object can record its render requests on a worker thread or not.
+    /// NOTE:   The object must only submit to the batch renderer and not modify any shared state whilst rendering.
+    virtual bool getConcurrentRenderAllowed( void ) const { return false; }
+
     virtual bool validRender( void ) const = 0;
 
     virtual bool shouldRender( void ) const = 0;
@@ -81,168 +81,307 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
+static inline U32 getFloatSortKey( const F32 value )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-    
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredOldFrontSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Use reverse serial Id,
-    return pSceneRenderRequestB->mSerialId - pSceneRenderRequestA->mSerialId;
+    // Map the float onto an unsigned integer with the same ordering.
+    // NOTE:-   Adding zero folds negative zero into positive zero so they compare as equal.
+    union { F32 f; U32 u; } bits;
+    bits.f = value + 0.0f;
+    return bits.u ^ ( (bits.u & 0x80000000) ? 0xFFFFFFFF : 0x80000000 );
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredDepthSort(const void* a, const void* b)
+static inline U32 getSerialSortKey( const S32 serialId )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
-
-    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Map the signed serial Id onto an unsigned integer with the same ordering.
+    return (U32)serialId ^ 0x80000000;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseDepthSort(const void* a, const void* b)
+void SceneRenderQueue::sort( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_Sort);
 
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Finish if sorting is off.
+    if ( mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+        return;
 
-    return depthA < depthB ? -1 : depthA > depthB ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
+    // Batching means we don't need strict order.
+    if ( mSortMode == RENDER_SORT_BATCH )
+        mStrictOrderMode = false;
 
-//-----------------------------------------------------------------------------
+    // Finish if there's nothing to sort.
+    const U32 requestCount = (U32)mRenderRequests.size();
+    if ( requestCount < 2 )
+        return;
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerBatchOrderSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Build the sort keys.
+    buildSortKeys();
 
-    // Fetch scene render objects.
-    SceneRenderObject* pSceneRenderObjectA = pSceneRenderRequestA->mpSceneRenderObject;
-    SceneRenderObject* pSceneRenderObjectB = pSceneRenderRequestB->mpSceneRenderObject;
+    // Sort the keys.
+    radixSortKeys();
 
-    // Fetch batch render isolation.
-    const bool renderIsolatedA = pSceneRenderObjectA->getBatchIsolated();
-    const bool renderIsolatedB = pSceneRenderObjectB->getBatchIsolated();
-
-    // A not render isolated?
-    if ( !renderIsolatedA )
+    // Are we sorting by render group?
+    if ( mSortMode == RENDER_SORT_GROUP )
     {
-        // Use the serial Id if neither are render isolated.
-        if ( !renderIsolatedB )
-            return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-
-        // A not render isolated but B is.
-        return 1;
+        // Yes, so sort by render group (address, arbitrary but static).
+        // NOTE:-   The radix sort is stable so the serial Id order is kept within each render group.
+        for ( U32 index = 0; index < requestCount; ++index )
+        {
+            mSortKeys[index].mKey = (U64)(uintptr_t)mSortKeys[index].mpSceneRenderRequest->mRenderGroup;
+        }
+        radixSortKeys();
     }
 
-    // B not render isolated?
-    if ( !renderIsolatedB )
+    // Reorder the render requests.
+    for ( U32 index = 0; index < requestCount; ++index )
     {
-        // A is render isolated.
-        return -1;
+        mRenderRequests[index] = mSortKeys[index].mpSceneRenderRequest;
     }
-
-    // A and B are render isolated so use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerGroupOrderSort(const void* a, const void* b)
+bool SceneRenderQueue::sortIncremental( const U32 maxMoves )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch the groups.
-    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
-    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
-
-    // Sort by render group (address, arbitrary but static) and use age if render groups are identical.
-    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
-}
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_SortIncremental);
 
-//-----------------------------------------------------------------------------
+    // Finish if sorting is off.
+    if ( mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+        return true;
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredXSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Render groups need a second pass so always use a full sort.
+    if ( mSortMode == RENDER_SORT_GROUP )
+    {
+        sort();
+        return false;
+    }
 
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+    // Batching means we don't need strict order.
+    if ( mSortMode == RENDER_SORT_BATCH )
+        mStrictOrderMode = false;
 
-    // We sort lower x values before higher values.
-    return x1 < x2 ? -1 : x1 > x2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
+    // Finish if there's nothing to sort.
+    const U32 requestCount = (U32)mRenderRequests.size();
+    if ( requestCount < 2 )
+        return true;
 
-//-----------------------------------------------------------------------------
+    // Build the sort keys.
+    buildSortKeys();
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredYSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Insertion sort the keys.
+    // NOTE:-   The requests are expected to already be close to sorted (typically last frame's order) so
+    //          this is linear when little has changed.  If too many moves are needed then we fall back to the radix sort.
+    bool incremental = true;
+    U32 moves = 0;
+    for ( U32 index = 1; index < requestCount; ++index )
+    {
+        const RenderSortKey sortKey = mSortKeys[index];
+
+        U32 insertIndex = index;
+        while ( insertIndex > 0 && mSortKeys[insertIndex-1].mKey > sortKey.mKey )
+        {
+            mSortKeys[insertIndex] = mSortKeys[insertIndex-1];
+            --insertIndex;
+        }
+        mSortKeys[insertIndex] = sortKey;
+
+        // Have we exceeded the moves allowed?
+        moves += index - insertIndex;
+        if ( moves > maxMoves )
+        {
+            // Yes, so sort the keys fully.
+            // NOTE:-   The keys are unique so the result doesn't depend on the partial order.
+            radixSortKeys();
+            incremental = false;
+            break;
+        }
+    }
 
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Reorder the render requests.
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        mRenderRequests[index] = mSortKeys[index].mpSceneRenderRequest;
+    }
 
-    // We sort lower y values before higher values.
-    return y1 < y2 ? -1 : y1 > y2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    return incremental;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseXSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::buildSortKeys( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_BuildSortKeys);
 
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+    const U32 requestCount = (U32)mRenderRequests.size();
+    mSortKeys.setSize( requestCount );
 
-    // We sort higher x values before lower values.
-    return x1 < x2 ? 1 : x1 > x2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // The serial Id is always the least significant part of the key so that it breaks any ties.
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:
+            {
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    mSortKeys[index].mKey = getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_OLDEST:
+            {
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    mSortKeys[index].mKey = ~getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_BATCH:
+            {
+                // Batch isolated requests are rendered first.
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    const U64 batchKey = pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                    mSortKeys[index].mKey = (batchKey << 32) | getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // Render groups are addresses so they don't fit alongside the serial Id.
+                // NOTE:-   The render groups are sorted in a second stable pass (see sort()).
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    mSortKeys[index].mKey = getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_XAXIS:
+        case RENDER_SORT_INVERSE_XAXIS:
+            {
+                // The inverse sorts higher x values before lower values.
+                const U32 inverseMask = mSortMode == RENDER_SORT_INVERSE_XAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    const U64 sortPointKey = getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x ) ^ inverseMask;
+                    mSortKeys[index].mKey = (sortPointKey << 32) | getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_YAXIS:
+        case RENDER_SORT_INVERSE_YAXIS:
+            {
+                // The inverse sorts higher y values before lower values.
+                const U32 inverseMask = mSortMode == RENDER_SORT_INVERSE_YAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    const U64 sortPointKey = getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y ) ^ inverseMask;
+                    mSortKeys[index].mKey = (sortPointKey << 32) | getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        case RENDER_SORT_ZAXIS:
+        case RENDER_SORT_INVERSE_ZAXIS:
+            {
+                // The Z sort renders higher depths before lower depths, the inverse the opposite.
+                const U32 inverseMask = mSortMode == RENDER_SORT_ZAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+                    const U64 depthKey = getFloatSortKey( pSceneRenderRequest->mDepth ) ^ inverseMask;
+                    mSortKeys[index].mKey = (depthKey << 32) | getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    mSortKeys[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                return;
+            }
+
+        default:
+            break;
+    };
+
+    // Sanity!
+    AssertFatal( false, "SceneRenderQueue::buildSortKeys() - Unknown sort mode." );
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseYSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::radixSortKeys( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_RadixSortKeys);
+
+    const U32 keyCount = (U32)mSortKeys.size();
+    mSortKeysScratch.setSize( keyCount );
 
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Count the digits of all the passes at once.
+    U32 histograms[sizeof(U64)][256];
+    dMemset( histograms, 0, sizeof(histograms) );
+    for ( U32 index = 0; index < keyCount; ++index )
+    {
+        const U64 key = mSortKeys[index].mKey;
+        for ( U32 pass = 0; pass < sizeof(U64); ++pass )
+        {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    // Sort from the least significant digit.
+    RenderSortKey* pSource = mSortKeys.address();
+    RenderSortKey* pDestination = mSortKeysScratch.address();
+    for ( U32 pass = 0; pass < sizeof(U64); ++pass )
+    {
+        const U32 shift = pass * 8;
+        U32* pHistogram = histograms[pass];
+
+        // Skip the pass if all the keys have the same digit (common for the upper bytes).
+        if ( pHistogram[(pSource[0].mKey >> shift) & 0xFF] == keyCount )
+            continue;
+
+        // Calculate the digit offsets.
+        U32 offset = 0;
+        for ( U32 digit = 0; digit < 256; ++digit )
+        {
+            const U32 digitCount = pHistogram[digit];
+            pHistogram[digit] = offset;
+            offset += digitCount;
+        }
+
+        // Scatter the keys.
+        for ( U32 index = 0; index < keyCount; ++index )
+        {
+            const RenderSortKey& sortKey = pSource[index];
+            pDestination[pHistogram[(sortKey.mKey >> shift) & 0xFF]++] = sortKey;
+        }
+
+        // Swap the buffers.
+        RenderSortKey* pSwap = pSource;
+        pSource = pDestination;
+        pDestination = pSwap;
+    }
 
-    // We sort higher y values before lower values.
-    return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Make sure the sorted keys end up in the key vector.
+    if ( pSource != mSortKeys.address() )
+        dMemcpy( mSortKeys.address(), pSource, keyCount * sizeof(RenderSortKey) );
 }
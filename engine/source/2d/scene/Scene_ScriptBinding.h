@@ -306,17 +306,31 @@ ConsoleMethodWithDocs(Scene, getAssetPreload, ConsoleString, 3, 3, (index))
 //-----------------------------------------------------------------------------
 
 /*! Adds the asset Id so that it is preloaded when the scene is loaded.
-    The asset loaded immediately by this operation.  Duplicate assets are ignored.
+    The asset loaded immediately by this operation unless it is asynchronous.  Duplicate assets are ignored.
     @param assetId The asset Id to be added.
+    @param async Whether the asset is loaded in the background or not.  Use 'getAssetPreloadPendingCount' to check when it has loaded.  Optional: Defaults to false.
     @return No return value.
 */
-ConsoleMethodWithDocs(Scene, addAssetPreload, ConsoleVoid, 3, 3, (assetId))
+ConsoleMethodWithDocs(Scene, addAssetPreload, ConsoleVoid, 3, 4, (assetId, [async?]))
 {
     // Fetch asset Id.
     const char* pAssetId = argv[2];
 
+    // Fetch async flag.
+    const bool async = argc >= 4 ? dAtob(argv[3]) : false;
+
     // Add asset preload.
-    object->addAssetPreload( pAssetId );
+    object->addAssetPreload( pAssetId, async );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of asset preloads that are still loading in the background.
+    @return The number of asset preloads that are still loading in the background.
+*/
+ConsoleMethodWithDocs(Scene, getAssetPreloadPendingCount, ConsoleInt, 2, 2, ())
+{
+    return object->getAssetPreloadPendingCount();
 }
 
 //-----------------------------------------------------------------------------
@@ -414,6 +428,105 @@ ConsoleMethodWithDocs(Scene, getScenePause, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether contacts are delivered once per tick with the 'onSceneContacts(beginContactCount, endContactCount)' callback.
+    When enabled, the per-contact 'onSceneCollision', 'onCollision', 'onSceneEndCollision' and 'onEndCollision' callbacks are not performed.
+    The contacts are fetched with 'getBeginContact' and 'getEndContact' during the callback.
+    @param status Whether contacts are batched or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchContactCallback, ConsoleVoid, 3, 3, (bool status))
+{
+    object->setBatchContactCallback( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether contacts are delivered once per tick with the 'onSceneContacts' callback.
+    @return Whether contacts are batched or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchContactCallback, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchContactCallback();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contacts that began during the last tick.
+    @return The number of contacts that began during the last tick.
+*/
+ConsoleMethodWithDocs(Scene, getBeginContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getTickBeginContacts().size();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a contact that began during the last tick.
+    @param contactIndex The index of the contact.
+    @return The contact as "sceneObjectA sceneObjectB" followed by the collision details passed to 'onSceneCollision'.
+*/
+ConsoleMethodWithDocs(Scene, getBeginContact, ConsoleString, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    // Is the contact index valid?
+    const Scene::typeSceneContactVector& contacts = object->getTickBeginContacts();
+    if ( contactIndex < 0 || contactIndex >= contacts.size() )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getBeginContact() - Invalid contact index '%d'.", contactIndex );
+        return StringTable->EmptyString;
+    }
+
+    // Format output.
+    const SceneContact& sceneContact = contacts[contactIndex];
+    char* pBuffer = Con::getReturnBuffer(160);
+    const S32 length = dSprintf( pBuffer, 160, "%d %d ", sceneContact.mSceneObjectIdA, sceneContact.mSceneObjectIdB );
+    Scene::formatContactInfo( sceneContact, true, false, pBuffer + length, 160 - length );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contacts that ended during the last tick.
+    @return The number of contacts that ended during the last tick.
+*/
+ConsoleMethodWithDocs(Scene, getEndContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getTickEndContacts().size();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a contact that ended during the last tick.
+    @param contactIndex The index of the contact.
+    @return The contact as "sceneObjectA sceneObjectB shapeIndexA shapeIndexB".
+*/
+ConsoleMethodWithDocs(Scene, getEndContact, ConsoleString, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    // Is the contact index valid?
+    const Scene::typeSceneContactVector& contacts = object->getTickEndContacts();
+    if ( contactIndex < 0 || contactIndex >= contacts.size() )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getEndContact() - Invalid contact index '%d'.", contactIndex );
+        return StringTable->EmptyString;
+    }
+
+    // Format output.
+    const SceneContact& sceneContact = contacts[contactIndex];
+    char* pBuffer = Con::getReturnBuffer(64);
+    const S32 length = dSprintf( pBuffer, 64, "%d %d ", sceneContact.mSceneObjectIdA, sceneContact.mSceneObjectIdB );
+    Scene::formatContactInfo( sceneContact, false, false, pBuffer + length, 64 - length );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Gets the joint count.
     @return Returns no value
 */
@@ -3542,6 +3655,61 @@ ConsoleMethodWithDocs(Scene, getFrameCount, ConsoleInt, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether eligible scene objects are integrated concurrently on worker threads or not.
+    Objects that perform script callbacks or audio updates are always integrated on the main thread.
+    @param status Whether concurrent ticking is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setConcurrentTick, ConsoleVoid, 3, 3, ( bool status ))
+{
+    // Fetch args.
+    const bool status = dAtob(argv[2]);
+
+    // Sets concurrent ticking.
+    object->setConcurrentTick( status );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether eligible scene objects are integrated concurrently on worker threads or not.
+    @return Whether concurrent ticking is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getConcurrentTick, ConsoleBool, 2, 2, ())
+{
+    // Gets concurrent ticking.
+    return object->getConcurrentTick();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether eligible render requests are recorded concurrently on worker threads or not.
+    Each worker records into its own command buffer and the commands are replayed on the main thread in the sorted render order.
+    Only sprites and composite sprites are currently recorded concurrently; other objects always render on the main thread.
+    @param status Whether concurrent rendering is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setConcurrentRender, ConsoleVoid, 3, 3, ( bool status ))
+{
+    // Fetch args.
+    const bool status = dAtob(argv[2]);
+
+    // Sets concurrent rendering.
+    object->setConcurrentRender( status );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether eligible render requests are recorded concurrently on worker threads or not.
+    @return Whether concurrent rendering is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getConcurrentRender, ConsoleBool, 2, 2, ())
+{
+    // Gets concurrent rendering.
+    return object->getConcurrentRender();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether render batching is enabled or not.
     @param enabled Whether render batching is enabled or not.
     return No return value.
@@ -3568,6 +3736,55 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether textures packed into the texture atlas are batched using their shared atlas page.
+    Textures are only packed when "$pref::OpenGL::textureAtlas" is enabled before they are loaded.
+    @param enabled Whether atlas batching is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchAtlasEnabled, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    // Fetch args.
+    const bool enabled = dAtob(argv[2]);
+
+    // Sets atlas batching enabled.
+    object->setBatchAtlasEnabled( enabled );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether textures packed into the texture atlas are batched using their shared atlas page.
+    @return Whether atlas batching is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchAtlasEnabled, ConsoleBool, 2, 2, ())
+{
+    // Gets atlas batching enabled.
+    return object->getBatchAtlasEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the batching statistics for the last rendered frame.
+    Toggling "setBatchAtlasEnabled" allows the flush counts to be compared with and without the texture atlas.
+    @return The statistics as "drawCalls flushes textureChangeFlushes atlasRemaps".
+*/
+ConsoleMethodWithDocs(Scene, getBatchStats, ConsoleString, 2, 2, ())
+{
+    // Fetch the debug stats.
+    const DebugStats& debugStats = object->getDebugStats();
+
+    // Format the stats.
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%d %d %d %d",
+        debugStats.batchDrawCallsStrict + debugStats.batchDrawCallsSorted,
+        debugStats.batchFlushes,
+        debugStats.batchTextureChangeFlush,
+        debugStats.batchAtlasRemaps );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
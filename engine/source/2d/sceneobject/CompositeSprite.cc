@@ -177,6 +177,25 @@ void CompositeSprite::integrateObject( const F32 totalTime, const F32 elapsedTim
 
 //-----------------------------------------------------------------------------
 
+bool CompositeSprite::getConcurrentTickAllowed( const Scene::TickStage tickStage ) const
+{
+    switch( tickStage )
+    {
+        case Scene::TICK_STAGE_PREINTEGRATE:
+            // Resizing to the local extents changes the collision fixtures.
+            return !getLocalExtentsDirty() && Parent::getConcurrentTickAllowed( tickStage );
+
+        case Scene::TICK_STAGE_INTEGRATE:
+            // Integrating the sprites can perform animation callbacks.
+            return false;
+
+        default:
+            return Parent::getConcurrentTickAllowed( tickStage );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void CompositeSprite::interpolateObject( const F32 timeDelta )
 {
     // Call parent.
@@ -10,7 +10,12 @@ IMPLEMENT_CONOBJECT(LightObject);
 
 LightObject::LightObject():
    mLightRadius(10.0f),
-   mLightSegments(15)
+   mLightSegments(15),
+   mShadowValid(false),
+   mShadowPosition(0.0f, 0.0f),
+   mShadowRadius(0.0f),
+   mShadowSegments(0),
+   mShadowRebuildCount(0)
 {
    mSrcBlendFactor = GL_SRC_ALPHA;
    mDstBlendFactor = GL_ONE;
@@ -58,158 +63,199 @@ void LightObject::safeDelete(void)
 
 void LightObject::sceneRender(const SceneRenderState * sceneRenderState, const SceneRenderRequest * sceneRenderRequest, BatchRender * batchRender)
 {
-   Vector2 worldPos = getPosition();
-   Vector<Vector2> verts;
-   Vector<RayList> bList;
-   S32 mSrcLightBlend = getSrcBlendFactor();
-   S32 mDstLightBlend = getDstBlendFactor();
-   ColorF mLightColor = getBlendColor();
-
-   F32 radius = getLightRadius();
-   Scene* scene = getScene();
-   b2World* mWorld = scene->getWorld();
-
-
-   
-
-   glEnable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
-   glPushMatrix();
- 
-   glTranslatef(worldPos.x, worldPos.y, 0);
-   glPolygonMode(GL_FRONT, GL_FILL);
-
-   //additive blending
-   //glBlendFunc(GL_ONE,GL_ONE);
-   
-   glBlendFunc(mSrcLightBlend, mDstLightBlend);
-   // Creates the fading dark region.
-   glBegin(GL_TRIANGLE_FAN);
-   glColor4f(mLightColor.red,mLightColor.green,mLightColor.blue,mLightColor.alpha);
-   glVertex2f(0, 0);
-   //check scene objects
-   U32 objCount = scene->getSceneObjectCount();
-   for (U32 i = 0; i < objCount; i++)
-   {
-      SceneObject *tObj = scene->getSceneObject(i);
-      Vector2 dist = worldPos - tObj->getPosition();
-      const F32 distSqr = dist.LengthSquared();
-      const F32 radSqr = radius * radius;
-      //within radius?
-      if (distSqr < radSqr || distSqr == radSqr)
-      {
-         U32 shapeCount = tObj->getCollisionShapeCount();
-         for (U32 j = 0; j < shapeCount; j++)
-         {
-            //All vertices from polygon collision shape
-            if (tObj->getCollisionShapeType(j) == b2Shape::e_polygon)
-            {
-               U32 pCount = tObj->getPolygonCollisionShapePointCount(j);
-
-               for (U32 k = 0; k < pCount; k++)
-               {
-                  Vector2 locPoint = tObj->getPolygonCollisionShapeLocalPoint(j, k);
-                  Vector2 wPoint = tObj->getWorldPoint(locPoint);
-                  verts.push_back(wPoint);
-               }
-            }
-         }
-      }
-   }
+   // Debug Profiling.
+   PROFILE_SCOPE(LightObject_SceneRender);
+
+   // Rebuild the shadow geometry only if the light or an occluder in range changed.
+   if (gatherOccluders())
+      buildShadowRays();
+
+   const U32 rayCount = mShadowRays.size();
+   if (rayCount < 2)
+      return;
+
    ///  \ | /
    /// -  +  -
    ///  / | \
 
-   U32 lightSeg = getLightSegments();
-   F32 segAng = 360.0f / lightSeg;
+   // Build the fan as triangles, fading each edge vertex by the distance its ray travelled.
+   const Vector2 worldPos = getPosition();
+   const ColorF& lightColor = getBlendColor();
+   const U32 vertexCount = rayCount * 3;
+   mFanVertices.setSize(vertexCount);
+   mFanColors.setSize(vertexCount);
+   if ((U32)mFanTextureCoords.size() < vertexCount)
+   {
+      const U32 oldSize = mFanTextureCoords.size();
+      mFanTextureCoords.setSize(vertexCount);
+      for (U32 i = oldSize; i < vertexCount; i++)
+         mFanTextureCoords[i].SetZero();
+   }
 
-   for (U32 i = 0; i <= lightSeg; i++)
+   for (U32 i = 0; i < rayCount; i++)
    {
-      b2Vec2 segStrt = worldPos;
-      b2Vec2 segEnd = segStrt + radius * b2Vec2(mCos(mDegToRad((F32)segAng * i)), mSin(mDegToRad((F32)segAng * i)));
-      verts.push_back(segEnd);
+      const RayList& ray0 = mShadowRays[i];
+      const RayList& ray1 = mShadowRays[(i + 1) % rayCount];
+      const U32 vertexIndex = i * 3;
+
+      mFanVertices[vertexIndex].Set(worldPos.x, worldPos.y);
+      mFanVertices[vertexIndex + 1].Set(worldPos.x + ray0.x, worldPos.y + ray0.y);
+      mFanVertices[vertexIndex + 2].Set(worldPos.x + ray1.x, worldPos.y + ray1.y);
+
+      mFanColors[vertexIndex] = lightColor;
+      mFanColors[vertexIndex + 1] = lightColor - (lightColor * ray0.l);
+      mFanColors[vertexIndex + 2] = lightColor - (lightColor * ray1.l);
    }
 
-   //cast ray to vertices
-   for (S32 l = 0; l < verts.size(); l++)
+   // Submit in batch-sized runs.
+   TextureHandle noTexture;
+   const U32 maxRunVertexCount = (BATCHRENDER_MAXTRIANGLES / 3) * 3;
+   for (U32 runStart = 0; runStart < vertexCount; runStart += maxRunVertexCount)
    {
-      F32 rayLength = radius;
-      Vector2 p1 = worldPos;
-      Vector2 p2 = verts[l];
-      F32 baseAng = mAtan(p2.x, p2.y);
-      F32 cAng = 0;
-      for (int m = 0; m < 2; m++)
-      {
-         if (m == 0)cAng = baseAng - 0.0001f;
-         //if (m == 1)cAng = baseAng;
-         if (m == 1)cAng = baseAng + 0.0001f;
-
-         p2.x = rayLength * mCos(cAng);
-         p2.y = rayLength * mSin(cAng);
-
-         RaysCastCallback callback;
-         mWorld->RayCast(&callback, p1, p2);
-         if (callback.m_fixture)
-         {
-
-            F32 ang = mAtan(callback.m_point.x - p1.x, callback.m_point.y - p1.y);
-            Vector2 intersection = p1 + callback.m_fraction * (p2 - p1);
-            
-            RayList intersectionPoint;
-            intersectionPoint.ang = ang;
-            intersectionPoint.x = intersection.x;
-            intersectionPoint.y = intersection.y;
-            intersectionPoint.l = callback.m_fraction;
-
-
-            bList.push_back_unique(intersectionPoint);
-
-         }
-         else
-         {
-            F32 ang = mAtan(p2.x - p1.x, p2.y - p1.y);
-
-            RayList intersectionPoint;
-            intersectionPoint.ang = ang;
-            intersectionPoint.x = p2.x;
-            intersectionPoint.y = p2.y;
-            intersectionPoint.l = 1.0;
-
-            bList.push_back_unique(intersectionPoint);
-         }
-      }
+      const U32 runVertexCount = getMin(maxRunVertexCount, vertexCount - runStart);
+      batchRender->SubmitTriangles(runVertexCount, mFanVertices.address() + runStart, mFanTextureCoords.address(), mFanColors.address() + runStart, noTexture);
    }
+}
+
+//----------------------------------------------------------------------------
 
-   //Con::printf("Rays cast: %i", bList.size());
-   //sort the list
-   if (bList.size() > 1)
+bool LightObject::gatherOccluders(void)
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(LightObject_GatherOccluders);
+
+   const Vector2 worldPos = getPosition();
+   const F32 radius = getLightRadius();
+
+   // Find the fixtures whose bounds overlap the light using the broad-phase.
+   mQueryFixtures.clear();
+   OccluderQueryCallback queryCallback(getBody(), mQueryFixtures);
+   b2AABB lightAABB;
+   lightAABB.lowerBound.Set(worldPos.x - radius, worldPos.y - radius);
+   lightAABB.upperBound.Set(worldPos.x + radius, worldPos.y + radius);
+   getScene()->getWorld()->QueryAABB(&queryCallback, lightAABB);
+
+   // Record where each occluder is.
+   // NOTE: Sorting keeps the comparison independent of the broad-phase traversal order.
+   mQueryOccluders.setSize(mQueryFixtures.size());
+   for (S32 i = 0; i < mQueryFixtures.size(); i++)
+   {
+      b2Body* pBody = mQueryFixtures[i]->GetBody();
+      ShadowOccluder& occluder = mQueryOccluders[i];
+      occluder.mpFixture = mQueryFixtures[i];
+      occluder.mPosition = pBody->GetPosition();
+      occluder.mAngle = pBody->GetAngle();
+   }
+   if (mQueryOccluders.size() > 1)
+      dQsort(mQueryOccluders.address(), mQueryOccluders.size(), sizeof(ShadowOccluder), sortOccluders);
+
+   // Is the cached geometry still valid?
+   bool shadowValid =
+      mShadowValid &&
+      mShadowPosition == worldPos &&
+      mShadowRadius == radius &&
+      mShadowSegments == getLightSegments() &&
+      mShadowOccluders.size() == mQueryOccluders.size();
+
+   for (S32 i = 0; shadowValid && i < mQueryOccluders.size(); i++)
    {
-      dQsort(bList.address(), bList.size(), sizeof(RayList), sortRays);
+      if (mShadowOccluders[i] != mQueryOccluders[i])
+         shadowValid = false;
    }
 
-   
+   if (shadowValid)
+      return false;
+
+   // No, so note what it will be rebuilt against.
+   mShadowValid = true;
+   mShadowPosition = worldPos;
+   mShadowRadius = radius;
+   mShadowSegments = getLightSegments();
+   mShadowOccluders = mQueryOccluders;
+   return true;
+}
+
+//----------------------------------------------------------------------------
 
-   //triangle fan
-   for (S32 m = 0; m < bList.size(); m++)
+void LightObject::buildShadowRays(void)
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(LightObject_BuildShadowRays);
+
+   mShadowRebuildCount++;
+   mShadowRays.clear();
+
+   const Vector2 worldPos = getPosition();
+   const F32 radius = getLightRadius();
+   b2World* pWorld = getScene()->getWorld();
+
+   // Aim at the light edge.
+   const U32 lightSeg = getLightSegments();
+   const F32 segAng = lightSeg > 0 ? M_2PI_F / lightSeg : M_2PI_F;
+   Vector<F32> rayAngles;
+   for (U32 i = 0; i < getMax(lightSeg, (U32)1); i++)
+      rayAngles.push_back(segAng * i);
+
+   // Aim either side of every occluder vertex.
+   // NOTE: Only polygons contribute vertices, other shapes are caught by the edge rays.
+   for (S32 i = 0; i < mShadowOccluders.size(); i++)
    {
-      glColor4f(mLightColor.red - (mLightColor.red * bList[m].l), mLightColor.green - (mLightColor.green * bList[m].l), mLightColor.blue - (mLightColor.blue * bList[m].l), mLightColor.alpha - (mLightColor.alpha * bList[m].l));
-      glVertex2f(bList[m].x, bList[m].y);
+      const b2Fixture* pFixture = mShadowOccluders[i].mpFixture;
+      if (pFixture->GetType() != b2Shape::e_polygon)
+         continue;
+
+      const b2Body* pBody = pFixture->GetBody();
+      const b2PolygonShape* pShape = static_cast<const b2PolygonShape*>(pFixture->GetShape());
 
+      for (S32 k = 0; k < pShape->GetVertexCount(); k++)
+      {
+         const b2Vec2 wPoint = pBody->GetWorldPoint(pShape->GetVertex(k));
+         const F32 baseAng = mAtan(wPoint.x - worldPos.x, wPoint.y - worldPos.y);
+         rayAngles.push_back(baseAng - 0.0001f);
+         rayAngles.push_back(baseAng + 0.0001f);
+      }
    }
-   //close off the circle
-   glColor4f(mLightColor.red - (mLightColor.red * bList[0].l), mLightColor.green - (mLightColor.green * bList[0].l), mLightColor.blue - (mLightColor.blue * bList[0].l), mLightColor.alpha - (mLightColor.alpha * bList[0].l));
-   glVertex2f(bList[0].x, bList[0].y);
 
-   glDisable(GL_BLEND);
+   // Cast the rays.
+   for (S32 i = 0; i < rayAngles.size(); i++)
+   {
+      const F32 cAng = rayAngles[i];
+      const b2Vec2 p1 = worldPos;
+      const b2Vec2 p2(p1.x + radius * mCos(cAng), p1.y + radius * mSin(cAng));
+
+      RaysCastCallback callback(getBody());
+      pWorld->RayCast(&callback, p1, p2);
+
+      RayList ray;
+      ray.l = callback.m_fixture ? callback.m_fraction : 1.0f;
+      ray.x = (p2.x - p1.x) * ray.l;
+      ray.y = (p2.y - p1.y) * ray.l;
+      ray.ang = mAtan(ray.x, ray.y);
+      mShadowRays.push_back(ray);
+   }
 
-   glEnd();
+   // Sort the rays around the light.
+   if (mShadowRays.size() > 1)
+   {
+      dQsort(mShadowRays.address(), mShadowRays.size(), sizeof(RayList), sortRays);
+   }
 
-   glPopMatrix();
+   // Drop coincident neighbours.
+   S32 uniqueCount = 0;
+   for (S32 i = 0; i < mShadowRays.size(); i++)
+   {
+      if (uniqueCount == 0 || !(mShadowRays[i] == mShadowRays[uniqueCount - 1]))
+         mShadowRays[uniqueCount++] = mShadowRays[i];
+   }
+   mShadowRays.setSize(uniqueCount);
 }
 
+//----------------------------------------------------------------------------
+
 void LightObject::OnRegisterScene(Scene* mScene)
 {
    Parent::OnRegisterScene(mScene);
+   invalidateShadows();
    mScene->getWorldQuery()->addAlwaysInScope(this);
 
 }
@@ -237,3 +283,20 @@ S32 QSORT_CALLBACK sortRays(const void* a, const void* b)
    return 0;
 
 }
+
+S32 QSORT_CALLBACK LightObject::sortOccluders(const void* a, const void* b)
+{
+   const b2Fixture* fixture_a = ((const ShadowOccluder*)a)->mpFixture;
+   const b2Fixture* fixture_b = ((const ShadowOccluder*)b)->mpFixture;
+
+   if (fixture_a < fixture_b)
+   {
+      return -1;
+   }
+   else if (fixture_a > fixture_b)
+   {
+      return 1;
+   }
+
+   return 0;
+}
@@ -21,9 +21,13 @@ class RaysCastCallback : public b2RayCastCallback
 {
 public:
 
-   RaysCastCallback() : m_fixture(NULL) {}
+   RaysCastCallback(b2Body* ignoreBody = NULL) : m_ignoreBody(ignoreBody), m_fixture(NULL) {}
 
    float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) {
+      // Ignore the light's own shapes.
+      if (fixture->GetBody() == m_ignoreBody)
+         return -1.0f;
+
       m_fixture = fixture;
       m_point = point;
       m_normal = normal;
@@ -31,6 +35,7 @@ public:
       return fraction;
    }
 
+   b2Body* m_ignoreBody;
    b2Fixture* m_fixture;
    b2Vec2 m_point;
    b2Vec2 m_normal;
@@ -38,6 +43,24 @@ public:
 
 };
 
+class OccluderQueryCallback : public b2QueryCallback
+{
+public:
+
+   OccluderQueryCallback(b2Body* ignoreBody, Vector<b2Fixture*>& fixtures) : m_ignoreBody(ignoreBody), m_fixtures(fixtures) {}
+
+   bool ReportFixture(b2Fixture* fixture) {
+      // Every fixture can block rays so all of them key the shadow cache.
+      if (fixture->GetBody() != m_ignoreBody)
+         m_fixtures.push_back(fixture);
+      return true;
+   }
+
+   b2Body* m_ignoreBody;
+   Vector<b2Fixture*>& m_fixtures;
+
+};
+
 class LightObject : public SceneObject
 
 {
@@ -45,9 +68,36 @@ class LightObject : public SceneObject
 
 protected:
 
+   /// Occluder state the cached shadow geometry was built against.
+   struct ShadowOccluder
+   {
+      b2Fixture*  mpFixture;
+      b2Vec2      mPosition;
+      F32         mAngle;
+
+      bool operator == (const ShadowOccluder& occluder) const { return mpFixture == occluder.mpFixture && mPosition == occluder.mPosition && mAngle == occluder.mAngle; }
+      bool operator != (const ShadowOccluder& occluder) const { return !(*this == occluder); }
+   };
+
    F32                     mLightRadius;
    U32                     mLightSegments;
 
+   /// Cached shadow geometry.
+   bool                    mShadowValid;
+   Vector2                 mShadowPosition;
+   F32                     mShadowRadius;
+   U32                     mShadowSegments;
+   Vector<ShadowOccluder>  mShadowOccluders;
+   Vector<RayList>         mShadowRays;
+   U32                     mShadowRebuildCount;
+
+   /// Scratch storage reused each frame.
+   Vector<b2Fixture*>      mQueryFixtures;
+   Vector<ShadowOccluder>  mQueryOccluders;
+   Vector<Vector2>         mFanVertices;
+   Vector<Vector2>         mFanTextureCoords;
+   Vector<ColorF>          mFanColors;
+
 public:
 
    LightObject();
@@ -73,6 +123,10 @@ public:
    inline void setLightRadius(const F32 lightRadius) { mLightRadius = lightRadius; }
    inline F32 getLightRadius(void) const { return mLightRadius; }
 
+   /// Shadow cache.
+   inline void invalidateShadows(void) { mShadowValid = false; }
+   inline U32 getShadowRebuildCount(void) const { return mShadowRebuildCount; }
+
    DECLARE_CONOBJECT(LightObject);
 
 
@@ -81,6 +135,10 @@ protected:
    virtual void OnRegisterScene(Scene* mScene);
    virtual void OnUnregisterScene(Scene* mScene);
 
+   bool gatherOccluders(void);
+   void buildShadowRays(void);
+   static S32 QSORT_CALLBACK sortOccluders(const void* a, const void* b);
+
 protected:
 
    static bool setLightRadius(void* obj, const char* data) { static_cast<LightObject*>(obj)->setLightRadius(dAtof(data)); return false; }
@@ -49,4 +49,13 @@ ConsoleMethodWithDocs(LightObject, getLightSegments, ConsoleInt, 2, 2, ())
 {
    // Return Layer.
    return object->getLightSegments();
-}
\ No newline at end of file
+}
+
+/*! Gets how many times the light has rebuilt its shadow geometry.
+    The geometry is only rebuilt when the light or an occluder within its radius changes.
+    @return The shadow rebuild count.
+*/
+ConsoleMethodWithDocs(LightObject, getShadowRebuildCount, ConsoleInt, 2, 2, ())
+{
+   return object->getShadowRebuildCount();
+}
@@ -28,42 +28,49 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+static inline void calculateParticleOOBB( ParticleSystem::ParticleStore& particleStore, const U32 particleIndex, const Vector2* pLocalAABB, const F32 positionX, const F32 positionY )
+{
+    // Fetch the render size and rotation.
+    const F32 renderSizeX = particleStore.mRenderSizeX[particleIndex];
+    const F32 renderSizeY = particleStore.mRenderSizeY[particleIndex];
+    const F32 rotationSin = particleStore.mRotationSin[particleIndex];
+    const F32 rotationCos = particleStore.mRotationCos[particleIndex];
+
+    // Transform the scaled local AABB into the world OOBB.
+    for ( U32 corner = 0; corner < 4; ++corner )
+    {
+        const F32 localX = pLocalAABB[corner].x * renderSizeX;
+        const F32 localY = pLocalAABB[corner].y * renderSizeY;
+        particleStore.mRenderOOBBX[corner][particleIndex] = (rotationCos * localX - rotationSin * localY) + positionX;
+        particleStore.mRenderOOBBY[corner][particleIndex] = (rotationSin * localX + rotationCos * localY) + positionY;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticlePlayer::EmitterNode::createParticle( void )
 {
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
   
-    // Fetch a free node,
-    ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
-
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Append a particle to the emitter store.
+    const U32 particleIndex = mParticleStore.createParticle();
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Configure the particle.
+    mOwner->configureParticle( this, particleIndex );
 
-    return pFreeParticleNode;
+    return particleIndex;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::EmitterNode::freeParticles( const U32* pParticleIndices, const U32 particleIndexCount )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
-
-    // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticles() - Cannot free particles with a NULL owner." );
 
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    // Free the particles.
+    mParticleStore.freeParticles( pParticleIndices, particleIndexCount );
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +80,8 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
-    // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
-    {
-        freeParticle( mParticleNodeHead.mNextNode );
-    }
+    // Free all the particles.
+    mParticleStore.freeAllParticles();
 }
 
 //------------------------------------------------------------------------------
@@ -299,42 +303,41 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             // Fetch the asset emitter.
             ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+            // Fetch the particle store.
+            ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+            // Fetch the single-particle mode.
+            const bool singleParticle = pParticleAssetEmitter->getSingleParticle();
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
+            // Age all the particles and find those that have expired.
+            mExpiredParticles.clear();
+            const U32 particleCount = particleStore.getCount();
+            F32* pParticleAge = particleStore.mParticleAge;
+            const F32* pParticleLifetime = particleStore.mParticleLifetime;
+            for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
             {
                 // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+                pParticleAge[particleIndex] += scaledTime;
 
                 // Has the particle expired?
                 // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
+                if (    ( !singleParticle && pParticleAge[particleIndex] > pParticleLifetime[particleIndex] ) ||
+                        ( mIsZero(pParticleLifetime[particleIndex]) ) )
                 {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
-
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
+                    // Yes, so note it.
+                    mExpiredParticles.push_back( particleIndex );
                 }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
+            }
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+            // Kill the expired particles.
+            pEmitterNode->freeParticles( mExpiredParticles.address(), (U32)mExpiredParticles.size() );
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+            // Integrate the surviving particles.
+            integrateParticles( pEmitterNode, scaledTime );
+            const U32 survivingParticleCount = particleStore.getCount();
+
+            // Only count particles when not in single-particle mode.
+            activeParticleCount += survivingParticleCount;
 
             // Skip generating new particles if the emitter is paused.
             if ( pEmitterNode->getPaused() )
@@ -344,7 +347,7 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             if ( pParticleAssetEmitter->getSingleParticle() )
             {
                 // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
+                if ( !pEmitterNode->getActiveParticles() )
                 {
                     // No, so generate a single particle.
                     pEmitterNode->createParticle();
@@ -475,45 +478,29 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle store.
+        ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
 
         // Fetch the asset emitter.
         ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
         // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        const Vector2 localAABB[4] = {  pParticleAssetEmitter->getLocalPivotAABB0(),
+                                        pParticleAssetEmitter->getLocalPivotAABB1(),
+                                        pParticleAssetEmitter->getLocalPivotAABB2(),
+                                        pParticleAssetEmitter->getLocalPivotAABB3() };
+
+        // Process all particles.
+        const F32 postTimeDelta = 1.0f - timeDelta;
+        const U32 particleCount = particleStore.getCount();
+        for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
         {
             // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+            const F32 renderTickPositionX = (timeDelta * particleStore.mPreTickPositionX[particleIndex]) + (postTimeDelta * particleStore.mPostTickPositionX[particleIndex]);
+            const F32 renderTickPositionY = (timeDelta * particleStore.mPreTickPositionY[particleIndex]) + (postTimeDelta * particleStore.mPostTickPositionY[particleIndex]);
 
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
+            // Calculate the world OOBB.
+            calculateParticleOOBB( particleStore, particleIndex, localAABB, renderTickPositionX, renderTickPositionY );
         }
     }
 }
@@ -619,17 +606,20 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particle store.
+        const ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle render order.
+        // NOTE:    Particles are stored oldest first so the oldest particles are in front when rendered last.
+        const U32 particleCount = particleStore.getCount();
+        const S32 particleStep = oldestInFront ? -1 : 1;
+        U32 particleIndex = oldestInFront ? particleCount-1 : 0;
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( U32 n = 0; n < particleCount; ++n, particleIndex += particleStep )
         {
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = particleStore.mFrameProviders[particleIndex]->mFrameProvider;
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -637,29 +627,23 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             // Frame texture.
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
-            // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
-
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
             const Vector2& texUpper = texelFrameArea.mTexelUpper;
 
             // Submit batched quad.
             pBatchRenderer->SubmitQuad(
-                renderOOBB[0],
-                renderOOBB[1],
-                renderOOBB[2],
-                renderOOBB[3],
+                Vector2( particleStore.mRenderOOBBX[0][particleIndex], particleStore.mRenderOOBBY[0][particleIndex] ),
+                Vector2( particleStore.mRenderOOBBX[1][particleIndex], particleStore.mRenderOOBBY[1][particleIndex] ),
+                Vector2( particleStore.mRenderOOBBX[2][particleIndex], particleStore.mRenderOOBBY[2][particleIndex] ),
+                Vector2( particleStore.mRenderOOBBX[3][particleIndex], particleStore.mRenderOOBBY[3][particleIndex] ),
                 Vector2( texLower.x, texUpper.y ),
                 Vector2( texUpper.x, texUpper.y ),
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                ColorF( particleStore.mColorRed[particleIndex], particleStore.mColorGreen[particleIndex], particleStore.mColorBlue[particleIndex], particleStore.mColorAlpha[particleIndex] ) );
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -877,7 +861,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -885,15 +869,18 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
+
+    // Default the particle position.
+    Vector2 particlePosition( 0.0f, 0.0f );
+
 
     // **********************************************************************************************************************
     // Calculate Particle Position.
@@ -913,11 +900,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            particlePosition = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            particlePosition = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +919,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    particlePosition = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    particlePosition = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -952,14 +939,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -975,14 +962,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1008,14 +995,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1030,14 +1017,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1065,12 +1052,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    particlePosition = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    particlePosition = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1084,39 +1071,40 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
-                                                                                pParticleAssetEmitter->getParticleLifeVariationField(),
-                                                                                pParticleAsset->getParticleLifeScaleField(),
-                                                                                particlePlayerAge );
+    particleStore.mParticleAge[particleIndex] = 0.0f;
+    particleStore.mParticleLifetime[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getParticleLifeBaseField(),
+                                                                                            pParticleAssetEmitter->getParticleLifeVariationField(),
+                                                                                            pParticleAsset->getParticleLifeScaleField(),
+                                                                                            particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
-                                                                    pParticleAssetEmitter->getSizeXVariationField(),
-                                                                    pParticleAsset->getSizeXScaleField(),
-                                                                    particlePlayerAge ) * getSizeScale();
+    particleStore.mSizeX[particleIndex] = ParticleAssetField::calculateFieldBVE(    pParticleAssetEmitter->getSizeXBaseField(),
+                                                                                    pParticleAssetEmitter->getSizeXVariationField(),
+                                                                                    pParticleAsset->getSizeXScaleField(),
+                                                                                    particlePlayerAge ) * getSizeScale();
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        particleStore.mSizeY[particleIndex] = particleStore.mSizeX[particleIndex];
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
-                                                                        pParticleAssetEmitter->getSizeYVariationField(),
-                                                                        pParticleAsset->getSizeYScaleField(),
-                                                                        particlePlayerAge ) * getSizeScale();
+        particleStore.mSizeY[particleIndex] = ParticleAssetField::calculateFieldBVE(    pParticleAssetEmitter->getSizeYBaseField(),
+                                                                                        pParticleAssetEmitter->getSizeYVariationField(),
+                                                                                        pParticleAsset->getSizeYScaleField(),
+                                                                                        particlePlayerAge ) * getSizeScale();
     }
 
     // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
+    particleStore.mRenderSizeX[particleIndex] = -1.0f;
+    particleStore.mRenderSizeY[particleIndex] = -1.0f;
 
 
     // **********************************************************************************************************************
@@ -1128,18 +1116,24 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     F32 emissionAngle = 0;
     F32 emissionArc = 0;
 
+    // Reset the motion in-case we're using single-particle mode.
+    particleStore.mSpeed[particleIndex] = 0.0f;
+    particleStore.mRandomMotion[particleIndex] = 0.0f;
+    particleStore.mVelocityX[particleIndex] = 0.0f;
+    particleStore.mVelocityY[particleIndex] = 0.0f;
+
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
-                                                                        pParticleAssetEmitter->getSpeedVariationField(),
-                                                                        pParticleAsset->getSpeedScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+        particleStore.mSpeed[particleIndex] = ParticleAssetField::calculateFieldBVE(    pParticleAssetEmitter->getSpeedBaseField(),
+                                                                                        pParticleAssetEmitter->getSpeedVariationField(),
+                                                                                        pParticleAsset->getSpeedScaleField(),
+                                                                                        particlePlayerAge ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
-                                                                                pParticleAssetEmitter->getRandomMotionVariationField(),
-                                                                                pParticleAsset->getRandomMotionScaleField(),
-                                                                                particlePlayerAge ) * getForceScale();
+        particleStore.mRandomMotion[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getRandomMotionBaseField(),
+                                                                                            pParticleAssetEmitter->getRandomMotionVariationField(),
+                                                                                            pParticleAsset->getRandomMotionScaleField(),
+                                                                                            particlePlayerAge ) * getForceScale();
 
 
         //  Calculate the emission force.
@@ -1150,7 +1144,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         if (pParticleAssetEmitter->getIsTargeting())
         {
            Vector2 tPos = pParticleAssetEmitter->getTargetPosition();
-           Vector2 pPos = pParticleNode->mPosition;
+           Vector2 pPos = particlePosition;
            Vector2 subVec = tPos - pPos;
            F32 vecN = mAtan(subVec.x, subVec.y);
            F32 vecDeg = mRadToDeg(vecN);
@@ -1182,7 +1176,8 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particleStore.mVelocityX[particleIndex] = emissionForce * mCos( emissionAngleRadians );
+        particleStore.mVelocityY[particleIndex] = emissionForce * mSin( emissionAngleRadians );
     }
 
 
@@ -1190,26 +1185,29 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
-                                                                    pParticleAssetEmitter->getSpinVariationField(),
-                                                                    pParticleAsset->getSpinScaleField(),
-                                                                    particlePlayerAge );
+    particleStore.mSpin[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSpinBaseField(),
+                                                                                pParticleAssetEmitter->getSpinVariationField(),
+                                                                                pParticleAsset->getSpinScaleField(),
+                                                                                particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
-                                                                        pParticleAssetEmitter->getFixedForceVariationField(),
-                                                                        pParticleAsset->getFixedForceScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+    particleStore.mFixedForce[particleIndex] = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getFixedForceBaseField(),
+                                                                                        pParticleAssetEmitter->getFixedForceVariationField(),
+                                                                                        pParticleAsset->getFixedForceScaleField(),
+                                                                                        particlePlayerAge ) * getForceScale();
 
 
     // **********************************************************************************************************************
     // Calculate Orientation Angle.
     // **********************************************************************************************************************
 
+    // Default the particle orientation.
+    particleStore.mOrientationAngle[particleIndex] = 0.0f;
+
     // Configure particle orientation.
     switch( pParticleAssetEmitter->getOrientationType() )
     {
@@ -1217,7 +1215,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            particleStore.mOrientationAngle[particleIndex] = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1225,7 +1223,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            particleStore.mOrientationAngle[particleIndex] = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1234,7 +1232,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            particleStore.mOrientationAngle[particleIndex] = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1254,10 +1252,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particleStore.mColorRed[particleIndex] = mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() );
+    particleStore.mColorGreen[particleIndex] = mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() );
+    particleStore.mColorBlue[particleIndex] = mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() );
+    particleStore.mColorAlpha[particleIndex] = mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1265,7 +1263,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Fetch the image frame provider.
-    ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+    ImageFrameProviderCore& frameProvider = particleStore.mFrameProviders[particleIndex]->mFrameProvider;
 
     // Allocate assets to the particle.
     frameProvider.allocateAssets( &(pParticleAssetEmitter->getImageAsset()), &(pParticleAssetEmitter->getAnimationAsset()) );
@@ -1302,20 +1300,21 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
 
     // **********************************************************************************************************************
-    // Reset Tick Position.
+    // Set Position and Reset Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
+    particleStore.mPositionX[particleIndex] = particleStore.mPreTickPositionX[particleIndex] = particleStore.mPostTickPositionX[particleIndex] = particlePosition.x;
+    particleStore.mPositionY[particleIndex] = particleStore.mPreTickPositionY[particleIndex] = particleStore.mPostTickPositionY[particleIndex] = particlePosition.y;
 
 
     // **********************************************************************************************************************
     // Do a Single Particle Integration to get things going.
     // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    integrateParticle( pEmitterNode, particleIndex, 0.0f, 0.0f );
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime )
 {
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
@@ -1323,11 +1322,15 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
+
 
     // **********************************************************************************************************************
     // Copy Old Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    particleStore.mPreTickPositionX[particleIndex] = particleStore.mPostTickPositionX[particleIndex];
+    particleStore.mPreTickPositionY[particleIndex] = particleStore.mPostTickPositionY[particleIndex];
 
 
     // **********************************************************************************************************************
@@ -1335,47 +1338,47 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    particleStore.mRenderSizeX[particleIndex] = mClampF(    particleStore.mSizeX[particleIndex] * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
+                                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
+                                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
+        particleStore.mRenderSizeY[particleIndex] = particleStore.mRenderSizeX[particleIndex];
     }
     else
     {
         // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+        particleStore.mRenderSizeY[particleIndex] = mClampF(    particleStore.mSizeY[particleIndex] * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
+                                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
+                                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
     }
 
 
     // **********************************************************************************************************************
     // Scale Speed.
     // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
+    particleStore.mRenderSpeed[particleIndex] = mClampF(    particleStore.mSpeed[particleIndex] * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
+                                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
+                                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
     // Scale Fixed-Force.
     // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
+    particleStore.mRenderFixedForce[particleIndex] = mClampF(   particleStore.mFixedForce[particleIndex] * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
+                                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
+                                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
     // Scale Random-Motion.
     // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
+    particleStore.mRenderRandomMotion[particleIndex] = mClampF( particleStore.mRandomMotion[particleIndex] * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
+                                                                pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
+                                                                pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1390,10 +1393,10 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particleStore.mColorRed[particleIndex] = mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() );
+    particleStore.mColorGreen[particleIndex] = mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() );
+    particleStore.mColorBlue[particleIndex] = mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() );
+    particleStore.mColorAlpha[particleIndex] = mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1405,7 +1408,7 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
         // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        particleStore.mFrameProviders[particleIndex]->mFrameProvider.updateAnimation( elapsedTime );
     }
 
 
@@ -1417,28 +1420,29 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
         // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
+        if ( mNotZero( particleStore.mRenderRandomMotion[particleIndex] ) )
         {
             // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
+            const F32 randomMotion = particleStore.mRenderRandomMotion[particleIndex] * 0.5f;
 
             // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
+            particleStore.mVelocityX[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+            particleStore.mVelocityY[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
         }
 
         // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
+        if ( mNotZero( particleStore.mRenderFixedForce[particleIndex] ) )
         {
             // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            const Vector2 fixedForce = pParticleAssetEmitter->getFixedForceDirection() * (particleStore.mRenderFixedForce[particleIndex] * getForceScale()) * elapsedTime;
+            particleStore.mVelocityX[particleIndex] += fixedForce.x;
+            particleStore.mVelocityY[particleIndex] += fixedForce.y;
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
-        {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
-        }
+        // Adjust particle position.
+        const F32 displacementScale = particleStore.mRenderSpeed[particleIndex] * elapsedTime;
+        particleStore.mPositionX[particleIndex] += particleStore.mVelocityX[particleIndex] * displacementScale;
+        particleStore.mPositionY[particleIndex] += particleStore.mVelocityY[particleIndex] * displacementScale;
     }
 
 
@@ -1448,59 +1452,221 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
     {
         // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        F32 movementAngle = mRadToDeg( mAtan( particleStore.mVelocityX[particleIndex], particleStore.mVelocityY[particleIndex] ) );
 
         // Adjust for negative ArcTan quadrants.
         if ( movementAngle < 0.0f )
             movementAngle += 360.0f;
 
         // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+        particleStore.mOrientationAngle[particleIndex] = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
 
     }
     else
     {
         // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
+        const F32 renderSpin = particleStore.mSpin[particleIndex] * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
 
         // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
+        if ( mNotZero(renderSpin) )
         {
             // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
+            particleStore.mOrientationAngle[particleIndex] += renderSpin * elapsedTime;
 
             // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
+            particleStore.mOrientationAngle[particleIndex] = mFmod( particleStore.mOrientationAngle[particleIndex], 360.0f );
         }
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
+    // Calculate the rotation.
+    const b2Rot rotation( mDegToRad(particleStore.mOrientationAngle[particleIndex]) );
+    particleStore.mRotationSin[particleIndex] = rotation.s;
+    particleStore.mRotationCos[particleIndex] = rotation.c;
 
     // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
-
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
+    const Vector2 localAABB[4] = {  pParticleAssetEmitter->getLocalPivotAABB0(),
+                                    pParticleAssetEmitter->getLocalPivotAABB1(),
+                                    pParticleAssetEmitter->getLocalPivotAABB2(),
+                                    pParticleAssetEmitter->getLocalPivotAABB3() };
 
     // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+    calculateParticleOOBB( particleStore, particleIndex, localAABB, particleStore.mPositionX[particleIndex], particleStore.mPositionY[particleIndex] );
 
 
     // **********************************************************************************************************************
     // Set Post Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+    particleStore.mPostTickPositionX[particleIndex] = particleStore.mPositionX[particleIndex];
+    particleStore.mPostTickPositionY[particleIndex] = particleStore.mPositionY[particleIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const F32 elapsedTime )
+{
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particleStore = pEmitterNode->getParticleStore();
+
+    // Finish if there are no particles.
+    const U32 particleCount = particleStore.getCount();
+    if ( particleCount == 0 )
+        return;
+
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
+
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+
+    // Fetch the life fields.
+    const ParticleAssetField& sizeXLifeField = pParticleAssetEmitter->getSizeXLifeField();
+    const ParticleAssetField& sizeYLifeField = pParticleAssetEmitter->getSizeYLifeField();
+    const ParticleAssetField& speedLifeField = pParticleAssetEmitter->getSpeedLifeField();
+    const ParticleAssetField& fixedForceLifeField = pParticleAssetEmitter->getFixedForceLifeField();
+    const ParticleAssetField& randomMotionLifeField = pParticleAssetEmitter->getRandomMotionLifeField();
+    const ParticleAssetField& spinLifeField = pParticleAssetEmitter->getSpinLifeField();
+    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
+    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
+    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
+    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
+
+    // Fetch the emitter modes.
+    const bool fixedAspect = pParticleAssetEmitter->getFixedAspect();
+    const bool singleParticle = pParticleAssetEmitter->getSingleParticle();
+    const bool staticFrameProvider = pParticleAssetEmitter->isStaticFrameProvider();
+    const bool keepAligned = pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION;
+    const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
+
+    // Configure the integrator.
+    ParticleIntegrator::Parameters parameters;
+    parameters.mElapsedTime = elapsedTime;
+    parameters.mForceScale = getForceScale();
+    parameters.mFixedAspect = fixedAspect;
+    parameters.mSingleParticle = singleParticle;
+    parameters.mFixedForceDirection = pParticleAssetEmitter->getFixedForceDirection();
+    parameters.mLocalAABB[0] = pParticleAssetEmitter->getLocalPivotAABB0();
+    parameters.mLocalAABB[1] = pParticleAssetEmitter->getLocalPivotAABB1();
+    parameters.mLocalAABB[2] = pParticleAssetEmitter->getLocalPivotAABB2();
+    parameters.mLocalAABB[3] = pParticleAssetEmitter->getLocalPivotAABB3();
+    parameters.mSizeXMin = pParticleAssetEmitter->getSizeXBaseField().getMinValue();
+    parameters.mSizeXMax = pParticleAssetEmitter->getSizeXBaseField().getMaxValue();
+    parameters.mSizeYMin = pParticleAssetEmitter->getSizeYBaseField().getMinValue();
+    parameters.mSizeYMax = pParticleAssetEmitter->getSizeYBaseField().getMaxValue();
+    parameters.mSpeedMin = pParticleAssetEmitter->getSpeedBaseField().getMinValue();
+    parameters.mSpeedMax = pParticleAssetEmitter->getSpeedBaseField().getMaxValue();
+    parameters.mFixedForceMin = pParticleAssetEmitter->getFixedForceBaseField().getMinValue();
+    parameters.mFixedForceMax = pParticleAssetEmitter->getFixedForceBaseField().getMaxValue();
+    parameters.mRandomMotionMin = pParticleAssetEmitter->getRandomMotionBaseField().getMinValue();
+    parameters.mRandomMotionMax = pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue();
+    parameters.mRedMin = redChannel.getMinValue();
+    parameters.mRedMax = redChannel.getMaxValue();
+    parameters.mGreenMin = greenChannel.getMinValue();
+    parameters.mGreenMax = greenChannel.getMaxValue();
+    parameters.mBlueMin = blueChannel.getMinValue();
+    parameters.mBlueMax = blueChannel.getMaxValue();
+    parameters.mAlphaMin = alphaChannel.getMinValue();
+    parameters.mAlphaMax = alphaChannel.getMaxValue();
+    parameters.mAlphaScale = pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f );
+
+    // Life samples for the current batch.
+    ParticleIntegrator::LifeSamples lifeSamples;
+
+    // Integrate the particles in batches.
+    for ( U32 batchStart = 0; batchStart < particleCount; batchStart += ParticleIntegrator::BATCH_SIZE )
+    {
+        const U32 batchCount = getMin( (U32)ParticleIntegrator::BATCH_SIZE, particleCount - batchStart );
+        const U32 batchEnd = batchStart + batchCount;
+
+        // Sample the life fields.
+        for ( U32 particleIndex = batchStart; particleIndex < batchEnd; ++particleIndex )
+        {
+            const U32 sampleIndex = particleIndex - batchStart;
+            const F32 particleAge = particleStore.mParticleAge[particleIndex] / particleStore.mParticleLifetime[particleIndex];
+
+            lifeSamples.mSizeX[sampleIndex] = sizeXLifeField.getFieldValue( particleAge );
+            lifeSamples.mSizeY[sampleIndex] = fixedAspect ? 0.0f : sizeYLifeField.getFieldValue( particleAge );
+            lifeSamples.mSpeed[sampleIndex] = speedLifeField.getFieldValue( particleAge );
+            lifeSamples.mFixedForce[sampleIndex] = fixedForceLifeField.getFieldValue( particleAge );
+            lifeSamples.mRandomMotion[sampleIndex] = randomMotionLifeField.getFieldValue( particleAge );
+            lifeSamples.mRed[sampleIndex] = redChannel.getFieldValue( particleAge );
+            lifeSamples.mGreen[sampleIndex] = greenChannel.getFieldValue( particleAge );
+            lifeSamples.mBlue[sampleIndex] = blueChannel.getFieldValue( particleAge );
+            lifeSamples.mAlpha[sampleIndex] = alphaChannel.getFieldValue( particleAge );
+        }
+
+        // Copy the tick position and scale the render properties.
+        ParticleIntegrator::integrateProperties( particleStore, lifeSamples, parameters, batchStart, batchCount );
+
+        // Update animation and add random motion.
+        if ( !staticFrameProvider || !singleParticle )
+        {
+            for ( U32 particleIndex = batchStart; particleIndex < batchEnd; ++particleIndex )
+            {
+                // Is the emitter in static mode?
+                if ( !staticFrameProvider )
+                {
+                    // No, so update animation.
+                    particleStore.mFrameProviders[particleIndex]->mFrameProvider.updateAnimation( elapsedTime );
+                }
+
+                // Calculate random motion (if we've got any and not a single particle).
+                if ( !singleParticle && mNotZero( particleStore.mRenderRandomMotion[particleIndex] ) )
+                {
+                    // Fetch random motion.
+                    const F32 randomMotion = particleStore.mRenderRandomMotion[particleIndex] * 0.5f;
+
+                    // Add time-integrated random motion into velocity.
+                    particleStore.mVelocityX[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+                    particleStore.mVelocityY[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+                }
+            }
+        }
+
+        // Apply the fixed force and move the particles if not a single particle.
+        if ( !singleParticle )
+            ParticleIntegrator::integrateMotion( particleStore, parameters, batchStart, batchCount );
+
+        // Calculate the orientation and rotation.
+        for ( U32 particleIndex = batchStart; particleIndex < batchEnd; ++particleIndex )
+        {
+            // Are we aligning to motion?
+            if ( keepAligned )
+            {
+                // Yes, so calculate last movement direction.
+                F32 movementAngle = mRadToDeg( mAtan( particleStore.mVelocityX[particleIndex], particleStore.mVelocityY[particleIndex] ) );
+
+                // Adjust for negative ArcTan quadrants.
+                if ( movementAngle < 0.0f )
+                    movementAngle += 360.0f;
+
+                // Set new Orientation Angle.
+                particleStore.mOrientationAngle[particleIndex] = movementAngle - alignedAngleOffset;
+            }
+            else
+            {
+                // No, so calculate the render spin.
+                const F32 renderSpin = particleStore.mSpin[particleIndex] * spinLifeField.getFieldValue( particleStore.mParticleAge[particleIndex] / particleStore.mParticleLifetime[particleIndex] );
+
+                // Have we got some Spin?
+                if ( mNotZero(renderSpin) )
+                {
+                    // Yes, so add into Orientation.
+                    particleStore.mOrientationAngle[particleIndex] += renderSpin * elapsedTime;
+
+                    // Clamp the orientation angle.
+                    particleStore.mOrientationAngle[particleIndex] = mFmod( particleStore.mOrientationAngle[particleIndex], 360.0f );
+                }
+            }
+
+            // Calculate the rotation.
+            const b2Rot rotation( mDegToRad(particleStore.mOrientationAngle[particleIndex]) );
+            particleStore.mRotationSin[particleIndex] = rotation.s;
+            particleStore.mRotationCos[particleIndex] = rotation.c;
+        }
+
+        // Calculate the world OOBB and set the post tick position.
+        ParticleIntegrator::integrateBounds( particleStore, parameters, batchStart, batchCount );
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -31,6 +31,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PARTICLE_INTEGRATOR_H_
+#include "2d/core/ParticleIntegrator.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PARTICLE_PLAYER_EMISSION_RATE_SCALE     "$pref::T2D::ParticlePlayerEmissionRateScale"
@@ -45,13 +49,14 @@ class ParticlePlayer : public SceneObject, protected AssetPtrCallback
 private:
     typedef SceneObject Parent;
 
+protected:
     /// Emitter node.
     class EmitterNode
     {
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleSystem::ParticleStore   mParticleStore;
         F32                             mTimeSinceLastGeneration;
         bool                            mPaused;
         bool                            mVisible;
@@ -77,9 +82,6 @@ private:
 
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
-
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
         }
 
         ~EmitterNode()
@@ -90,11 +92,10 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return mParticleStore.getCount() > 0; }
 
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        inline ParticleSystem::ParticleStore& getParticleStore( void ) { return mParticleStore; }
+        inline const ParticleSystem::ParticleStore& getParticleStore( void ) const { return mParticleStore; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
@@ -105,13 +106,14 @@ private:
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
+        U32 createParticle( void );
+        void freeParticles( const U32* pParticleIndices, const U32 particleIndexCount );
         void freeAllParticles( void );        
     };
 
     typedef Vector<EmitterNode*> typeEmitterVector;
 
+private:
     AssetPtr<ParticleAsset>     mParticleAsset;
     typeEmitterVector           mEmitters;
 
@@ -131,6 +133,8 @@ private:
     bool                        mWaitingForParticles;
     bool                        mWaitingForDelete;
 
+    Vector<U32>                 mExpiredParticles;
+
 public:
     ParticlePlayer();
     virtual ~ParticlePlayer();
@@ -142,6 +146,7 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void interpolateObject( const F32 timeDelta );
+    virtual bool getConcurrentTickAllowed( const Scene::TickStage tickStage ) const { return false; }
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
@@ -192,8 +197,9 @@ protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticle( EmitterNode* pEmitterNode, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime );
+    void integrateParticles( EmitterNode* pEmitterNode, const F32 elapsedTime );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
@@ -117,6 +117,8 @@ SceneObject::SceneObject() :
 
     /// Area.
 	mWorldProxyId(-1),
+    mWorldProxyUpdateDeferred(false),
+    mDeferredTickDisplacement( 0.0f, 0.0f ),
 
 	// Growing.
 	mGrowActive(false),
@@ -195,7 +197,12 @@ SceneObject::SceneObject() :
     mAlwaysInScope(false),
     mRotateToEventId(0),
     mSerialId(0),
-    mRenderGroup( StringTable->EmptyString )
+    mRenderGroup( StringTable->EmptyString ),
+
+    /// Render caching.
+    mRenderCacheStamp(0),
+    mRenderCacheIndex(0),
+    mRenderDirtyDeferred(false)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDestroyNotifyList );
@@ -395,6 +402,37 @@ void SceneObject::onDestroyNotify( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::onStaticModified( const char* slotName, const char* newValue )
+{
+    // Call parent.
+    Parent::onStaticModified( slotName, newValue );
+
+    // Any field can change what is rendered so flag the render as dirty.
+    setRenderDirty();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::setRenderDirty( void )
+{
+    // Finish if not in a scene.
+    if ( !mpScene )
+        return;
+
+    // Are we being integrated concurrently?
+    if ( mpScene->getConcurrentTickActive() )
+    {
+        // Yes, so defer flagging the scene layer as the layer render caches are not thread-safe.
+        mRenderDirtyDeferred = true;
+        return;
+    }
+
+    // Flag the scene layer as dirty so its render queue isn't reused.
+    mpScene->setLayerRenderDirty( mSceneLayer );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::OnRegisterScene( Scene* pScene )
 {
     // Sanity!
@@ -525,6 +563,9 @@ void SceneObject::resetTickSpatials( const bool resize )
     mPreTickPosition = mRenderPosition = getPosition();
     mPreTickAngle = mRenderAngle = getAngle();
 
+    // Flag render dirty.
+    setRenderDirty();
+
     // Fetch body transform.
     b2Transform bodyXform = getTransform();
 
@@ -620,9 +661,20 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
         // Calculate tick displacement.
         b2Vec2 tickDisplacement = position - mPreTickPosition;
-            
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+
+        // Are we being integrated concurrently?
+        if ( mpScene->getConcurrentTickActive() )
+        {
+            // Yes, so defer the world proxy update as the world query is not thread-safe.
+            mWorldProxyUpdateDeferred = true;
+            mDeferredTickAABB = tickAABB;
+            mDeferredTickDisplacement = tickDisplacement;
+        }
+        else
+        {
+            // No, so update world proxy.
+            mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        }
 
         //have we arrived at the target position?
         if (mTargetPositionActive)
@@ -741,6 +793,57 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::getConcurrentTickAllowed( const Scene::TickStage tickStage ) const
+{
+    // Audio sources and the script engine may only be touched on the main thread.
+    switch( tickStage )
+    {
+        case Scene::TICK_STAGE_PREINTEGRATE:
+            // Growing resizes the collision fixtures.
+            return !mGrowActive && mAudioHandles.size() == 0;
+
+        case Scene::TICK_STAGE_INTEGRATE:
+            // Target positions, lifetimes, GUI and cameras can perform callbacks or touch other objects.
+            return !mTargetPositionActive && !mLifetimeActive && mAttachedCtrls.size() == 0 && mpAttachedCamera == NULL && mAudioHandles.size() == 0;
+
+        case Scene::TICK_STAGE_POSTINTEGRATE:
+            // Only objects that cannot perform any callbacks.
+            return !hasComponents() && getBehaviorCount() == 0 && !mUpdateCallback && !mTargetPositionActive && !mFadeActive && !mGrowActive && !mSleepingCallback;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::updateDeferredWorldProxy( void )
+{
+    // Finish if no deferred update.
+    if ( !mWorldProxyUpdateDeferred )
+        return;
+
+    mWorldProxyUpdateDeferred = false;
+
+    // Update world proxy.
+    mpScene->getWorldQuery()->update( this, mDeferredTickAABB, mDeferredTickDisplacement );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::updateDeferredRenderDirty( void )
+{
+    // Finish if no deferred update.
+    if ( !mRenderDirtyDeferred )
+        return;
+
+    mRenderDirtyDeferred = false;
+
+    // Flag render dirty.
+    setRenderDirty();
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::interpolateObject( const F32 timeDelta )
 {
     // Debug Profiling.
@@ -751,6 +854,9 @@ void SceneObject::interpolateObject( const F32 timeDelta )
         // Debug Profiling.
         PROFILE_SCOPE(SceneObject_InterpolatePositionAngle);
 
+        // Flag render dirty.
+        setRenderDirty();
+
         if ( timeDelta < 1.0f )
         {
             // Calculate render position.
@@ -990,11 +1096,17 @@ void SceneObject::setSceneLayer( const U32 sceneLayer )
         return;
     }
 
+    // Flag the previous layer as render dirty.
+    setRenderDirty();
+
     // Set Layer.
     mSceneLayer = sceneLayer;
 
     // Set Layer Mask.
     mSceneLayerMask = BIT( mSceneLayer );
+
+    // Flag the new layer as render dirty.
+    setRenderDirty();
 }
 
 //-----------------------------------------------------------------------------
@@ -4350,6 +4462,9 @@ void SceneObject::updateBlendColor(const F32 elapsedTime)
 	mBlendColor.green = processEffect(mBlendColor.green, mTargetColor.green, mDeltaGreen * elapsedTime);
 	mBlendColor.blue = processEffect(mBlendColor.blue, mTargetColor.blue, mDeltaBlue * elapsedTime);
 	mBlendColor.alpha = processEffect(mBlendColor.alpha, mTargetColor.alpha, mDeltaAlpha * elapsedTime);
+
+	// Flag render dirty.
+	setRenderDirty();
 }
 
 //-----------------------------------------------------------------------------
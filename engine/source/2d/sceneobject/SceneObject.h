@@ -152,6 +152,9 @@ protected:
     Vector2                 mLocalSizeOOBB[4];
     Vector2                 mRenderOOBB[4];
 	S32                     mWorldProxyId;
+    bool                    mWorldProxyUpdateDeferred;
+    b2AABB                  mDeferredTickAABB;
+    b2Vec2                  mDeferredTickDisplacement;
 
 	// Growing
 	bool					mGrowActive;
@@ -249,6 +252,11 @@ protected:
     U32                     mSerialId;
     StringTableEntry        mRenderGroup;
 
+    /// Render caching.
+    U32                     mRenderCacheStamp;
+    U32                     mRenderCacheIndex;
+    bool                    mRenderDirtyDeferred;
+
 protected:
     static S32 QSORT_CALLBACK sceneObjectLayerDepthSort(const void* a, const void* b);
 
@@ -279,6 +287,7 @@ public:
     virtual bool            onAdd();
     virtual void            onRemove();
     virtual void            onDestroyNotify( SceneObject* pSceneObject );
+    virtual void            onStaticModified( const char* slotName, const char* newValue = NULL );
     static void             initPersistFields();
 
     /// Integration.
@@ -287,15 +296,18 @@ public:
     virtual void            postIntegrate(const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats);
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
+    virtual bool            getConcurrentTickAllowed( const Scene::TickStage tickStage ) const;
+    void                    updateDeferredWorldProxy( void );
+    void                    updateDeferredRenderDirty( void );
 
     /// Render batching.
-    inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
+    inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; setRenderDirty(); }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
     virtual bool            isBatchRendered( void ) { return true; }
     virtual bool            validRender( void ) const { return true; }
     virtual bool            shouldRender( void ) const { return false; }
+    void                    setRenderDirty( void );
 
-    
     /// Render Output.
     virtual bool            canPrepareRender( void ) const { return false; }
     virtual void            scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
@@ -325,7 +337,7 @@ public:
     inline U32              getSceneLayerMask( void ) const             { return mSceneLayerMask; }
 
     /// Scene Layer depth.
-    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; };
+    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; setRenderDirty(); };
     inline F32              getSceneLayerDepth( void ) const            { return mSceneLayerDepth; }
     bool                    setSceneLayerDepthFront( void );
     bool                    setSceneLayerDepthBack( void );
@@ -522,29 +534,29 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    inline void             setVisible( const bool status )             { mVisible = status; setRenderDirty(); }
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
-    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; }
+    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; setRenderDirty(); }
     inline bool             getBlendMode( void ) const                  { return mBlendMode; }
-    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; }
+    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; setRenderDirty(); }
     inline S32              getSrcBlendFactor( void ) const             { return mSrcBlendFactor; }
-    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; }
+    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; setRenderDirty(); }
     inline S32              getDstBlendFactor( void ) const             { return mDstBlendFactor; }
-    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; }
+    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; setRenderDirty(); }
     inline const ColorF&    getBlendColor( void ) const                 { return mBlendColor; }
-    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; }
+    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; setRenderDirty(); }
     inline F32              getBlendAlpha( void ) const                 { return mBlendColor.alpha; }
-    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; }
+    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; setRenderDirty(); }
     inline F32              getAlphaTest( void ) const                  { return mAlphaTest; }
     void                    setBlendOptions( void );
     static                  void resetBlendOptions( void );
 
     /// Render sorting.
-    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; }
+    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; setRenderDirty(); }
     inline const Vector2&   getSortPoint(void) const                    { return mSortPoint; }
-    inline void             setRenderGroup( const char* pRenderGroup )  { mRenderGroup = StringTable->insert(pRenderGroup); }
+    inline void             setRenderGroup( const char* pRenderGroup )  { mRenderGroup = StringTable->insert(pRenderGroup); setRenderDirty(); }
     inline StringTableEntry getRenderGroup( void ) const                { return mRenderGroup; }
 
     /// Input events.
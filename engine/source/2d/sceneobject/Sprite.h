@@ -52,6 +52,7 @@ public:
     inline bool getFlipX( void ) const                  { return mFlipX; }
     inline bool getFlipY( void ) const                  { return mFlipY; }
 
+    virtual bool getConcurrentRenderAllowed( void ) const { return true; }
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
 
     /// Declare Console Object.
@@ -271,7 +271,11 @@ TextSprite::TextSprite() :
    mCustomLineHeight(1.0f),
    mKerning(0.0f),
    mFontSpatialsDirty(true),
-   mCalculatedSize(1.0f, 1.0f)
+   mCalculatedSize(1.0f, 1.0f),
+   mGlyphCacheDirty(true),
+   mpGlyphCacheFont(NULL),
+   mGlyphCacheFontVersion(0),
+   mGlyphCacheRebuildCount(0)
 {
 }
 
@@ -363,15 +367,15 @@ void TextSprite::scenePrepareRender( const SceneRenderState* pSceneRenderState,
 
 void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(TextSprite_SceneRender);
+
     // Finish if no font asset.
     if ( mFontAsset.isNull() )
         return;
 
-    // Fetch number of characters to render.
-    const U32 renderCharacters = mText.length();
-
     // Ignore if no text to render.
-    if( renderCharacters == 0 )
+    if( mText.length() == 0 )
         return;
 
     //Make sure none of our settings are invalid
@@ -395,6 +399,73 @@ void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const S
        mOverflowY = OVERFLOW_Y_HIDDEN;
     }
 
+    // Lay the glyphs out again only if the text, font or layout settings changed.
+    const FontAsset* pFontAsset = mFontAsset;
+    const bool layoutDirty =
+        mGlyphCacheDirty ||
+        mFontSpatialsDirty ||
+        mSize != mCalculatedSize ||
+        mpGlyphCacheFont != pFontAsset ||
+        mGlyphCacheFontVersion != pFontAsset->getFontDataVersion();
+
+    if ( layoutDirty )
+    {
+        buildGlyphCache();
+    }
+
+    // Move the glyphs if the layout or the object moved.
+    if ( layoutDirty ||
+        mGlyphCacheOOBB[0] != mRenderOOBB[0] ||
+        mGlyphCacheOOBB[1] != mRenderOOBB[1] ||
+        mGlyphCacheOOBB[2] != mRenderOOBB[2] ||
+        mGlyphCacheOOBB[3] != mRenderOOBB[3] )
+    {
+        transformGlyphCache();
+    }
+
+    // Submit the cached glyph runs.
+    for ( S32 runIndex = 0; runIndex < mGlyphRuns.size(); ++runIndex )
+    {
+        const TextSpriteGlyphRun& glyphRun = mGlyphRuns[runIndex];
+
+        if ( glyphRun.mUseColor )
+        {
+            pBatchRenderer->SubmitQuads(
+                glyphRun.mCount,
+                mGlyphVertices.address() + glyphRun.mStart * 4,
+                mGlyphTextureCoords.address() + glyphRun.mStart * 4,
+                mFontAsset->getImageTexture(glyphRun.mPage),
+                glyphRun.mColor );
+        }
+        else
+        {
+            pBatchRenderer->SubmitQuads(
+                glyphRun.mCount,
+                mGlyphVertices.address() + glyphRun.mStart * 4,
+                mGlyphTextureCoords.address() + glyphRun.mStart * 4,
+                mFontAsset->getImageTexture(glyphRun.mPage) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextSprite::buildGlyphCache( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextSprite_BuildGlyphCache);
+
+    mGlyphCacheRebuildCount++;
+    mGlyphCacheDirty = false;
+    mpGlyphCacheFont = mFontAsset;
+    mGlyphCacheFontVersion = mFontAsset->getFontDataVersion();
+    mGlyphLocalVertices.clear();
+    mGlyphTextureCoords.clear();
+    mGlyphRuns.clear();
+
+    // Fetch number of characters to render.
+    const U32 renderCharacters = mText.length();
+
     // Get a size ratio
     const F32 ratio = mFontAsset->mBitmapFont.getSizeRatio(mFontSize);
 
@@ -413,6 +484,10 @@ void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const S
        CalculateSpatials(ratio);
     }
 
+    // Finish if there are no lines.
+    if (mLine.empty())
+       return;
+
     // If we're shrinking the set the scale
     bool shrinkX = false;
     bool shrinkY = false;
@@ -438,7 +513,7 @@ void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const S
 
     ApplyAlignment(cursor, mLine.size(), 0, mLine.front().mLength, mLine.front().mEnd - mLine.front().mStart + 1, ratio);
 
-    // Render all the characters.  
+    // Cache all the characters.
     U32 row = 0;
     S32 prevCharID = -1;
     for (U32 characterIndex = mLine.front().mStart; characterIndex < renderCharacters; ++characterIndex)
@@ -448,7 +523,7 @@ void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const S
 
         if (characterIndex >= mLine[row].mStart)
         {
-           RenderLetter(pBatchRenderer, cursor, charID, ratio, characterIndex);
+           CacheLetter(cursor, charID, ratio, characterIndex);
         }
         
         if ((row + 1) < mLine.size() && mLine[row + 1].mStart == (characterIndex + 1))
@@ -485,14 +560,40 @@ void TextSprite::sceneRender( const SceneRenderState* pSceneRenderState, const S
 
 //-----------------------------------------------------------------------------
 
+void TextSprite::transformGlyphCache( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextSprite_TransformGlyphCache);
+
+    for ( U32 i = 0; i < 4; ++i )
+        mGlyphCacheOOBB[i] = mRenderOOBB[i];
+
+    // The glyphs are laid out along the width and down the height from the top-left corner.
+    Vector2 unitWidth = mRenderOOBB[1] - mRenderOOBB[0];
+    unitWidth.Normalize();
+    Vector2 unitHeight = -(mRenderOOBB[3] - mRenderOOBB[0]);
+    unitHeight.Normalize();
+    const Vector2& origin = mRenderOOBB[3];
+
+    const U32 vertexCount = mGlyphLocalVertices.size();
+    mGlyphVertices.setSize( vertexCount );
+    for ( U32 i = 0; i < vertexCount; ++i )
+    {
+        const Vector2& localVertex = mGlyphLocalVertices[i];
+        mGlyphVertices[i] = origin + (unitWidth * localVertex.x) + (unitHeight * localVertex.y);
+    }
+}
 
-void TextSprite::RenderLetter(BatchRender* pBatchRenderer, Vector2& cursor, U32 charID, F32 ratio, U32 charNum)
+//-----------------------------------------------------------------------------
+
+void TextSprite::CacheLetter(Vector2& cursor, U32 charID, F32 ratio, U32 charNum)
 {
    const BitmapFontCharacter& bmChar = mFontAsset->mBitmapFont.getCharacter(charID);
 
    Vector2 charScale = getCharacterScale(charNum);
    Vector2 charOffset = getCharacterOffset(charNum);
-   ColorF charColor = getCharacterBlendColor(charNum);
+   const bool useColor = getCharacterHasBlendColor(charNum);
+   const ColorF charColor = useColor ? getCharacterBlendColor(charNum) : mBlendColor;
 
    F32 fontScaleX = mFontScaleX * charScale.x;
    F32 fontScaleY = mFontScaleY * charScale.y;
@@ -556,54 +657,41 @@ void TextSprite::RenderLetter(BatchRender* pBatchRenderer, Vector2& cursor, U32
    sourceOOBB[2].Set(bmChar.mOOBB[2].x - ((insetRight * (F32)bmChar.mWidth) / (F32)bmChar.mPageWidth), bmChar.mOOBB[2].y + ((insetTop * (F32)bmChar.mHeight) / (F32)bmChar.mPageHeight));
    sourceOOBB[3].Set(bmChar.mOOBB[3].x + ((insetLeft * (F32)bmChar.mWidth) / (F32)bmChar.mPageWidth), bmChar.mOOBB[3].y + ((insetTop * (F32)bmChar.mHeight) / (F32)bmChar.mPageHeight));
 
-   //create the destination rect
-   Vector2 destLeft = (mRenderOOBB[1] - mRenderOOBB[0]);
-   destLeft.Normalize((F32)cursorX + (insetLeft * bmChar.mWidth * ratio * fontScaleX));
-
-   Vector2 destWidth = (mRenderOOBB[1] - mRenderOOBB[0]);
-   destWidth.Normalize(((bmChar.mWidth * ratio) - (insetLeft * (bmChar.mWidth * ratio)) - (insetRight * (bmChar.mWidth * ratio))) * fontScaleX);
-
-   Vector2 destTop = -(mRenderOOBB[3] - mRenderOOBB[0]);
-   destTop.Normalize((F32)cursorY - (((mFontAsset->mBitmapFont.mBaseline * ratio) - (bmChar.mYOffset * ratio) - (insetTop * bmChar.mHeight * ratio)) * fontScaleY));
+   //create the destination rect along the width and down the height
+   const F32 destLeft = cursorX + (insetLeft * bmChar.mWidth * ratio * fontScaleX);
+   const F32 destWidth = ((bmChar.mWidth * ratio) - (insetLeft * (bmChar.mWidth * ratio)) - (insetRight * (bmChar.mWidth * ratio))) * fontScaleX;
+   const F32 destTop = cursorY - (((mFontAsset->mBitmapFont.mBaseline * ratio) - (bmChar.mYOffset * ratio) - (insetTop * bmChar.mHeight * ratio)) * fontScaleY);
+   const F32 destHeight = ((bmChar.mHeight * ratio) - (insetBottom * bmChar.mHeight * ratio) - (insetTop * bmChar.mHeight * ratio)) * fontScaleY;
 
-   Vector2 destHeight = -(mRenderOOBB[3] - mRenderOOBB[0]);
-   destHeight.Normalize(((bmChar.mHeight * ratio) - (insetBottom * bmChar.mHeight * ratio) - (insetTop * bmChar.mHeight * ratio)) * fontScaleY);
+   mGlyphLocalVertices.push_back(Vector2(destLeft, destTop + destHeight));
+   mGlyphLocalVertices.push_back(Vector2(destLeft + destWidth, destTop + destHeight));
+   mGlyphLocalVertices.push_back(Vector2(destLeft + destWidth, destTop));
+   mGlyphLocalVertices.push_back(Vector2(destLeft, destTop));
 
-   Vector2 destOOBB[4];
-   destOOBB[0] = (mRenderOOBB[3] + destLeft + destTop + destHeight);
-   destOOBB[1] = (mRenderOOBB[3] + destLeft + destWidth + destTop + destHeight);
-   destOOBB[2] = (mRenderOOBB[3] + destLeft + destWidth + destTop);
-   destOOBB[3] = (mRenderOOBB[3] + destLeft + destTop);
+   mGlyphTextureCoords.push_back(sourceOOBB[0]);
+   mGlyphTextureCoords.push_back(sourceOOBB[1]);
+   mGlyphTextureCoords.push_back(sourceOOBB[2]);
+   mGlyphTextureCoords.push_back(sourceOOBB[3]);
 
-   if (charColor != mBlendColor)
+   // Extend the current run if the page and color match.
+   if (mGlyphRuns.size() > 0)
    {
-      // Submit batched quad.
-      pBatchRenderer->SubmitQuad(
-         destOOBB[0],
-         destOOBB[1],
-         destOOBB[2],
-         destOOBB[3],
-         sourceOOBB[0],
-         sourceOOBB[1],
-         sourceOOBB[2],
-         sourceOOBB[3],
-         mFontAsset->getImageTexture(bmChar.mPage),
-         charColor);
-   }
-   else
-   {
-      // Submit batched quad.
-      pBatchRenderer->SubmitQuad(
-         destOOBB[0],
-         destOOBB[1],
-         destOOBB[2],
-         destOOBB[3],
-         sourceOOBB[0],
-         sourceOOBB[1],
-         sourceOOBB[2],
-         sourceOOBB[3],
-         mFontAsset->getImageTexture(bmChar.mPage));
+      TextSpriteGlyphRun& glyphRun = mGlyphRuns.last();
+      if (glyphRun.mPage == bmChar.mPage && glyphRun.mUseColor == useColor && (!useColor || glyphRun.mColor == charColor))
+      {
+         glyphRun.mCount++;
+         return;
+      }
    }
+
+   // Start a new run.
+   TextSpriteGlyphRun glyphRun;
+   glyphRun.mPage = bmChar.mPage;
+   glyphRun.mStart = (mGlyphLocalVertices.size() / 4) - 1;
+   glyphRun.mCount = 1;
+   glyphRun.mUseColor = useColor;
+   glyphRun.mColor = charColor;
+   mGlyphRuns.push_back(glyphRun);
 }
 
 //-----------------------------------------------------------------------------
@@ -773,6 +861,8 @@ bool TextSprite::setFont( const char* pFontAssetId )
 
 void TextSprite::setCharacterBlendColor(const U32 charNum, const ColorF color)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) != mCharInfo.end())
    {
       mCharInfo[charNum].mColor = color;
@@ -809,6 +899,8 @@ bool TextSprite::getCharacterHasBlendColor(const U32 charNum)
 
 void TextSprite::resetCharacterBlendColor(const U32 charNum)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) != mCharInfo.end())
    {
       mCharInfo[charNum].mUseColor = false;
@@ -824,6 +916,8 @@ void TextSprite::resetCharacterBlendColor(const U32 charNum)
 
 void TextSprite::setCharacterScale(const U32 charNum, const F32 scaleX, const F32 scaleY)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) == mCharInfo.end())
    {
       mCharInfo[charNum] = BitmapFontCharacterInfo();
@@ -855,6 +949,8 @@ Vector2 TextSprite::getCharacterScale(const U32 charNum)
 
 void TextSprite::resetCharacterScale(const U32 charNum)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) != mCharInfo.end())
    {
       mCharInfo[charNum].mScaleX = 1.0f;
@@ -871,6 +967,8 @@ void TextSprite::resetCharacterScale(const U32 charNum)
 
 void TextSprite::setCharacterOffset(const U32 charNum, const F32 offsetX, const F32 offsetY)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) == mCharInfo.end())
    {
       mCharInfo[charNum] = BitmapFontCharacterInfo();
@@ -902,6 +1000,8 @@ Vector2 TextSprite::getCharacterOffset(const U32 charNum)
 
 void TextSprite::resetCharacterOffset(const U32 charNum)
 {
+   mGlyphCacheDirty = true;
+
    if (mCharInfo.find(charNum) != mCharInfo.end())
    {
       mCharInfo[charNum].mOffsetX = 0.0f;
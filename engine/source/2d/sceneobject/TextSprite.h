@@ -55,6 +55,18 @@ using CharInfoMap = std::map<U32, BitmapFontCharacterInfo>;
 
 //-----------------------------------------------------------------------------
 
+/// A run of cached glyph quads sharing a font page and color.
+struct TextSpriteGlyphRun
+{
+    U16     mPage;
+    U32     mStart;
+    U32     mCount;
+    bool    mUseColor;
+    ColorF  mColor;
+};
+
+//-----------------------------------------------------------------------------
+
 class TextSprite : public SceneObject
 {
     typedef SceneObject          Parent;
@@ -117,6 +129,17 @@ private:
     Vector2                 mCalculatedSize;
     CharInfoMap             mCharInfo;
 
+    /// Glyph quads cached until the text layout or the render OOBB changes.
+    bool                    mGlyphCacheDirty;
+    const FontAsset*        mpGlyphCacheFont;
+    U32                     mGlyphCacheFontVersion;
+    Vector2                 mGlyphCacheOOBB[4];
+    Vector<Vector2>         mGlyphLocalVertices;
+    Vector<Vector2>         mGlyphVertices;
+    Vector<Vector2>         mGlyphTextureCoords;
+    Vector<TextSpriteGlyphRun> mGlyphRuns;
+    U32                     mGlyphCacheRebuildCount;
+
 
 public:
     TextSprite();
@@ -173,7 +196,9 @@ public:
     inline void setKerning(const F32 kern)                                  { mKerning = kern; mFontSpatialsDirty = true; }
     inline F32 getKerning(void) const                                       { return mKerning; }
 
-    void resetCharacterSettings(void)                                       { mCharInfo.clear(); }
+    void resetCharacterSettings(void)                                       { mCharInfo.clear(); mGlyphCacheDirty = true; }
+
+    inline U32 getGlyphCacheRebuildCount(void) const                        { return mGlyphCacheRebuildCount; }
 
     void setCharacterBlendColor(const U32 charNum, const ColorF color);
     ColorF getCharacterBlendColor(const U32 charNum);
@@ -230,7 +255,9 @@ protected:
     static bool writeKerning(void* obj, StringTableEntry pFieldName)       { return static_cast<TextSprite*>(obj)->getKerning() != 0.0f; }
 
 private:
-   void RenderLetter(BatchRender* pBatchRenderer, Vector2& cursor, U32 charID, F32 ratio, U32 charNum);
+   void buildGlyphCache(void);
+   void transformGlyphCache(void);
+   void CacheLetter(Vector2& cursor, U32 charID, F32 ratio, U32 charNum);
    void ApplyAlignment(Vector2& cursor, U32 totalRows, U32 row, F32 length, U32 charCount, F32 ratio);
    F32 getCursorAdvance(U32 charID, S32 prevCharID, F32 ratio);
    F32 getCursorAdvance(const BitmapFontCharacter& bmChar, S32 prevCharID, F32 ratio);
@@ -434,4 +434,15 @@ ConsoleMethodWithDocs(TextSprite, resetCharacterOffset, ConsoleVoid, 3, 3, (inde
    object->resetCharacterOffset(dAtoi(argv[2]));
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Gets how many times the text has been laid out into its glyph cache.
+The layout is only rebuilt when the text, font or layout settings change.
+@return The glyph cache rebuild count.
+*/
+ConsoleMethodWithDocs(TextSprite, getGlyphCacheRebuildCount, ConsoleInt, 2, 2, ())
+{
+   return object->getGlyphCacheRebuildCount();
+}
+
 ConsoleMethodGroupEndWithDocs(TextSprite)
\ No newline at end of file
@@ -61,6 +61,7 @@ public:
     /// Integration.
     virtual void            preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats );
     virtual void            integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool            getConcurrentTickAllowed( const Scene::TickStage tickStage ) const { return tickStage == Scene::TICK_STAGE_POSTINTEGRATE && Parent::getConcurrentTickAllowed( tickStage ); }
 
     /// Rendering.
     virtual bool            shouldRender( void ) const { return false; }
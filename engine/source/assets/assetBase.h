@@ -35,6 +35,10 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _ASSET_TYPE_CACHE_H_
+#include "assets/assetTypeCache.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class AssetManager;
@@ -102,6 +106,12 @@ public:
 
     virtual bool            isAssetValid( void ) const                          { return true; }
 
+    /// Memory the loaded asset alone keeps resident in bytes.
+    virtual U32             getAssetMemorySize( void ) const                    { return 0; }
+
+    /// Resident resources the asset may share with other assets (such as textures).
+    virtual void            getAssetSharedMemory( Vector<AssetSharedMemory>& sharedMemory ) const {}
+
     void                    refreshAsset( void );
 
     /// Declare Console Object.
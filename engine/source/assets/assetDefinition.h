@@ -59,6 +59,11 @@ public:
         mAssetUnloadedCount = 0;
         mAssetRefreshEnable = true;
         mAssetLooseFiles.clear();
+        mAssetIdle = false;
+        mAssetIdleMemorySize = 0;
+        mAssetIdleSharedResources.clear();
+        mpIdlePrevious = NULL;
+        mpIdleNext = NULL;
 
         // Reset persisted state.
         mAssetName = StringTable->EmptyString;
@@ -79,6 +84,13 @@ public:
     bool                        mAssetRefreshEnable;
     Vector<StringTableEntry>    mAssetLooseFiles;
 
+    /// Idle asset cache.
+    bool                        mAssetIdle;
+    U32                         mAssetIdleMemorySize;
+    Vector<const void*>         mAssetIdleSharedResources;
+    AssetDefinition*            mpIdlePrevious;
+    AssetDefinition*            mpIdleNext;
+
     /// Persisted state.
     StringTableEntry            mAssetName;
     StringTableEntry            mAssetDescription;
@@ -54,6 +54,18 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#include "assetManifestCache.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -76,12 +88,26 @@ AssetManager::AssetManager() :
     mMaxLoadedPrivateAssetsCount( 0 ),
     mAcquiredReferenceCount( 0 ),
     mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mIgnoreAutoUnload( false ),
+    mUseManifestCache( true ),
+    mpCompletingAsyncLoad( NULL ),
+    mAsyncUploadBudget( 4 * 1024 * 1024 )
 {
 }
 
 //-----------------------------------------------------------------------------
 
+AssetManager::~AssetManager()
+{
+    // Destroy the asset type caches.
+    for( typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.begin(); cacheItr != mAssetTypeCaches.end(); ++cacheItr )
+    {
+        delete cacheItr->value;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::onAdd()
 {
     // Call parent.
@@ -95,6 +121,22 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Discard any asynchronous loads.
+    while( mAsyncAssetLoads.size() > 0 )
+    {
+        AsyncAssetLoad* pAsyncAssetLoad = mAsyncAssetLoads.last();
+        mAsyncAssetLoads.pop_back();
+
+        // Reset any pending asset pointers.
+        for( Vector<AsyncAcquire>::iterator acquireItr = pAsyncAssetLoad->mAcquires.begin(); acquireItr != pAsyncAssetLoad->mAcquires.end(); ++acquireItr )
+        {
+            acquireItr->mpAssetPtrBase->mPendingAssetId = NULL;
+        }
+
+        discardAsyncAssetLoad( pAsyncAssetLoad );
+    }
+    setProcessTicks( false );
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -115,6 +157,8 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "UseManifestCache", TypeBool, Offset(mUseManifestCache, AssetManager), "Whether the asset manager keeps a manifest cache in each module so only changed asset files are parsed or not." );
+    addField( "AsyncUploadBudget", TypeU32, Offset(mAsyncUploadBudget, AssetManager), "The number of decoded bitmap bytes asynchronous acquires may upload each frame." );
 }
 
 //-----------------------------------------------------------------------------
@@ -130,6 +174,17 @@ bool AssetManager::compileReferencedAssets( ModuleDefinition* pModuleDefinition
     // Clear referenced assets.
     mReferencedAssets.clear();
 
+    // Load the module manifest cache.
+    AssetManifestCache manifestCache;
+    AssetManifestCache* pManifestCache = NULL;
+    if ( mUseManifestCache )
+    {
+        char manifestFilePathBuffer[1024];
+        dSprintf( manifestFilePathBuffer, sizeof(manifestFilePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), ASSET_MANIFEST_CACHE_FILENAME );
+        manifestCache.load( manifestFilePathBuffer );
+        pManifestCache = &manifestCache;
+    }
+
     // Iterate the module definition children.
     for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
     {
@@ -145,13 +200,21 @@ bool AssetManager::compileReferencedAssets( ModuleDefinition* pModuleDefinition
         dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), pReferencedAssets->getPath() );
 
         // Scan referenced assets at location.
-        if ( !scanReferencedAssets( filePathBuffer, pReferencedAssets->getExtension(), pReferencedAssets->getRecurse() ) )
+        if ( !scanReferencedAssets( filePathBuffer, pReferencedAssets->getExtension(), pReferencedAssets->getRecurse(), pManifestCache ) )
         {
             // Warn.
             Con::warnf( "AssetManager::compileReferencedAssets() - Could not scan for referenced assets at location '%s' with extension '%s'.", filePathBuffer, pReferencedAssets->getExtension() );
         }
     }  
 
+    // Save the module manifest cache.
+    // NOTE: Failing to save is not an error as the module location may be read-only.
+    if ( pManifestCache != NULL )
+    {
+        pManifestCache->pruneReferencedAssets();
+        pManifestCache->save();
+    }
+
     return true;
 }
 
@@ -173,6 +236,17 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         return false;
     }
 
+    // Load the module manifest cache.
+    AssetManifestCache manifestCache;
+    AssetManifestCache* pManifestCache = NULL;
+    if ( mUseManifestCache )
+    {
+        char manifestFilePathBuffer[1024];
+        dSprintf( manifestFilePathBuffer, sizeof(manifestFilePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), ASSET_MANIFEST_CACHE_FILENAME );
+        manifestCache.load( manifestFilePathBuffer );
+        pManifestCache = &manifestCache;
+    }
+
     // Iterate the module definition children.
     for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
     {
@@ -188,13 +262,21 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), pDeclaredAssets->getPath() );
 
         // Scan declared assets at location.
-        if ( !scanDeclaredAssets( filePathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse(), pModuleDefinition ) )
+        if ( !scanDeclaredAssets( filePathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse(), pModuleDefinition, pManifestCache ) )
         {
             // Warn.
             Con::warnf( "AssetManager::addModuleDeclaredAssets() - Could not scan for declared assets at location '%s' with extension '%s'.", filePathBuffer, pDeclaredAssets->getExtension() );
         }
     }  
 
+    // Save the module manifest cache.
+    // NOTE: Failing to save is not an error as the module location may be read-only.
+    if ( pManifestCache != NULL )
+    {
+        pManifestCache->pruneDeclaredAssets();
+        pManifestCache->save();
+    }
+
     return true;
 }
 
@@ -233,7 +315,7 @@ bool AssetManager::addDeclaredAsset( ModuleDefinition* pModuleDefinition, const
     pFileStart++;
 
     // Scan declared assets at location.
-    if ( !scanDeclaredAssets( assetFilePathBuffer, pFileStart, false, pModuleDefinition ) )
+    if ( !scanDeclaredAssets( assetFilePathBuffer, pFileStart, false, pModuleDefinition, NULL ) )
     {
         // Warn.
         Con::warnf( "AssetManager::addDeclaredAsset() - Could not scan declared assets at location '%s' with extension '%s'.", assetFilePathBuffer, pFileStart );
@@ -388,6 +470,7 @@ bool AssetManager::removeDeclaredAsset( const char* pAssetId )
     {
         // Yes, so delete it.
         // NOTE: If anything is using this then this'll cause a crash.  Objects should always use safe reference methods however.
+        unlinkIdleAsset( pAssetDefinition );
         pAssetDefinition->mpAssetBase->deleteObject();
     }
 
@@ -931,6 +1014,15 @@ bool AssetManager::releaseAsset( const char* pAssetId )
                 Con::printf( "Asset Manager: > Releasing to idle state." );
             }
         }
+        // Is the asset kept in its idle cache?
+        else if ( cacheIdleAsset( pAssetDefinition ) )
+        {
+            // Yes, so info.
+            if ( mEchoInfo )
+            {
+                Con::printf( "Asset Manager: > Releasing to idle cache." );
+            }
+        }
         else
         {
             // No, so info.
@@ -1383,6 +1475,159 @@ void AssetManager::unregisterAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase
 
 //-----------------------------------------------------------------------------
 
+bool AssetManager::acquireAssetAsync( const char* pAssetId, AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_AcquireAssetAsync);
+
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Cannot asynchronously acquire NULL asset Id." );
+
+    // Fetch asset Id.
+    StringTableEntry assetId = StringTable->insert( pAssetId );
+
+    // Find an existing load.
+    AsyncAssetLoad* pAsyncAssetLoad = findAsyncAssetLoad( assetId );
+
+    // Did we find one?
+    if ( pAsyncAssetLoad == NULL )
+    {
+        // No, so create one.
+        pAsyncAssetLoad = createAsyncAssetLoad( assetId );
+
+        // Finish if the asset does not exist.
+        if ( pAsyncAssetLoad == NULL )
+            return false;
+    }
+
+    // Is this for an asset pointer?
+    if ( pAssetPtrBase != NULL )
+    {
+        // Yes, so add the acquire.
+        AsyncAcquire acquire;
+        acquire.mpAssetPtrBase = pAssetPtrBase;
+        acquire.mpCallback = pCallback;
+        pAsyncAssetLoad->mAcquires.push_back( acquire );
+    }
+    else
+    {
+        // No, so this is a script acquire.
+        pAsyncAssetLoad->mScriptAcquireCount++;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::acquireAssetAsync( const char* pAssetId )
+{
+    return acquireAssetAsync( pAssetId, NULL, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::cancelAsyncAcquire( AssetPtrBase* pAssetPtrBase )
+{
+    // Is the load being completed the one being cancelled?
+    if ( mpCompletingAsyncLoad != NULL )
+    {
+        // Yes, so remove the acquire from the completing load.
+        for( U32 index = 0; index < (U32)mpCompletingAsyncLoad->mAcquires.size(); ++index )
+        {
+            if ( mpCompletingAsyncLoad->mAcquires[index].mpAssetPtrBase == pAssetPtrBase )
+            {
+                mpCompletingAsyncLoad->mAcquires.erase( index );
+                return;
+            }
+        }
+    }
+
+    // Search the pending loads.
+    for( U32 loadIndex = 0; loadIndex < (U32)mAsyncAssetLoads.size(); ++loadIndex )
+    {
+        AsyncAssetLoad* pAsyncAssetLoad = mAsyncAssetLoads[loadIndex];
+
+        for( U32 index = 0; index < (U32)pAsyncAssetLoad->mAcquires.size(); ++index )
+        {
+            // Skip if not the asset pointer.
+            if ( pAsyncAssetLoad->mAcquires[index].mpAssetPtrBase != pAssetPtrBase )
+                continue;
+
+            // Remove the acquire.
+            pAsyncAssetLoad->mAcquires.erase( index );
+
+            // Discard the load if nothing wants it anymore.
+            if ( pAsyncAssetLoad->mAcquires.size() == 0 && pAsyncAssetLoad->mScriptAcquireCount == 0 )
+            {
+                mAsyncAssetLoads.erase( loadIndex );
+                discardAsyncAssetLoad( pAsyncAssetLoad );
+            }
+
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processAsyncLoads( const bool flush )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessAsyncLoads);
+
+    U32 uploadSize = 0;
+    bool completedLoad = false;
+
+    U32 loadIndex = 0;
+    while( loadIndex < (U32)mAsyncAssetLoads.size() )
+    {
+        AsyncAssetLoad* pAsyncAssetLoad = mAsyncAssetLoads[loadIndex];
+
+        // Skip if the load is still decoding.
+        if ( !flush && !isAsyncAssetLoadReady( pAsyncAssetLoad ) )
+        {
+            loadIndex++;
+            continue;
+        }
+
+        // Calculate the upload size.
+        U32 loadUploadSize = 0;
+        for( Vector<StringTableEntry>::iterator keyItr = pAsyncAssetLoad->mBitmapKeys.begin(); keyItr != pAsyncAssetLoad->mBitmapKeys.end(); ++keyItr )
+        {
+            loadUploadSize += TextureManager::getDecodedBitmapSize( *keyItr );
+        }
+
+        // Finish if the upload budget is spent.
+        // NOTE: At least one load always completes so that large assets still make progress.
+        if ( !flush && completedLoad && uploadSize + loadUploadSize > mAsyncUploadBudget )
+            break;
+
+        uploadSize += loadUploadSize;
+        completedLoad = true;
+
+        // Remove the load before completing it as the callbacks may change the pending loads.
+        mAsyncAssetLoads.erase( loadIndex );
+        completeAsyncAssetLoad( pAsyncAssetLoad );
+
+        // Start again.
+        loadIndex = 0;
+    }
+
+    // Stop processing if there's nothing left to load.
+    if ( mAsyncAssetLoads.size() == 0 )
+        setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::advanceTime( F32 timeDelta )
+{
+    processAsyncLoads();
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::loadAssetTags( ModuleDefinition* pModuleDefinition )
 {
     // Sanity!
@@ -2306,7 +2551,63 @@ S32 AssetManager::findAssetLooseFile( AssetQuery* pAssetQuery, const char* pLoos
 
 //-----------------------------------------------------------------------------
 
-bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
+/// Declared asset files are handed to the job workers in chunks of this many files.
+static const U32 sDeclaredAssetScanChunkSize = 8;
+
+/// Declared asset scan job context.
+struct DeclaredAssetScanJob
+{
+    Taml*                           mpTaml;
+    const AssetManifestCache*       mpManifestCache;
+    const StringTableEntry*         mpAssetFiles;
+    TamlAssetDeclaredVisitor*       mpAssetDeclaredVisitors;
+    AssetManifestCache::FileStamp*  mpAssetFileStamps;
+    bool*                           mpAssetFilesParsed;
+    bool*                           mpAssetFilesStamped;
+    bool*                           mpAssetFilesCached;
+};
+
+//-----------------------------------------------------------------------------
+
+static void scanDeclaredAssetFilesJob( void* pJobContext, const U32 startIndex, const U32 endIndex )
+{
+    DeclaredAssetScanJob* pScanJob = static_cast<DeclaredAssetScanJob*>( pJobContext );
+
+    // Parse each asset file with its own visitor.
+    // NOTE:    This may run on a job worker so it must not touch the asset manager state.
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        // Fetch asset file.
+        StringTableEntry assetFile = pScanJob->mpAssetFiles[index];
+
+        pScanJob->mpAssetFilesStamped[index] = false;
+        pScanJob->mpAssetFilesCached[index] = false;
+
+        // Is there a manifest cache?
+        if ( pScanJob->mpManifestCache != NULL )
+        {
+            // Yes, so use the cached declaration if the asset file has not changed.
+            const AssetManifestCache::DeclaredAssetRecord* pRecord = pScanJob->mpManifestCache->findDeclaredAsset( assetFile );
+            if ( pRecord != NULL && AssetManifestCache::validateFileStamp( assetFile, pRecord->mFileStamp, pScanJob->mpAssetFileStamps[index] ) )
+            {
+                AssetManifestCache::restoreDeclaredAsset( *pRecord, assetFile, pScanJob->mpAssetDeclaredVisitors[index] );
+                pScanJob->mpAssetFilesStamped[index] = true;
+                pScanJob->mpAssetFilesCached[index] = true;
+                pScanJob->mpAssetFilesParsed[index] = true;
+                continue;
+            }
+
+            // Stamp the asset file before parsing it so a concurrent edit is never recorded as unchanged.
+            pScanJob->mpAssetFilesStamped[index] = AssetManifestCache::getFileStamp( assetFile, pScanJob->mpAssetFileStamps[index] );
+        }
+
+        pScanJob->mpAssetFilesParsed[index] = pScanJob->mpTaml->parse( assetFile, pScanJob->mpAssetDeclaredVisitors[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition, AssetManifestCache* pManifestCache )
 {
     // Debug Profiling.
     PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
@@ -2351,9 +2652,8 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
     // Fetch module assets.
     ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
 
-    TamlAssetDeclaredVisitor assetDeclaredVisitor;
-
-    // Iterate files.
+    // Find the asset files.
+    Vector<StringTableEntry> assetFiles;
     for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
     {
         // Fetch file info.
@@ -2373,21 +2673,68 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
             continue;
 
-        // Clear declared assets.
-        assetDeclaredVisitor.clear();
-
         // Format full file-path.
         char assetFileBuffer[1024];
         dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
 
-        // Parse the filename.
-        if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+        // Store asset file.
+        assetFiles.push_back( StringTable->insert( assetFileBuffer ) );
+    }
+
+    // Parse the asset files across the job workers.
+    const U32 assetFileCount = (U32)assetFiles.size();
+    TamlAssetDeclaredVisitor* pAssetDeclaredVisitors = new TamlAssetDeclaredVisitor[assetFileCount];
+    Vector<AssetManifestCache::FileStamp> assetFileStamps;
+    Vector<bool> assetFilesParsed;
+    Vector<bool> assetFilesStamped;
+    Vector<bool> assetFilesCached;
+    assetFileStamps.setSize( assetFileCount );
+    assetFilesParsed.setSize( assetFileCount );
+    assetFilesStamped.setSize( assetFileCount );
+    assetFilesCached.setSize( assetFileCount );
+
+    DeclaredAssetScanJob scanJob;
+    scanJob.mpTaml = &mTaml;
+    scanJob.mpManifestCache = pManifestCache;
+    scanJob.mpAssetFiles = assetFiles.address();
+    scanJob.mpAssetDeclaredVisitors = pAssetDeclaredVisitors;
+    scanJob.mpAssetFileStamps = assetFileStamps.address();
+    scanJob.mpAssetFilesParsed = assetFilesParsed.address();
+    scanJob.mpAssetFilesStamped = assetFilesStamped.address();
+    scanJob.mpAssetFilesCached = assetFilesCached.address();
+
+    JobScheduler* pJobScheduler = JobScheduler::Instance;
+    if ( pJobScheduler != NULL )
+        pJobScheduler->parallelFor( assetFileCount, sDeclaredAssetScanChunkSize, &scanDeclaredAssetFilesJob, &scanJob );
+    else
+        scanDeclaredAssetFilesJob( &scanJob, 0, assetFileCount );
+
+    // Merge the declared assets in file order so the results match a serial scan.
+    for ( U32 assetFileIndex = 0; assetFileIndex < assetFileCount; ++assetFileIndex )
+    {
+        // Fetch asset file.
+        const char* assetFileBuffer = assetFiles[assetFileIndex];
+
+        // Was the file parsed?
+        if ( !assetFilesParsed[assetFileIndex] )
         {
-            // Warn.
+            // No, so warn.
             Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
             continue;
         }
 
+        // Fetch the declared asset visitor.
+        TamlAssetDeclaredVisitor& assetDeclaredVisitor = pAssetDeclaredVisitors[assetFileIndex];
+
+        // Record the declaration in the manifest cache.
+        if ( pManifestCache != NULL )
+        {
+            if ( assetFilesCached[assetFileIndex] )
+                pManifestCache->useDeclaredAsset( assetFiles[assetFileIndex], assetFileStamps[assetFileIndex] );
+            else if ( assetFilesStamped[assetFileIndex] )
+                pManifestCache->storeDeclaredAsset( assetFiles[assetFileIndex], assetFileStamps[assetFileIndex], assetDeclaredVisitor );
+        }
+
         // Fetch asset definition.
         AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
 
@@ -2496,6 +2843,9 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         }
     }
 
+    // Free the declared asset visitors.
+    delete [] pAssetDeclaredVisitors;
+
     // Info.
     if ( mEchoInfo )
     {
@@ -2510,7 +2860,7 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
 
 //-----------------------------------------------------------------------------
 
-bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse )
+bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse, AssetManifestCache* pManifestCache )
 {
     // Debug Profiling.
     PROFILE_SCOPE(AssetManager_ScanReferencedAssets);
@@ -2574,12 +2924,35 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
         // Format reference file-path.
         typeReferenceFilePath referenceFilePath = StringTable->insert( assetFileBuffer );
 
-        // Parse the filename.
-        if ( !mTaml.parse( referenceFilePath, assetReferencedVisitor ) )
+        // Is there an unchanged manifest cache record for the file?
+        AssetManifestCache::FileStamp fileStamp;
+        const AssetManifestCache::ReferencedAssetRecord* pRecord = pManifestCache != NULL ? pManifestCache->findReferencedAsset( referenceFilePath ) : NULL;
+        if ( pRecord != NULL && AssetManifestCache::validateFileStamp( referenceFilePath, pRecord->mFileStamp, fileStamp ) )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset references: '%s'.", referenceFilePath );
-            continue;
+            // Yes, so restore the references from it.
+            for( Vector<StringTableEntry>::const_iterator assetIdItr = pRecord->mAssetIds.begin(); assetIdItr != pRecord->mAssetIds.end(); ++assetIdItr )
+            {
+                assetReferencedVisitor.insertAssetReferenced( *assetIdItr );
+            }
+
+            pManifestCache->useReferencedAsset( referenceFilePath, fileStamp );
+        }
+        else
+        {
+            // No, so stamp the file before parsing it.
+            const bool fileStamped = pManifestCache != NULL && AssetManifestCache::getFileStamp( referenceFilePath, fileStamp );
+
+            // Parse the filename.
+            if ( !mTaml.parse( referenceFilePath, assetReferencedVisitor ) )
+            {
+                // Warn.
+                Con::warnf( "Asset Manager: Failed to parse file containing asset references: '%s'.", referenceFilePath );
+                continue;
+            }
+
+            // Record the references in the manifest cache.
+            if ( fileStamped )
+                pManifestCache->storeReferencedAsset( referenceFilePath, fileStamp, assetReferencedVisitor.getAssetReferencedMap() );
         }
 
         // Fetch usage map.
@@ -2931,6 +3304,9 @@ void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
     // Debug Profiling.
     PROFILE_SCOPE(AssetManager_UnloadAsset);
 
+    // Remove from any idle cache.
+    unlinkIdleAsset( pAssetDefinition );
+
     // Destroy the asset.
     pAssetDefinition->mpAssetBase->deleteObject();
 
@@ -2962,6 +3338,413 @@ void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
 
 //-----------------------------------------------------------------------------
 
+bool AssetManager::cacheIdleAsset( AssetDefinition* pAssetDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_CacheIdleAsset);
+
+    // Finish if the asset is private.
+    if ( pAssetDefinition->mAssetPrivate )
+        return false;
+
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.find( pAssetDefinition->mAssetType );
+
+    // Finish if the asset type has no budget.
+    if ( cacheItr == mAssetTypeCaches.end() || cacheItr->value->mMemoryBudget == 0 )
+        return false;
+
+    AssetTypeCache* pAssetTypeCache = cacheItr->value;
+
+    // Fetch the asset memory.
+    const U32 assetMemorySize = pAssetDefinition->mpAssetBase->getAssetMemorySize();
+    Vector<AssetSharedMemory> sharedMemory;
+    pAssetDefinition->mpAssetBase->getAssetSharedMemory( sharedMemory );
+
+    // Does the asset type report its memory?
+    if ( assetMemorySize == 0 && sharedMemory.size() == 0 )
+    {
+        // No, so warn once as the budget cannot be honoured.
+        if ( !pAssetTypeCache->mMemoryUnreported )
+        {
+            Con::warnf( "Asset Manager: Asset type '%s' does not report its memory so its memory budget is ignored.", pAssetDefinition->mAssetType );
+            pAssetTypeCache->mMemoryUnreported = true;
+        }
+
+        return false;
+    }
+
+    // Finish if the asset could never fit.
+    if ( pAssetTypeCache->getIdleMemoryIncrease( assetMemorySize, sharedMemory ) > pAssetTypeCache->mMemoryBudget )
+        return false;
+
+    // Link as the most recently released.
+    pAssetTypeCache->linkIdleAsset( pAssetDefinition, assetMemorySize, sharedMemory );
+
+    // Evict anything over budget.
+    trimAssetTypeCache( pAssetTypeCache );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::reviveIdleAsset( AssetDefinition* pAssetDefinition )
+{
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.find( pAssetDefinition->mAssetType );
+
+    // Record the hit.
+    if ( cacheItr != mAssetTypeCaches.end() )
+        cacheItr->value->mHitCount++;
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: > Acquiring from idle cache." );
+    }
+
+    unlinkIdleAsset( pAssetDefinition );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::unlinkIdleAsset( AssetDefinition* pAssetDefinition )
+{
+    // Finish if not idle.
+    if ( !pAssetDefinition->mAssetIdle )
+        return;
+
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.find( pAssetDefinition->mAssetType );
+
+    // Sanity!
+    AssertFatal( cacheItr != mAssetTypeCaches.end(), "AssetManager::unlinkIdleAsset() - Idle asset has no asset type cache." );
+
+    // Unlink.
+    cacheItr->value->unlinkIdleAsset( pAssetDefinition );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::trimAssetTypeCache( AssetTypeCache* pAssetTypeCache )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_TrimAssetTypeCache);
+
+    // Unload the least recently released assets until within budget.
+    AssetDefinition* pAssetDefinition;
+    while( (pAssetDefinition = pAssetTypeCache->getEvictionCandidate()) != NULL )
+    {
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: > Evicting idle asset Id '%s' (%d bytes).", pAssetDefinition->mAssetId, pAssetDefinition->mAssetIdleMemorySize );
+        }
+
+        pAssetTypeCache->mEvictCount++;
+
+        // Unload the asset.
+        unloadAsset( pAssetDefinition );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::recordAssetCacheMiss( AssetDefinition* pAssetDefinition )
+{
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.find( pAssetDefinition->mAssetType );
+
+    // Record the miss.
+    if ( cacheItr != mAssetTypeCaches.end() )
+        cacheItr->value->mMissCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::setAssetTypeMemoryBudget( const char* pAssetType, const U32 memoryBudget )
+{
+    // Sanity!
+    AssertFatal( pAssetType != NULL, "Cannot set memory budget for NULL asset type." );
+
+    // Fetch asset type.
+    StringTableEntry assetType = StringTable->insert( pAssetType );
+
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::iterator cacheItr = mAssetTypeCaches.find( assetType );
+
+    AssetTypeCache* pAssetTypeCache;
+
+    // Did we find one?
+    if ( cacheItr == mAssetTypeCaches.end() )
+    {
+        // No, so create one.
+        pAssetTypeCache = new AssetTypeCache;
+        mAssetTypeCaches.insert( assetType, pAssetTypeCache );
+    }
+    else
+    {
+        pAssetTypeCache = cacheItr->value;
+    }
+
+    // Set the budget.
+    pAssetTypeCache->mMemoryBudget = memoryBudget;
+
+    // Evict anything now over budget.
+    trimAssetTypeCache( pAssetTypeCache );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::getAssetTypeMemoryBudget( const char* pAssetType ) const
+{
+    // Find the asset type cache.
+    const AssetTypeCache* pAssetTypeCache = findAssetTypeCache( pAssetType );
+
+    return pAssetTypeCache == NULL ? 0 : pAssetTypeCache->mMemoryBudget;
+}
+
+//-----------------------------------------------------------------------------
+
+const AssetTypeCache* AssetManager::findAssetTypeCache( const char* pAssetType ) const
+{
+    // Sanity!
+    AssertFatal( pAssetType != NULL, "Cannot find asset type cache for NULL asset type." );
+
+    // Find the asset type cache.
+    typeAssetTypeCacheHash::const_iterator cacheItr = mAssetTypeCaches.find( StringTable->insert( pAssetType ) );
+
+    return cacheItr == mAssetTypeCaches.end() ? NULL : cacheItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::getAssetMemorySize( const char* pAssetId )
+{
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( pAssetId );
+
+    // Finish if the asset is not loaded.
+    if ( pAssetDefinition == NULL || pAssetDefinition->mpAssetBase == NULL )
+        return 0;
+
+    U32 memorySize = pAssetDefinition->mpAssetBase->getAssetMemorySize();
+
+    // Include any shared resources.
+    Vector<AssetSharedMemory> sharedMemory;
+    pAssetDefinition->mpAssetBase->getAssetSharedMemory( sharedMemory );
+    for( Vector<AssetSharedMemory>::iterator sharedItr = sharedMemory.begin(); sharedItr != sharedMemory.end(); ++sharedItr )
+    {
+        memorySize += sharedItr->mMemorySize;
+    }
+
+    return memorySize;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::dumpAssetTypeCaches( void ) const
+{
+    // Info.
+    Con::printSeparator();
+    Con::printf( "Asset Manager: %d asset type cache(s) dump as follows:", mAssetTypeCaches.size() );
+    Con::printBlankLine();
+
+    // Iterate asset type caches.
+    for( typeAssetTypeCacheHash::const_iterator cacheItr = mAssetTypeCaches.begin(); cacheItr != mAssetTypeCaches.end(); ++cacheItr )
+    {
+        const AssetTypeCache* pAssetTypeCache = cacheItr->value;
+
+        // Info.
+        Con::printf( "Type:'%s', Budget:%d, IdleMemory:%d, IdleCount:%d, Hits:%d, Misses:%d, Evictions:%d",
+            cacheItr->key,
+            pAssetTypeCache->mMemoryBudget,
+            pAssetTypeCache->mIdleMemorySize,
+            pAssetTypeCache->mIdleAssetCount,
+            pAssetTypeCache->mHitCount,
+            pAssetTypeCache->mMissCount,
+            pAssetTypeCache->mEvictCount );
+
+        // Iterate idle assets from most to least recently released.
+        for( const AssetDefinition* pAssetDefinition = pAssetTypeCache->mpIdleHead; pAssetDefinition != NULL; pAssetDefinition = pAssetDefinition->mpIdleNext )
+        {
+            Con::printf( "  > AssetId:'%s', Memory:%d", pAssetDefinition->mAssetId, pAssetDefinition->mAssetIdleMemorySize );
+        }
+    }
+
+    // Info.
+    Con::printSeparator();
+    Con::printBlankLine();
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManager::AsyncAssetLoad* AssetManager::findAsyncAssetLoad( StringTableEntry assetId )
+{
+    for( typeAsyncAssetLoadVector::iterator loadItr = mAsyncAssetLoads.begin(); loadItr != mAsyncAssetLoads.end(); ++loadItr )
+    {
+        if ( (*loadItr)->mAssetId == assetId )
+            return *loadItr;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManager::AsyncAssetLoad* AssetManager::createAsyncAssetLoad( StringTableEntry assetId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_CreateAsyncAssetLoad);
+
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( assetId );
+
+    // Did we find the asset?
+    if ( pAssetDefinition == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Failed to asynchronously acquire asset Id '%s' as it does not exist.", assetId );
+        return NULL;
+    }
+
+    // Create the load.
+    AsyncAssetLoad* pAsyncAssetLoad = new AsyncAssetLoad;
+    pAsyncAssetLoad->mAssetId = assetId;
+    pAsyncAssetLoad->mScriptAcquireCount = 0;
+
+    // Queue the bitmap decodes for the asset and its dependencies.
+    Vector<StringTableEntry> visitedAssets;
+    queueAsyncBitmapDecodes( pAssetDefinition, pAsyncAssetLoad, visitedAssets );
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Asynchronously acquiring asset Id '%s' with %d bitmap(s) decoding.", assetId, pAsyncAssetLoad->mBitmapKeys.size() );
+    }
+
+    mAsyncAssetLoads.push_back( pAsyncAssetLoad );
+
+    // Process the loads each frame.
+    setProcessTicks( true );
+
+    return pAsyncAssetLoad;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::queueAsyncBitmapDecodes( AssetDefinition* pAssetDefinition, AsyncAssetLoad* pAsyncAssetLoad, Vector<StringTableEntry>& visitedAssets )
+{
+    // Finish if the asset has already been visited.
+    if ( visitedAssets.contains( pAssetDefinition->mAssetId ) )
+        return;
+
+    visitedAssets.push_back( pAssetDefinition->mAssetId );
+
+    // Finish if the asset is already loaded as its dependencies will be too.
+    if ( pAssetDefinition->mpAssetBase != NULL )
+        return;
+
+    // Queue decoding any loose files that are bitmaps.
+    for( Vector<StringTableEntry>::iterator looseFileItr = pAssetDefinition->mAssetLooseFiles.begin(); looseFileItr != pAssetDefinition->mAssetLooseFiles.end(); ++looseFileItr )
+    {
+        if ( TextureManager::queueBitmapDecode( *looseFileItr ) && !pAsyncAssetLoad->mBitmapKeys.contains( *looseFileItr ) )
+            pAsyncAssetLoad->mBitmapKeys.push_back( *looseFileItr );
+    }
+
+    // Find any asset dependencies.
+    typeAssetDependsOnHash::iterator dependsOnItr = mAssetDependsOn.find( pAssetDefinition->mAssetId );
+
+    // Iterate all dependencies.
+    while( dependsOnItr != mAssetDependsOn.end() && dependsOnItr->key == pAssetDefinition->mAssetId )
+    {
+        AssetDefinition* pDependencyAssetDefinition = findAsset( dependsOnItr->value );
+
+        if ( pDependencyAssetDefinition != NULL )
+            queueAsyncBitmapDecodes( pDependencyAssetDefinition, pAsyncAssetLoad, visitedAssets );
+
+        // Next dependency.
+        dependsOnItr++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::isAsyncAssetLoadReady( const AsyncAssetLoad* pAsyncAssetLoad ) const
+{
+    for( Vector<StringTableEntry>::const_iterator keyItr = pAsyncAssetLoad->mBitmapKeys.begin(); keyItr != pAsyncAssetLoad->mBitmapKeys.end(); ++keyItr )
+    {
+        if ( TextureManager::isBitmapDecodePending( *keyItr ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::completeAsyncAssetLoad( AsyncAssetLoad* pAsyncAssetLoad )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_CompleteAsyncAssetLoad);
+
+    // Flag as completing so that cancelling from the callbacks is seen.
+    AsyncAssetLoad* pPreviousCompletingAsyncLoad = mpCompletingAsyncLoad;
+    mpCompletingAsyncLoad = pAsyncAssetLoad;
+
+    // Complete the asset pointers.
+    // NOTE: The first acquire loads the asset which claims the decoded bitmaps when uploading its textures.
+    while( pAsyncAssetLoad->mAcquires.size() > 0 )
+    {
+        AsyncAcquire acquire = pAsyncAssetLoad->mAcquires.first();
+        pAsyncAssetLoad->mAcquires.pop_front();
+
+        acquire.mpAssetPtrBase->completeAsyncAcquire();
+
+        if ( acquire.mpCallback != NULL )
+            acquire.mpCallback->onAssetAcquired( acquire.mpAssetPtrBase );
+    }
+
+    // Complete the script acquires.
+    while( pAsyncAssetLoad->mScriptAcquireCount > 0 )
+    {
+        pAsyncAssetLoad->mScriptAcquireCount--;
+
+        AssetBase* pAssetBase = acquireAsset<AssetBase>( pAsyncAssetLoad->mAssetId );
+
+        if ( isMethod( "onAsyncAssetAcquired" ) )
+            Con::executef( this, 3, "onAsyncAssetAcquired", pAsyncAssetLoad->mAssetId, pAssetBase != NULL ? pAssetBase->getIdString() : StringTable->EmptyString );
+    }
+
+    mpCompletingAsyncLoad = pPreviousCompletingAsyncLoad;
+
+    // Discard anything left over.
+    discardAsyncAssetLoad( pAsyncAssetLoad );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::discardAsyncAssetLoad( AsyncAssetLoad* pAsyncAssetLoad )
+{
+    // Discard any decoded bitmaps the asset did not claim unless another load is waiting on them.
+    for( Vector<StringTableEntry>::iterator keyItr = pAsyncAssetLoad->mBitmapKeys.begin(); keyItr != pAsyncAssetLoad->mBitmapKeys.end(); ++keyItr )
+    {
+        bool keyShared = false;
+        for( typeAsyncAssetLoadVector::iterator loadItr = mAsyncAssetLoads.begin(); loadItr != mAsyncAssetLoads.end() && !keyShared; ++loadItr )
+        {
+            keyShared = (*loadItr)->mBitmapKeys.contains( *keyItr );
+        }
+
+        if ( !keyShared )
+            TextureManager::discardDecodedBitmap( *keyItr );
+    }
+
+    delete pAsyncAssetLoad;
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::onModulePreLoad( ModuleDefinition* pModuleDefinition )
 {
     // Debug Profiling.
@@ -59,17 +59,22 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
 class AssetPtrCallback;
+class AssetManifestCache;
 class AssetPtrBase;
 
 //-----------------------------------------------------------------------------
 
-class AssetManager : public SimObject, public ModuleCallbacks
+class AssetManager : public SimObject, public ModuleCallbacks, public virtual Tickable
 {
 private:
     typedef SimObject Parent;
@@ -82,6 +87,24 @@ private:
     typedef HashTable<typeAssetId, typeAssetId> typeAssetIsDependedOnHash;
     typedef HashMap<AssetPtrBase*, AssetPtrCallback*> typeAssetPtrRefreshHash;
 
+    /// Asynchronous acquire.
+    struct AsyncAcquire
+    {
+        AssetPtrBase*       mpAssetPtrBase;
+        AssetPtrCallback*   mpCallback;
+    };
+
+    /// Asynchronous asset load.
+    struct AsyncAssetLoad
+    {
+        typeAssetId                 mAssetId;
+        Vector<StringTableEntry>    mBitmapKeys;
+        Vector<AsyncAcquire>        mAcquires;
+        U32                         mScriptAcquireCount;
+    };
+    typedef Vector<AsyncAssetLoad*> typeAsyncAssetLoadVector;
+    typedef HashMap<StringTableEntry, AssetTypeCache*> typeAssetTypeCacheHash;
+
     /// Declared assets.
     typeDeclaredAssetsHash              mDeclaredAssets;
 
@@ -99,9 +122,18 @@ private:
     /// Asset pointer refresh notifications.
     typeAssetPtrRefreshHash             mAssetPtrRefreshNotifications;
 
+    /// Asynchronous asset loads.
+    typeAsyncAssetLoadVector            mAsyncAssetLoads;
+    AsyncAssetLoad*                     mpCompletingAsyncLoad;
+    U32                                 mAsyncUploadBudget;
+
+    /// Idle asset caches.
+    typeAssetTypeCacheHash              mAssetTypeCaches;
+
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
+    bool                                mUseManifestCache;
     U32                                 mLoadedInternalAssetsCount;
     U32                                 mLoadedExternalAssetsCount;
     U32                                 mLoadedPrivateAssetsCount;
@@ -113,7 +145,7 @@ private:
 
 public:
     AssetManager();
-    virtual ~AssetManager() {}
+    virtual ~AssetManager();
 
     /// SimObject overrides
     virtual bool onAdd();
@@ -237,6 +269,9 @@ public:
             // Increase loaded count.
             pAssetDefinition->mAssetLoadedCount++;
 
+            // Record the load against any idle cache for the asset type.
+            recordAssetCacheMiss( pAssetDefinition );
+
             // Info.
             if ( mEchoInfo )
             {
@@ -281,6 +316,13 @@ public:
             return NULL;
         }
 
+        // Is the asset in the idle cache?
+        if ( pAssetDefinition->mAssetIdle )
+        {
+            // Yes, so take it out.
+            reviveIdleAsset( pAssetDefinition );
+        }
+
         // Acquire asset reference.
         pAcquiredAsset->acquireAssetReference();
 
@@ -331,6 +373,24 @@ public:
     void registerAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback );
     void unregisterAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase );
 
+    /// Asynchronous asset acquisition.
+    /// NOTE: Bitmaps the asset (and its dependencies) use are decoded on background threads.  The asset
+    /// itself is loaded on the main thread once they are ready, limited by the upload budget each frame.
+    bool acquireAssetAsync( const char* pAssetId, AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback = NULL );
+    bool acquireAssetAsync( const char* pAssetId );
+    void cancelAsyncAcquire( AssetPtrBase* pAssetPtrBase );
+    void processAsyncLoads( const bool flush = false );
+    inline U32 getAsyncLoadCount( void ) const { return (U32)mAsyncAssetLoads.size(); }
+    inline void setAsyncUploadBudget( const U32 budget ) { mAsyncUploadBudget = budget; }
+    inline U32 getAsyncUploadBudget( void ) const { return mAsyncUploadBudget; }
+
+    /// Idle asset cache.
+    void setAssetTypeMemoryBudget( const char* pAssetType, const U32 memoryBudget );
+    U32 getAssetTypeMemoryBudget( const char* pAssetType ) const;
+    const AssetTypeCache* findAssetTypeCache( const char* pAssetType ) const;
+    U32 getAssetMemorySize( const char* pAssetId );
+    void dumpAssetTypeCaches( void ) const;
+
     /// Asset tags.
     bool loadAssetTags( ModuleDefinition* pModuleDefinition );
     bool saveAssetTags( void );
@@ -371,8 +431,8 @@ public:
     DECLARE_CONOBJECT( AssetManager );
 
 private:
-    bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition );
-    bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse );
+    bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition, AssetManifestCache* pManifestCache );
+    bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse, AssetManifestCache* pManifestCache );
     AssetDefinition* findAsset( const char* pAssetId );
     void addReferencedAsset( StringTableEntry assetId, StringTableEntry referenceFilePath );
     void renameAssetReferences( StringTableEntry assetIdFrom, StringTableEntry assetIdTo );
@@ -381,6 +441,22 @@ private:
     void removeAssetDependencies( const char* pAssetId );
     void removeAssetLooseFiles( const char* pAssetId );
     void unloadAsset( AssetDefinition* pAssetDefinition );
+    bool cacheIdleAsset( AssetDefinition* pAssetDefinition );
+    void reviveIdleAsset( AssetDefinition* pAssetDefinition );
+    void unlinkIdleAsset( AssetDefinition* pAssetDefinition );
+    void trimAssetTypeCache( AssetTypeCache* pAssetTypeCache );
+    void recordAssetCacheMiss( AssetDefinition* pAssetDefinition );
+    AsyncAssetLoad* findAsyncAssetLoad( StringTableEntry assetId );
+    AsyncAssetLoad* createAsyncAssetLoad( StringTableEntry assetId );
+    void queueAsyncBitmapDecodes( AssetDefinition* pAssetDefinition, AsyncAssetLoad* pAsyncAssetLoad, Vector<StringTableEntry>& visitedAssets );
+    bool isAsyncAssetLoadReady( const AsyncAssetLoad* pAsyncAssetLoad ) const;
+    void completeAsyncAssetLoad( AsyncAssetLoad* pAsyncAssetLoad );
+    void discardAsyncAssetLoad( AsyncAssetLoad* pAsyncAssetLoad );
+
+    /// Tickable.
+    virtual void interpolateTick( F32 delta ) {}
+    virtual void processTick( void ) {}
+    virtual void advanceTime( F32 timeDelta );
 
     /// Module callbacks.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
@@ -356,6 +356,30 @@ ConsoleMethodWithDocs( AssetManager, acquireAsset, ConsoleString, 3, 4, (assetId
 
 //-----------------------------------------------------------------------------
 
+/*! Acquire the specified asset Id without blocking.
+    Any bitmaps the asset uses are decoded in the background and the asset is acquired once they are ready.
+    The asset manager callback 'onAsyncAssetAcquired(assetId, assetObjectId)' is called when it has been acquired.
+    The asset must be released using 'releaseAsset' once it has been acquired.
+    @param assetId The selected asset Id.
+    @return Whether the asset acquire was queued or not.
+*/
+ConsoleMethodWithDocs( AssetManager, acquireAssetAsync, ConsoleBool, 3, 3, (assetId))
+{
+    return object->acquireAssetAsync( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of assets that are still being acquired asynchronously.
+    @return Returns the number of assets that are still being acquired asynchronously.
+*/
+ConsoleMethodWithDocs( AssetManager, getAsyncLoadCount, ConsoleInt, 2, 2, ())
+{
+    return object->getAsyncLoadCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Release the specified asset Id.
     The asset should have been acquired using 'acquireAsset'.
     @param assetId The selected asset Id.
@@ -974,6 +998,82 @@ ConsoleMethodWithDocs( AssetManager, getMaxLoadedExternalAssetCount, ConsoleBool
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the memory budget for idle assets of the specified type.
+    Auto-unload assets of the type stay loaded once released until the budget is exceeded, at which point the least recently released are unloaded.
+    A budget of zero unloads the assets as soon as they are released.
+    @param assetType The asset type i.e. 'ImageAsset'.
+    @param memoryBudget The memory budget in bytes.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, setAssetTypeMemoryBudget, ConsoleVoid, 4, 4, (assetType, memoryBudget))
+{
+    const S32 memoryBudget = dAtoi( argv[3] );
+
+    object->setAssetTypeMemoryBudget( argv[2], memoryBudget < 0 ? 0 : (U32)memoryBudget );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory budget for idle assets of the specified type.
+    @param assetType The asset type i.e. 'ImageAsset'.
+    @return The memory budget in bytes.
+*/
+ConsoleMethodWithDocs( AssetManager, getAssetTypeMemoryBudget, ConsoleInt, 3, 3, (assetType))
+{
+    return object->getAssetTypeMemoryBudget( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the idle cache metrics for the specified asset type.
+    @param assetType The asset type i.e. 'ImageAsset'.
+    @return The metrics formatted as "budget idleMemory idleCount hits misses evictions" or nothing if the type has no budget set.
+*/
+ConsoleMethodWithDocs( AssetManager, getAssetTypeCacheMetrics, ConsoleString, 3, 3, (assetType))
+{
+    // Find the asset type cache.
+    const AssetTypeCache* pAssetTypeCache = object->findAssetTypeCache( argv[2] );
+
+    // Finish if not found.
+    if ( pAssetTypeCache == NULL )
+        return StringTable->EmptyString;
+
+    // Format metrics.
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%d %d %d %d %d %d",
+        pAssetTypeCache->mMemoryBudget,
+        pAssetTypeCache->mIdleMemorySize,
+        pAssetTypeCache->mIdleAssetCount,
+        pAssetTypeCache->mHitCount,
+        pAssetTypeCache->mMissCount,
+        pAssetTypeCache->mEvictCount );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory the specified asset keeps resident, including its textures.
+    @param assetId The selected asset Id.
+    @return The memory in bytes or zero if the asset is not loaded.
+*/
+ConsoleMethodWithDocs( AssetManager, getAssetMemorySize, ConsoleInt, 3, 3, (assetId))
+{
+    return object->getAssetMemorySize( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the idle asset caches of all asset types that have a memory budget.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, dumpAssetTypeCaches, ConsoleVoid, 2, 2, ())
+{
+    object->dumpAssetTypeCaches();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Dumps a breakdown of all declared assets.
     @return No return value.
 */
@@ -0,0 +1,567 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assetManifestCache.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _CRC_H_
+#include "algorithm/crc.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+/// Manifest identification.
+static const U32 sManifestSignature = 0x434D4154; // "TAMC".
+static const U32 sManifestVersion = 1;
+
+/// Longest string stored in the manifest.
+static const U32 sManifestStringMaxLength = 1023;
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readManifestString( Stream& stream )
+{
+    char stringBuffer[sManifestStringMaxLength+1];
+    stringBuffer[0] = 0;
+    stream.readLongString( sManifestStringMaxLength, stringBuffer );
+    return StringTable->insert( stringBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readManifestStrings( Stream& stream, Vector<StringTableEntry>& strings )
+{
+    U32 stringCount = 0;
+    stream.read( &stringCount );
+
+    // Each string takes at least its length so reject counts that cannot fit.
+    if ( stream.getStatus() != Stream::Ok || stringCount > stream.getStreamSize() )
+        return false;
+
+    strings.setSize( stringCount );
+    for ( U32 index = 0; index < stringCount; ++index )
+    {
+        strings[index] = readManifestString( stream );
+    }
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeManifestStrings( Stream& stream, const Vector<StringTableEntry>& strings )
+{
+    stream.write( (U32)strings.size() );
+    for ( Vector<StringTableEntry>::const_iterator itr = strings.begin(); itr != strings.end(); ++itr )
+    {
+        stream.writeLongString( sManifestStringMaxLength, *itr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void readFileStamp( Stream& stream, AssetManifestCache::FileStamp& fileStamp )
+{
+    stream.read( sizeof(FileTime), &fileStamp.mModifyTime );
+    stream.read( &fileStamp.mFileSize );
+    stream.read( &fileStamp.mContentHash );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeFileStamp( Stream& stream, const AssetManifestCache::FileStamp& fileStamp )
+{
+    stream.write( sizeof(FileTime), &fileStamp.mModifyTime );
+    stream.write( fileStamp.mFileSize );
+    stream.write( fileStamp.mContentHash );
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::AssetManifestCache() :
+    mManifestFilePath( StringTable->EmptyString ),
+    mDirty( false )
+{
+    // Build the CRC table here so that the job workers never race to build it when hashing.
+    calculateCRC( NULL, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::~AssetManifestCache()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::clear( void )
+{
+    for( typeDeclaredAssetRecordHash::iterator itr = mDeclaredAssetRecords.begin(); itr != mDeclaredAssetRecords.end(); ++itr )
+    {
+        delete itr->value;
+    }
+    mDeclaredAssetRecords.clear();
+
+    for( typeReferencedAssetRecordHash::iterator itr = mReferencedAssetRecords.begin(); itr != mReferencedAssetRecords.end(); ++itr )
+    {
+        delete itr->value;
+    }
+    mReferencedAssetRecords.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::load( const char* pManifestFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Load);
+
+    // Sanity!
+    AssertFatal( pManifestFilePath != NULL, "Cannot load asset manifest cache from a NULL file-path." );
+
+    // Reset the cache.
+    clear();
+    mManifestFilePath = StringTable->insert( pManifestFilePath );
+    mDirty = false;
+
+    FileStream fileStream;
+
+    // Finish if there's no manifest yet.
+    if ( !fileStream.open( mManifestFilePath, FileStream::Read ) )
+        return false;
+
+    // Read the whole manifest in one go and decode it from memory.
+    const U32 manifestSize = fileStream.getStreamSize();
+    Vector<U8> manifestBuffer;
+    manifestBuffer.setSize( manifestSize );
+    const bool manifestRead = manifestSize > 0 && fileStream.read( manifestSize, manifestBuffer.address() );
+    fileStream.close();
+
+    if ( !manifestRead )
+        return false;
+
+    MemStream memStream( manifestSize, manifestBuffer.address(), true, false );
+
+    // Read the manifest.
+    if ( !readManifest( memStream ) )
+    {
+        // Discard anything partially read and rebuild the manifest.
+        clear();
+        mDirty = true;
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::save( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Save);
+
+    // Finish if nothing changed.
+    if ( !mDirty )
+        return true;
+
+    // Sanity!
+    AssertFatal( mManifestFilePath != StringTable->EmptyString, "Cannot save asset manifest cache without a file-path." );
+
+    FileStream fileStream;
+
+    // Finish if the module location cannot be written to.
+    if ( !fileStream.open( mManifestFilePath, FileStream::Write ) )
+        return false;
+
+    writeManifest( fileStream );
+    const bool status = fileStream.getStatus() == Stream::Ok;
+    fileStream.close();
+
+    // Flag as clean.
+    if ( status )
+        mDirty = false;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::readManifest( Stream& stream )
+{
+    // Read the header.
+    U32 signature = 0;
+    U32 version = 0;
+    U32 fileTimeSize = 0;
+    stream.read( &signature );
+    stream.read( &version );
+    stream.read( &fileTimeSize );
+
+    // Reject manifests from another version or platform.
+    if ( stream.getStatus() != Stream::Ok || signature != sManifestSignature || version != sManifestVersion || fileTimeSize != sizeof(FileTime) )
+        return false;
+
+    // Read the declared asset records.
+    U32 recordCount = 0;
+    stream.read( &recordCount );
+    for ( U32 index = 0; index < recordCount; ++index )
+    {
+        StringTableEntry assetFilePath = readManifestString( stream );
+
+        DeclaredAssetRecord* pRecord = new DeclaredAssetRecord;
+        pRecord->mUsed = false;
+        readFileStamp( stream, pRecord->mFileStamp );
+        pRecord->mAssetName = readManifestString( stream );
+        pRecord->mAssetDescription = readManifestString( stream );
+        pRecord->mAssetCategory = readManifestString( stream );
+        pRecord->mAssetType = readManifestString( stream );
+        U8 flags = 0;
+        stream.read( &flags );
+        pRecord->mAssetAutoUnload = (flags & BIT(0)) != 0;
+        pRecord->mAssetInternal = (flags & BIT(1)) != 0;
+
+        // Store the record before validating it so that it is freed on failure.
+        typeDeclaredAssetRecordHash::iterator itr = mDeclaredAssetRecords.find( assetFilePath );
+        if ( itr != mDeclaredAssetRecords.end() )
+        {
+            delete itr->value;
+            itr->value = pRecord;
+        }
+        else
+        {
+            mDeclaredAssetRecords.insert( assetFilePath, pRecord );
+        }
+
+        if ( !readManifestStrings( stream, pRecord->mAssetDependencies ) || !readManifestStrings( stream, pRecord->mAssetLooseFiles ) )
+            return false;
+    }
+
+    // Read the referenced asset records.
+    recordCount = 0;
+    stream.read( &recordCount );
+    for ( U32 index = 0; index < recordCount; ++index )
+    {
+        StringTableEntry referenceFilePath = readManifestString( stream );
+
+        ReferencedAssetRecord* pRecord = new ReferencedAssetRecord;
+        pRecord->mUsed = false;
+        readFileStamp( stream, pRecord->mFileStamp );
+
+        typeReferencedAssetRecordHash::iterator itr = mReferencedAssetRecords.find( referenceFilePath );
+        if ( itr != mReferencedAssetRecords.end() )
+        {
+            delete itr->value;
+            itr->value = pRecord;
+        }
+        else
+        {
+            mReferencedAssetRecords.insert( referenceFilePath, pRecord );
+        }
+
+        if ( !readManifestStrings( stream, pRecord->mAssetIds ) )
+            return false;
+    }
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::writeManifest( Stream& stream ) const
+{
+    // Write the header.
+    stream.write( sManifestSignature );
+    stream.write( sManifestVersion );
+    stream.write( (U32)sizeof(FileTime) );
+
+    // Write the declared asset records.
+    stream.write( (U32)mDeclaredAssetRecords.size() );
+    for( typeDeclaredAssetRecordHash::const_iterator itr = mDeclaredAssetRecords.begin(); itr != mDeclaredAssetRecords.end(); ++itr )
+    {
+        const DeclaredAssetRecord* pRecord = itr->value;
+        stream.writeLongString( sManifestStringMaxLength, itr->key );
+        writeFileStamp( stream, pRecord->mFileStamp );
+        stream.writeLongString( sManifestStringMaxLength, pRecord->mAssetName );
+        stream.writeLongString( sManifestStringMaxLength, pRecord->mAssetDescription );
+        stream.writeLongString( sManifestStringMaxLength, pRecord->mAssetCategory );
+        stream.writeLongString( sManifestStringMaxLength, pRecord->mAssetType );
+        const U8 flags = (pRecord->mAssetAutoUnload ? BIT(0) : 0) | (pRecord->mAssetInternal ? BIT(1) : 0);
+        stream.write( flags );
+        writeManifestStrings( stream, pRecord->mAssetDependencies );
+        writeManifestStrings( stream, pRecord->mAssetLooseFiles );
+    }
+
+    // Write the referenced asset records.
+    stream.write( (U32)mReferencedAssetRecords.size() );
+    for( typeReferencedAssetRecordHash::const_iterator itr = mReferencedAssetRecords.begin(); itr != mReferencedAssetRecords.end(); ++itr )
+    {
+        const ReferencedAssetRecord* pRecord = itr->value;
+        stream.writeLongString( sManifestStringMaxLength, itr->key );
+        writeFileStamp( stream, pRecord->mFileStamp );
+        writeManifestStrings( stream, pRecord->mAssetIds );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::useDeclaredAsset( StringTableEntry assetFilePath, const FileStamp& fileStamp )
+{
+    typeDeclaredAssetRecordHash::iterator itr = mDeclaredAssetRecords.find( assetFilePath );
+
+    // Sanity!
+    AssertFatal( itr != mDeclaredAssetRecords.end(), "Cannot use a declared asset record that does not exist." );
+
+    DeclaredAssetRecord* pRecord = itr->value;
+    pRecord->mUsed = true;
+
+    // Refresh the stamp if the file was touched without its content changing.
+    if ( Platform::compareFileTimes( pRecord->mFileStamp.mModifyTime, fileStamp.mModifyTime ) != 0 )
+    {
+        pRecord->mFileStamp = fileStamp;
+        mDirty = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::storeDeclaredAsset( StringTableEntry assetFilePath, const FileStamp& fileStamp, TamlAssetDeclaredVisitor& assetDeclaredVisitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_StoreDeclaredAsset);
+
+    // Find or create the record.
+    DeclaredAssetRecord* pRecord;
+    typeDeclaredAssetRecordHash::iterator itr = mDeclaredAssetRecords.find( assetFilePath );
+    if ( itr != mDeclaredAssetRecords.end() )
+    {
+        pRecord = itr->value;
+    }
+    else
+    {
+        pRecord = new DeclaredAssetRecord;
+        mDeclaredAssetRecords.insert( assetFilePath, pRecord );
+    }
+
+    // Fetch asset definition.
+    const AssetDefinition& assetDefinition = assetDeclaredVisitor.getAssetDefinition();
+
+    pRecord->mFileStamp = fileStamp;
+    pRecord->mUsed = true;
+    pRecord->mAssetName = assetDefinition.mAssetName;
+    pRecord->mAssetDescription = assetDefinition.mAssetDescription;
+    pRecord->mAssetCategory = assetDefinition.mAssetCategory;
+    pRecord->mAssetType = assetDefinition.mAssetType;
+    pRecord->mAssetAutoUnload = assetDefinition.mAssetAutoUnload;
+    pRecord->mAssetInternal = assetDefinition.mAssetInternal;
+    pRecord->mAssetDependencies = assetDeclaredVisitor.getAssetDependencies();
+    pRecord->mAssetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+
+    // Flag as dirty.
+    mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::pruneDeclaredAssets( void )
+{
+    // Remove records for asset files that were not encountered.
+    Vector<StringTableEntry> prunedFilePaths;
+    for( typeDeclaredAssetRecordHash::iterator itr = mDeclaredAssetRecords.begin(); itr != mDeclaredAssetRecords.end(); ++itr )
+    {
+        if ( !itr->value->mUsed )
+            prunedFilePaths.push_back( itr->key );
+    }
+
+    for ( Vector<StringTableEntry>::iterator itr = prunedFilePaths.begin(); itr != prunedFilePaths.end(); ++itr )
+    {
+        typeDeclaredAssetRecordHash::iterator recordItr = mDeclaredAssetRecords.find( *itr );
+        delete recordItr->value;
+        mDeclaredAssetRecords.erase( recordItr );
+        mDirty = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::restoreDeclaredAsset( const DeclaredAssetRecord& record, StringTableEntry assetFilePath, TamlAssetDeclaredVisitor& assetDeclaredVisitor )
+{
+    // Populate the visitor as if the asset file had been parsed.
+    assetDeclaredVisitor.clear();
+
+    AssetDefinition& assetDefinition = assetDeclaredVisitor.getAssetDefinition();
+    assetDefinition.mAssetName = record.mAssetName;
+    assetDefinition.mAssetDescription = record.mAssetDescription;
+    assetDefinition.mAssetCategory = record.mAssetCategory;
+    assetDefinition.mAssetType = record.mAssetType;
+    assetDefinition.mAssetAutoUnload = record.mAssetAutoUnload;
+    assetDefinition.mAssetInternal = record.mAssetInternal;
+    assetDefinition.mAssetBaseFilePath = assetFilePath;
+
+    assetDeclaredVisitor.getAssetDependencies() = record.mAssetDependencies;
+    assetDeclaredVisitor.getAssetLooseFiles() = record.mAssetLooseFiles;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::useReferencedAsset( StringTableEntry referenceFilePath, const FileStamp& fileStamp )
+{
+    typeReferencedAssetRecordHash::iterator itr = mReferencedAssetRecords.find( referenceFilePath );
+
+    // Sanity!
+    AssertFatal( itr != mReferencedAssetRecords.end(), "Cannot use a referenced asset record that does not exist." );
+
+    ReferencedAssetRecord* pRecord = itr->value;
+    pRecord->mUsed = true;
+
+    // Refresh the stamp if the file was touched without its content changing.
+    if ( Platform::compareFileTimes( pRecord->mFileStamp.mModifyTime, fileStamp.mModifyTime ) != 0 )
+    {
+        pRecord->mFileStamp = fileStamp;
+        mDirty = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::storeReferencedAsset( StringTableEntry referenceFilePath, const FileStamp& fileStamp, const TamlAssetReferencedVisitor::typeAssetReferencedHash& assetReferencedMap )
+{
+    // Find or create the record.
+    ReferencedAssetRecord* pRecord;
+    typeReferencedAssetRecordHash::iterator itr = mReferencedAssetRecords.find( referenceFilePath );
+    if ( itr != mReferencedAssetRecords.end() )
+    {
+        pRecord = itr->value;
+    }
+    else
+    {
+        pRecord = new ReferencedAssetRecord;
+        mReferencedAssetRecords.insert( referenceFilePath, pRecord );
+    }
+
+    pRecord->mFileStamp = fileStamp;
+    pRecord->mUsed = true;
+    pRecord->mAssetIds.clear();
+    for( TamlAssetReferencedVisitor::typeAssetReferencedHash::const_iterator usageItr = assetReferencedMap.begin(); usageItr != assetReferencedMap.end(); ++usageItr )
+    {
+        pRecord->mAssetIds.push_back( usageItr->key );
+    }
+
+    // Flag as dirty.
+    mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::pruneReferencedAssets( void )
+{
+    // Remove records for files that were not encountered.
+    Vector<StringTableEntry> prunedFilePaths;
+    for( typeReferencedAssetRecordHash::iterator itr = mReferencedAssetRecords.begin(); itr != mReferencedAssetRecords.end(); ++itr )
+    {
+        if ( !itr->value->mUsed )
+            prunedFilePaths.push_back( itr->key );
+    }
+
+    for ( Vector<StringTableEntry>::iterator itr = prunedFilePaths.begin(); itr != prunedFilePaths.end(); ++itr )
+    {
+        typeReferencedAssetRecordHash::iterator recordItr = mReferencedAssetRecords.find( *itr );
+        delete recordItr->value;
+        mReferencedAssetRecords.erase( recordItr );
+        mDirty = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::getFileStamp( const char* pFilePath, FileStamp& fileStamp )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_GetFileStamp);
+
+    // Fetch the file modification time and size.
+    if ( !Platform::getFileTimes( pFilePath, NULL, &fileStamp.mModifyTime ) )
+        return false;
+
+    const S32 fileSize = Platform::getFileSize( pFilePath );
+    if ( fileSize < 0 )
+        return false;
+
+    fileStamp.mFileSize = (U32)fileSize;
+
+    // Hash the file content.
+    FileStream fileStream;
+    if ( !fileStream.open( pFilePath, FileStream::Read ) )
+        return false;
+
+    fileStamp.mContentHash = calculateCRCStream( &fileStream );
+    fileStream.close();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::validateFileStamp( const char* pFilePath, const FileStamp& cachedFileStamp, FileStamp& fileStamp )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_ValidateFileStamp);
+
+    // Fetch the file modification time and size.
+    if ( !Platform::getFileTimes( pFilePath, NULL, &fileStamp.mModifyTime ) )
+        return false;
+
+    const S32 fileSize = Platform::getFileSize( pFilePath );
+
+    // A different size means the content has changed.
+    if ( fileSize < 0 || (U32)fileSize != cachedFileStamp.mFileSize )
+        return false;
+
+    fileStamp.mFileSize = (U32)fileSize;
+
+    // An unchanged modification time is trusted without reading the file.
+    if ( Platform::compareFileTimes( fileStamp.mModifyTime, cachedFileStamp.mModifyTime ) == 0 )
+    {
+        fileStamp.mContentHash = cachedFileStamp.mContentHash;
+        return true;
+    }
+
+    // The file was touched so only trust the record if the content is unchanged.
+    FileStream fileStream;
+    if ( !fileStream.open( pFilePath, FileStream::Read ) )
+        return false;
+
+    fileStamp.mContentHash = calculateCRCStream( &fileStream );
+    fileStream.close();
+
+    return fileStamp.mContentHash == cachedFileStamp.mContentHash;
+}
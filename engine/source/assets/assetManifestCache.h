@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#define _ASSET_MANIFEST_CACHE_H_
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _TAML_ASSET_DECLARED_VISITOR_H_
+#include "tamlAssetDeclaredVisitor.h"
+#endif
+
+#ifndef _TAML_ASSET_REFERENCED_VISITOR_H_
+#include "tamlAssetReferencedVisitor.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_MANIFEST_CACHE_FILENAME   "assetManifest.cache"
+
+//-----------------------------------------------------------------------------
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Binary on-disk record of what scanning a module's asset files produced.
+/// Each record is keyed by asset file-path and stamped with the file modification time,
+/// size and content hash so that only files which have changed need to be parsed again.
+class AssetManifestCache
+{
+public:
+    /// Validation stamp for a scanned file.
+    struct FileStamp
+    {
+        FileTime                    mModifyTime;
+        U32                         mFileSize;
+        U32                         mContentHash;
+    };
+
+    /// Declared asset record.
+    struct DeclaredAssetRecord
+    {
+        FileStamp                   mFileStamp;
+        bool                        mUsed;
+        StringTableEntry            mAssetName;
+        StringTableEntry            mAssetDescription;
+        StringTableEntry            mAssetCategory;
+        StringTableEntry            mAssetType;
+        bool                        mAssetAutoUnload;
+        bool                        mAssetInternal;
+        Vector<StringTableEntry>    mAssetDependencies;
+        Vector<StringTableEntry>    mAssetLooseFiles;
+    };
+
+    /// Referenced asset record.
+    struct ReferencedAssetRecord
+    {
+        FileStamp                   mFileStamp;
+        bool                        mUsed;
+        Vector<StringTableEntry>    mAssetIds;
+    };
+
+private:
+    typedef HashMap<StringTableEntry, DeclaredAssetRecord*> typeDeclaredAssetRecordHash;
+    typedef HashMap<StringTableEntry, ReferencedAssetRecord*> typeReferencedAssetRecordHash;
+
+    StringTableEntry                mManifestFilePath;
+    typeDeclaredAssetRecordHash     mDeclaredAssetRecords;
+    typeReferencedAssetRecordHash   mReferencedAssetRecords;
+    bool                            mDirty;
+
+private:
+    void clear( void );
+    bool readManifest( Stream& stream );
+    void writeManifest( Stream& stream ) const;
+
+public:
+    AssetManifestCache();
+    ~AssetManifestCache();
+
+    /// Persistence.
+    bool load( const char* pManifestFilePath );
+    bool save( void );
+    inline StringTableEntry getManifestFilePath( void ) const { return mManifestFilePath; }
+    inline bool isDirty( void ) const { return mDirty; }
+
+    /// Declared assets.
+    /// NOTE: Finding a record is safe from the job workers as long as nothing is being stored.
+    inline const DeclaredAssetRecord* findDeclaredAsset( StringTableEntry assetFilePath ) const { typeDeclaredAssetRecordHash::const_iterator itr = mDeclaredAssetRecords.find( assetFilePath ); return itr == mDeclaredAssetRecords.end() ? NULL : itr->value; }
+    void useDeclaredAsset( StringTableEntry assetFilePath, const FileStamp& fileStamp );
+    void storeDeclaredAsset( StringTableEntry assetFilePath, const FileStamp& fileStamp, TamlAssetDeclaredVisitor& assetDeclaredVisitor );
+    void pruneDeclaredAssets( void );
+    static void restoreDeclaredAsset( const DeclaredAssetRecord& record, StringTableEntry assetFilePath, TamlAssetDeclaredVisitor& assetDeclaredVisitor );
+
+    /// Referenced assets.
+    inline const ReferencedAssetRecord* findReferencedAsset( StringTableEntry referenceFilePath ) const { typeReferencedAssetRecordHash::const_iterator itr = mReferencedAssetRecords.find( referenceFilePath ); return itr == mReferencedAssetRecords.end() ? NULL : itr->value; }
+    void useReferencedAsset( StringTableEntry referenceFilePath, const FileStamp& fileStamp );
+    void storeReferencedAsset( StringTableEntry referenceFilePath, const FileStamp& fileStamp, const TamlAssetReferencedVisitor::typeAssetReferencedHash& assetReferencedMap );
+    void pruneReferencedAssets( void );
+
+    /// File stamps.
+    static bool getFileStamp( const char* pFilePath, FileStamp& fileStamp );
+    static bool validateFileStamp( const char* pFilePath, const FileStamp& cachedFileStamp, FileStamp& fileStamp );
+};
+
+#endif // _ASSET_MANIFEST_CACHE_H_
@@ -35,16 +35,28 @@ class AssetPtrCallback
 
 protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase ) = 0;    
+    virtual void onAssetAcquired( AssetPtrBase* pAssetPtrBase ) {}
 };
 
 //-----------------------------------------------------------------------------
 
 class AssetPtrBase
 {
+    friend class AssetManager;
+
+protected:
+    StringTableEntry mPendingAssetId;
+
+    /// Called by the asset manager once an asynchronous acquire has finished loading.
+    virtual void completeAsyncAcquire( void ) = 0;
+
 public:
-    AssetPtrBase() {};
+    AssetPtrBase() : mPendingAssetId( NULL ) {};
     virtual ~AssetPtrBase()
     {
+        // Cancel any pending acquire.
+        cancelAsyncAcquire();
+
         // Un-register any notifications.
         unregisterRefreshNotify();
     };
@@ -60,6 +72,22 @@ public:
     virtual bool isNull( void ) const = 0;
     virtual bool notNull( void ) const = 0;
 
+    /// Asynchronous acquisition.
+    inline bool isPending( void ) const { return mPendingAssetId != NULL; }
+    inline StringTableEntry getPendingAssetId( void ) const { return mPendingAssetId; }
+    void cancelAsyncAcquire( void )
+    {
+        // Finish if not pending.
+        if ( !isPending() )
+            return;
+
+        // Cancel the acquire if the asset system is available.
+        if ( AssetDatabase.isProperlyAdded() )
+            AssetDatabase.cancelAsyncAcquire( this );
+
+        mPendingAssetId = NULL;
+    }
+
     /// Notification.
     inline void registerRefreshNotify( AssetPtrCallback* pCallback )
     {
@@ -85,6 +113,17 @@ template<typename T> class AssetPtr : public AssetPtrBase
 private:
     SimObjectPtr<T> mpAsset;
 
+protected:
+    virtual void completeAsyncAcquire( void )
+    {
+        // Fetch the pending asset Id.
+        StringTableEntry assetId = mPendingAssetId;
+        mPendingAssetId = NULL;
+
+        // Acquire asset.
+        mpAsset = AssetDatabase.acquireAsset<T>( assetId );
+    }
+
 public:
     AssetPtr() {}
     AssetPtr( const char* pAssetId )
@@ -107,6 +146,9 @@ public:
     }
     virtual ~AssetPtr()
     {
+        // Cancel any pending acquire.
+        cancelAsyncAcquire();
+
         // Do we have an asset?
         if ( notNull() )
         {
@@ -118,6 +160,9 @@ public:
     /// Assignment.
     AssetPtr<T>& operator=( const char* pAssetId )
     {
+        // Cancel any pending acquire.
+        cancelAsyncAcquire();
+
         // Do we have an asset?
         if ( notNull() )
         {
@@ -157,6 +202,9 @@ public:
     /// Referencing.
     virtual void clear( void )
     {
+        // Cancel any pending acquire.
+        cancelAsyncAcquire();
+
         // Do we have an asset?
         if ( notNull() )
         {
@@ -172,7 +220,33 @@ public:
     T& operator*( void ) const { return *mpAsset; }
     operator T*( void ) const { return mpAsset; }
     virtual void setAssetId( const char* pAssetId ) { *this = pAssetId; }
-    virtual StringTableEntry getAssetId( void ) const { return isNull() ? StringTable->EmptyString : mpAsset->getAssetId(); }
+    virtual StringTableEntry getAssetId( void ) const { return isPending() ? mPendingAssetId : isNull() ? StringTable->EmptyString : mpAsset->getAssetId(); }
+
+    /// Starts acquiring the asset without blocking.
+    /// The pointer stays null (but reports the asset Id) until the asset manager has finished decoding
+    /// the asset's bitmaps off the main thread and loaded the asset, at which point the callback is notified.
+    /// Returns false if the asset Id is invalid.
+    bool setAssetIdAsync( const char* pAssetId, AssetPtrCallback* pCallback = NULL )
+    {
+        // Release any current asset.
+        clear();
+
+        // Finish if this is an invalid asset Id.
+        if ( pAssetId == NULL || *pAssetId == 0 )
+            return false;
+
+        // Flag as pending.
+        mPendingAssetId = StringTable->insert( pAssetId );
+
+        // Queue the acquire.
+        if ( !AssetDatabase.acquireAssetAsync( mPendingAssetId, this, pCallback ) )
+        {
+            mPendingAssetId = NULL;
+            return false;
+        }
+
+        return true;
+    }
     virtual StringTableEntry getAssetType( void ) const { return isNull() ? StringTable->EmptyString : mpAsset->getClassName(); }
     virtual bool isAssetId( const char* pAssetId ) const { return pAssetId == NULL ? isNull() : getAssetId() == StringTable->insert(pAssetId); }
 
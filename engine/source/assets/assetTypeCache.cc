@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assetTypeCache.h"
+
+//-----------------------------------------------------------------------------
+
+AssetTypeCache::AssetTypeCache() :
+    mMemoryBudget( 0 ),
+    mIdleMemorySize( 0 ),
+    mIdleAssetCount( 0 ),
+    mHitCount( 0 ),
+    mMissCount( 0 ),
+    mEvictCount( 0 ),
+    mMemoryUnreported( false ),
+    mpIdleHead( NULL ),
+    mpIdleTail( NULL )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetTypeCache::getIdleMemoryIncrease( const U32 memorySize, const Vector<AssetSharedMemory>& sharedMemory ) const
+{
+    U32 memoryIncrease = memorySize;
+
+    // Only count shared resources no other idle asset holds.
+    for( Vector<AssetSharedMemory>::const_iterator sharedItr = sharedMemory.begin(); sharedItr != sharedMemory.end(); ++sharedItr )
+    {
+        if ( mSharedResources.find( sharedItr->mpResource ) == mSharedResources.end() )
+            memoryIncrease += sharedItr->mMemorySize;
+    }
+
+    return memoryIncrease;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetTypeCache::linkIdleAsset( AssetDefinition* pAssetDefinition, const U32 memorySize, const Vector<AssetSharedMemory>& sharedMemory )
+{
+    // Sanity!
+    AssertFatal( !pAssetDefinition->mAssetIdle, "AssetTypeCache::linkIdleAsset() - Asset is already idle." );
+
+    // Link as the most recently released.
+    pAssetDefinition->mAssetIdle = true;
+    pAssetDefinition->mAssetIdleMemorySize = memorySize;
+    pAssetDefinition->mpIdlePrevious = NULL;
+    pAssetDefinition->mpIdleNext = mpIdleHead;
+    if ( mpIdleHead != NULL )
+        mpIdleHead->mpIdlePrevious = pAssetDefinition;
+    else
+        mpIdleTail = pAssetDefinition;
+    mpIdleHead = pAssetDefinition;
+
+    mIdleMemorySize += memorySize;
+    mIdleAssetCount++;
+
+    // Reference the shared resources, counting each the first time it is seen.
+    pAssetDefinition->mAssetIdleSharedResources.clear();
+    for( Vector<AssetSharedMemory>::const_iterator sharedItr = sharedMemory.begin(); sharedItr != sharedMemory.end(); ++sharedItr )
+    {
+        // Ignore duplicates within the asset.
+        if ( pAssetDefinition->mAssetIdleSharedResources.contains( sharedItr->mpResource ) )
+            continue;
+
+        pAssetDefinition->mAssetIdleSharedResources.push_back( sharedItr->mpResource );
+
+        typeSharedResourceHash::iterator resourceItr = mSharedResources.find( sharedItr->mpResource );
+        if ( resourceItr != mSharedResources.end() )
+        {
+            resourceItr->value.mReferenceCount++;
+            continue;
+        }
+
+        SharedResource sharedResource;
+        sharedResource.mReferenceCount = 1;
+        sharedResource.mMemorySize = sharedItr->mMemorySize;
+        mSharedResources.insert( sharedItr->mpResource, sharedResource );
+        mIdleMemorySize += sharedItr->mMemorySize;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetTypeCache::unlinkIdleAsset( AssetDefinition* pAssetDefinition )
+{
+    // Finish if not idle.
+    if ( !pAssetDefinition->mAssetIdle )
+        return;
+
+    // Unlink.
+    if ( pAssetDefinition->mpIdlePrevious != NULL )
+        pAssetDefinition->mpIdlePrevious->mpIdleNext = pAssetDefinition->mpIdleNext;
+    else
+        mpIdleHead = pAssetDefinition->mpIdleNext;
+
+    if ( pAssetDefinition->mpIdleNext != NULL )
+        pAssetDefinition->mpIdleNext->mpIdlePrevious = pAssetDefinition->mpIdlePrevious;
+    else
+        mpIdleTail = pAssetDefinition->mpIdlePrevious;
+
+    mIdleMemorySize -= pAssetDefinition->mAssetIdleMemorySize;
+    mIdleAssetCount--;
+
+    // Release the shared resources, uncounting each when no idle asset holds it.
+    for( Vector<const void*>::iterator resourceKeyItr = pAssetDefinition->mAssetIdleSharedResources.begin(); resourceKeyItr != pAssetDefinition->mAssetIdleSharedResources.end(); ++resourceKeyItr )
+    {
+        typeSharedResourceHash::iterator resourceItr = mSharedResources.find( *resourceKeyItr );
+
+        // Sanity!
+        AssertFatal( resourceItr != mSharedResources.end(), "AssetTypeCache::unlinkIdleAsset() - Shared resource is not referenced." );
+
+        if ( --resourceItr->value.mReferenceCount == 0 )
+        {
+            mIdleMemorySize -= resourceItr->value.mMemorySize;
+            mSharedResources.erase( resourceItr );
+        }
+    }
+
+    pAssetDefinition->mAssetIdle = false;
+    pAssetDefinition->mAssetIdleMemorySize = 0;
+    pAssetDefinition->mAssetIdleSharedResources.clear();
+    pAssetDefinition->mpIdlePrevious = NULL;
+    pAssetDefinition->mpIdleNext = NULL;
+}
@@ -0,0 +1,90 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_TYPE_CACHE_H_
+#define _ASSET_TYPE_CACHE_H_
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _ASSET_DEFINITION_H_
+#include "assetDefinition.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Resource that a loaded asset may share with other assets, such as a texture.
+struct AssetSharedMemory
+{
+    const void*         mpResource;
+    U32                 mMemorySize;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Idle asset cache for an asset type.
+/// Auto-unload assets of the type stay loaded when released until their memory exceeds the budget,
+/// at which point the least recently released are unloaded.
+/// Shared resources are reference counted across the idle assets so each is only counted once.
+class AssetTypeCache
+{
+private:
+    struct SharedResource
+    {
+        U32             mReferenceCount;
+        U32             mMemorySize;
+    };
+    typedef HashMap<const void*, SharedResource> typeSharedResourceHash;
+
+    typeSharedResourceHash  mSharedResources;
+
+public:
+    U32                 mMemoryBudget;
+    U32                 mIdleMemorySize;
+    U32                 mIdleAssetCount;
+    U32                 mHitCount;
+    U32                 mMissCount;
+    U32                 mEvictCount;
+    bool                mMemoryUnreported;
+    AssetDefinition*    mpIdleHead;
+    AssetDefinition*    mpIdleTail;
+
+public:
+    AssetTypeCache();
+
+    /// Memory linking the asset would add to the cache.
+    U32 getIdleMemoryIncrease( const U32 memorySize, const Vector<AssetSharedMemory>& sharedMemory ) const;
+
+    /// Link/unlink idle assets.
+    void linkIdleAsset( AssetDefinition* pAssetDefinition, const U32 memorySize, const Vector<AssetSharedMemory>& sharedMemory );
+    void unlinkIdleAsset( AssetDefinition* pAssetDefinition );
+
+    /// The least recently released asset if the cache is over budget, otherwise NULL.
+    inline AssetDefinition* getEvictionCandidate( void ) const { return mIdleMemorySize > mMemoryBudget ? mpIdleTail : NULL; }
+};
+
+#endif // _ASSET_TYPE_CACHE_H_
@@ -28,7 +28,7 @@
 #endif
 
 #ifndef _TAML_PARSER_H_
-#include "persistence\/taml/tamlParser.h"
+#include "persistence/taml/tamlParser.h"
 #endif
 
 #ifndef _ASSET_FIELD_TYPES_H_
@@ -56,6 +56,7 @@ public:
     const typeAssetReferencedHash& getAssetReferencedMap( void ) const { return mAssetReferenced; }
 
     void clear( void ) { mAssetReferenced.clear(); }
+    inline void insertAssetReferenced( typeAssetId assetId ) { if ( !mAssetReferenced.contains( assetId ) ) mAssetReferenced.insert( assetId, StringTable->EmptyString ); }
 
     virtual bool wantsPropertyChanges( void ) { return false; }
     virtual bool wantsRootOnly( void ) { return false; }
@@ -82,12 +83,8 @@ public:
         // Get asset Id.
         typeAssetId assetId = StringTable->insert( StringUnit::getUnit( pPropertyValue, 1, ASSET_ASSIGNMENT_TOKEN ) );
 
-        // Finish if we already have this asset Id.
-        if ( mAssetReferenced.contains( assetId ) )
-            return true;
-
         // Insert asset reference.
-        mAssetReferenced.insert( assetId, StringTable->EmptyString );
+        insertAssetReferenced( assetId );
 
         return true;
     }
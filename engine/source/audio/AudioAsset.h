@@ -83,6 +83,9 @@ public:
    void setDescription( const Audio::Description& audioDescription );
    inline const Audio::Description& getAudioDescription( void ) const { return mDescription; }
 
+   /// Audio buffers are owned by the resource manager rather than the asset.
+   virtual U32 getAssetMemorySize( void ) const { return sizeof(AudioAsset); }
+
    DECLARE_CONOBJECT(AudioAsset);
 
 protected:
@@ -34,11 +34,62 @@ namespace font
 {
    BitmapFont::BitmapFont()
    {
+      resetGlyphs();
+   }
+
+   void BitmapFont::resetGlyphs(void)
+   {
+      // Keep the missing glyph at index zero.
+      mCharacters.clear();
+      mCharacters.push_back(BitmapFontCharacter());
 
+      mGlyphPageOffsets.setSize(BITMAP_FONT_GLYPH_PAGE_COUNT);
+      for (U32 i = 0; i < BITMAP_FONT_GLYPH_PAGE_COUNT; i++)
+         mGlyphPageOffsets[i] = -1;
+
+      mGlyphIndices.clear();
+      mKerning.clear();
+   }
+
+   void BitmapFont::AddCharacter(const BitmapFontCharacter& character)
+   {
+      // Allocate the code-point page if this is its first glyph.
+      const U32 page = character.mCharID >> BITMAP_FONT_GLYPH_PAGE_SHIFT;
+      if (mGlyphPageOffsets[page] < 0)
+      {
+         mGlyphPageOffsets[page] = mGlyphIndices.size();
+         mGlyphIndices.setSize(mGlyphIndices.size() + BITMAP_FONT_GLYPH_PAGE_SIZE);
+         dMemset(mGlyphIndices.address() + mGlyphPageOffsets[page], 0, BITMAP_FONT_GLYPH_PAGE_SIZE * sizeof(U16));
+      }
+
+      // Replace any existing glyph.
+      U16& glyphIndex = mGlyphIndices[mGlyphPageOffsets[page] + (character.mCharID & (BITMAP_FONT_GLYPH_PAGE_SIZE - 1))];
+      if (glyphIndex != 0)
+      {
+         mCharacters[glyphIndex] = character;
+         return;
+      }
+
+      // Sanity!
+      AssertFatal(mCharacters.size() < 0xFFFF, "BitmapFont::AddCharacter() - Too many glyphs.");
+
+      glyphIndex = (U16)mCharacters.size();
+      mCharacters.push_back(character);
+   }
+
+   U32 BitmapFont::getGlyphTableMemorySize(void) const
+   {
+      return
+         mCharacters.memSize() +
+         mGlyphPageOffsets.memSize() +
+         mGlyphIndices.memSize() +
+         mKerning.size() * (sizeof(U32) + sizeof(S16));
    }
 
    bool BitmapFont::parseFont(Stream& io_rStream)
    {
+      resetGlyphs();
+
       U32 numBytes = io_rStream.getStreamSize() - io_rStream.getPosition();
       while ((io_rStream.getStatus() != Stream::EOS) && numBytes > 0)
       {
@@ -188,7 +239,7 @@ namespace font
             }
             ci.mCharID = CharID;
             ci.ProcessCharacter(mWidth, mHeight);
-            mChar[CharID] = ci;
+            AddCharacter(ci);
          }
          else if (dStrcmp(Read, "kerning") == 0 && dStrcmp(Read, "kernings") != 0)
          {
@@ -227,6 +278,16 @@ namespace font
          }
       }
 
+      // Flag the glyphs that start a kerning pair.
+      for (HashMap<U32, S16>::iterator kerningItr = mKerning.begin(); kerningItr != mKerning.end(); ++kerningItr)
+      {
+         const U16 first = (U16)(kerningItr->key >> 16);
+         const S32 pageOffset = mGlyphPageOffsets[first >> BITMAP_FONT_GLYPH_PAGE_SHIFT];
+         const U16 glyphIndex = pageOffset < 0 ? 0 : mGlyphIndices[pageOffset + (first & (BITMAP_FONT_GLYPH_PAGE_SIZE - 1))];
+         if (glyphIndex != 0)
+            mCharacters[glyphIndex].mHasKerning = true;
+      }
+
       return (io_rStream.getStatus() == Stream::EOS);
    }
 
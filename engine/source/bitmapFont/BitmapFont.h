@@ -35,12 +35,19 @@
 #include "graphics/TextureManager.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 using namespace std;
 #include <map>
 #include <string>
 #include <vector>
-using KerningMap = map<pair<U16, U16>, S16>;
-using CharacterMap = map<U16, font::BitmapFontCharacter>;
+
+/// Glyphs are indexed directly through pages of this many code-points.
+#define BITMAP_FONT_GLYPH_PAGE_SHIFT    8
+#define BITMAP_FONT_GLYPH_PAGE_SIZE     (1 << BITMAP_FONT_GLYPH_PAGE_SHIFT)
+#define BITMAP_FONT_GLYPH_PAGE_COUNT    (0x10000 >> BITMAP_FONT_GLYPH_PAGE_SHIFT)
 
 namespace font
 {
@@ -50,8 +57,15 @@ namespace font
       U16 mWidth, mHeight;
       U16 mPages;
 
-      CharacterMap mChar;       
-      KerningMap mKerning;
+      /// Glyphs with the missing glyph at index zero.
+      Vector<BitmapFontCharacter> mCharacters;
+
+      /// Offset of each code-point page into the glyph indices or -1 if the page has no glyphs.
+      Vector<S32> mGlyphPageOffsets;
+      Vector<U16> mGlyphIndices;
+
+      /// Kerning amounts keyed by the packed character pair.
+      HashMap<U32, S16> mKerning;
 
    public:
       U16 mLineHeight;
@@ -63,12 +77,27 @@ namespace font
       BitmapFont();
       bool parseFont(Stream& io_rStream);
       TextureHandle LoadTexture(StringTableEntry fileName);
-      const BitmapFontCharacter& getCharacter(const U16 charID) { return mChar[charID]; }
+      inline const BitmapFontCharacter& getCharacter(const U16 charID) const
+      {
+         const S32 pageOffset = mGlyphPageOffsets[charID >> BITMAP_FONT_GLYPH_PAGE_SHIFT];
+         return mCharacters[pageOffset < 0 ? 0 : mGlyphIndices[pageOffset + (charID & (BITMAP_FONT_GLYPH_PAGE_SIZE - 1))]];
+      }
       inline const F32 getSizeRatio(const F32 size) { return size / mLineHeight; }
-      inline const S16 getKerning(U16 first, U16 second) { return (S16)mKerning[make_pair(first, second)]; }
+      inline const S16 getKerning(U16 first, U16 second) const
+      {
+         // Most glyphs start no kerning pair so skip the lookup for them.
+         if (!getCharacter(first).mHasKerning)
+            return 0;
+
+         HashMap<U32, S16>::const_iterator kerningItr = mKerning.find(((U32)first << 16) | second);
+         return kerningItr == mKerning.end() ? 0 : kerningItr->value;
+      }
+      U32 getGlyphTableMemorySize(void) const;
 
    private:
-      inline void AddKerning(U16 first, U16 second, S16 amount) { mKerning[make_pair(first, second)] = amount; }
+      void resetGlyphs(void);
+      void AddCharacter(const BitmapFontCharacter& character);
+      inline void AddKerning(U16 first, U16 second, S16 amount) { mKerning[((U32)first << 16) | second] = amount; }
    };
 }
 
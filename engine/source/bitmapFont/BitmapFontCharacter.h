@@ -44,8 +44,9 @@ namespace font
       U16 mPage;
       U16 mPageWidth, mPageHeight;
       Vector2 mOOBB[4];
+      bool mHasKerning;
 
-      BitmapFontCharacter() : mX(0), mY(0), mWidth(0), mHeight(0), mXOffset(0), mYOffset(0), mXAdvance(0), mPage(0)
+      BitmapFontCharacter() : mCharID(0), mX(0), mY(0), mWidth(0), mHeight(0), mXOffset(0), mYOffset(0), mXAdvance(0), mPage(0), mPageWidth(1), mPageHeight(1), mHasKerning(false)
       {
 
       }
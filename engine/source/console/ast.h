@@ -104,6 +104,12 @@ struct ExprNode : StmtNode
    virtual U32 precompile(TypeReq type) = 0;
    virtual U32 compile(U32 *codeStream, U32 ip, TypeReq type) = 0;
    virtual TypeReq getPreferredType() = 0;
+
+   /// The type used when passing this expression as a function argument or
+   /// return value; numeric results are passed unboxed.
+   virtual TypeReq getArgType();
+   virtual U32 precompileArg();
+   virtual U32 compileArg(U32 *codeStream, U32 ip);
 };
 
 struct ReturnStmtNode : StmtNode
@@ -174,6 +180,7 @@ struct ConditionalExprNode : ExprNode
    virtual U32 precompile(TypeReq type);
    virtual U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    virtual TypeReq getPreferredType();
+   virtual TypeReq getArgType();
 };
 
 struct IntBinaryExprNode : BinaryExprNode
@@ -248,6 +255,8 @@ struct VarNode : ExprNode
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
+   U32 precompileArg();
+   U32 compileArg(U32 *codeStream, U32 ip);
 };
 
 struct IntNode : ExprNode
@@ -259,6 +268,7 @@ struct IntNode : ExprNode
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
+   TypeReq getArgType();
 };
 
 struct FloatNode : ExprNode
@@ -270,6 +280,7 @@ struct FloatNode : ExprNode
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
+   TypeReq getArgType();
 };
 
 struct StrConstNode : ExprNode
@@ -309,6 +320,7 @@ struct AssignExprNode : ExprNode
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
+   TypeReq getArgType();
 };
 
 struct AssignDecl
@@ -236,6 +236,40 @@ U32 ExprNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
    return compile(codeStream, ip, TypeReqNone);
 }
 
+TypeReq ExprNode::getArgType()
+{
+   // Numeric results are passed unboxed, everything else as a string.
+   TypeReq type = getPreferredType();
+   if(type == TypeReqUInt || type == TypeReqFloat)
+      return type;
+   return TypeReqString;
+}
+
+U32 ExprNode::precompileArg()
+{
+   // expr OP_PUSH/OP_PUSH_UINT/OP_PUSH_FLT
+   return precompile(getArgType()) + 1;
+}
+
+U32 ExprNode::compileArg(U32 *codeStream, U32 ip)
+{
+   TypeReq type = getArgType();
+   ip = compile(codeStream, ip, type);
+   switch(type)
+   {
+   case TypeReqUInt:
+      codeStream[ip++] = OP_PUSH_UINT;
+      break;
+   case TypeReqFloat:
+      codeStream[ip++] = OP_PUSH_FLT;
+      break;
+   default:
+      codeStream[ip++] = OP_PUSH;
+      break;
+   }
+   return ip;
+}
+
 //------------------------------------------------------------
 
 U32 ReturnStmtNode::precompileStmt(U32)
@@ -244,7 +278,7 @@ U32 ReturnStmtNode::precompileStmt(U32)
    if(!expr)
       return 1;
    else
-      return 1 + expr->precompile(TypeReqString);
+      return 1 + expr->precompile(expr->getArgType());
 }
 
 U32 ReturnStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
@@ -254,8 +288,15 @@ U32 ReturnStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
       codeStream[ip++] = OP_RETURN;
    else
    {
-      ip = expr->compile(codeStream, ip, TypeReqString);
-      codeStream[ip++] = OP_RETURN;
+      // Numeric results are returned unboxed.
+      TypeReq type = expr->getArgType();
+      ip = expr->compile(codeStream, ip, type);
+      if(type == TypeReqUInt)
+         codeStream[ip++] = OP_RETURN_UINT;
+      else if(type == TypeReqFloat)
+         codeStream[ip++] = OP_RETURN_FLT;
+      else
+         codeStream[ip++] = OP_RETURN;
    }
    return ip;
 }
@@ -473,6 +514,12 @@ TypeReq ConditionalExprNode::getPreferredType()
    return trueExpr->getPreferredType();
 }
 
+TypeReq ConditionalExprNode::getArgType()
+{
+   // The false branch may not be numeric.
+   return TypeReqString;
+}
+
 //------------------------------------------------------------
 
 U32 FloatBinaryExprNode::precompile(TypeReq type)
@@ -835,6 +882,19 @@ U32 VarNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    return ip;
 }
 
+U32 VarNode::precompileArg()
+{
+   // The final OP_LOADVAR_STR is replaced with OP_PUSH_VAR.
+   return precompile(TypeReqString);
+}
+
+U32 VarNode::compileArg(U32 *codeStream, U32 ip)
+{
+   ip = compile(codeStream, ip, TypeReqString);
+   codeStream[ip - 1] = OP_PUSH_VAR;
+   return ip;
+}
+
 TypeReq VarNode::getPreferredType()
 {
    return TypeReqNone; // no preferred type
@@ -880,6 +940,12 @@ TypeReq IntNode::getPreferredType()
    return TypeReqUInt;
 }
 
+TypeReq IntNode::getArgType()
+{
+   // Constants are already in the string table.
+   return TypeReqString;
+}
+
 //------------------------------------------------------------
 
 U32 FloatNode::precompile(TypeReq type)
@@ -920,6 +986,12 @@ TypeReq FloatNode::getPreferredType()
    return TypeReqFloat;
 }
 
+TypeReq FloatNode::getArgType()
+{
+   // Constants are already in the string table.
+   return TypeReqString;
+}
+
 //------------------------------------------------------------
 
 U32 StrConstNode::precompile(TypeReq type)
@@ -1120,6 +1192,12 @@ TypeReq AssignExprNode::getPreferredType()
    return expr->getPreferredType();
 }
 
+TypeReq AssignExprNode::getArgType()
+{
+   // Keep the assigned value as written.
+   return TypeReqString;
+}
+
 //------------------------------------------------------------
 
 static void getAssignOpTypeOp(S32 op, TypeReq &type, U32 &operand)
@@ -1303,7 +1381,7 @@ U32 FuncCallExprNode::precompile(TypeReq type)
    precompileIdent(funcName);
    precompileIdent(nameSpace);
    for(ExprNode *walk = args; walk; walk = (ExprNode *) walk->getNext())
-      size += walk->precompile(TypeReqString) + 1;
+      size += walk->precompileArg();
    return size + 7;
 }
 
@@ -1311,10 +1389,7 @@ U32 FuncCallExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
 {
    codeStream[ip++] = OP_PUSH_FRAME;
    for(ExprNode *walk = args; walk; walk = (ExprNode *) walk->getNext())
-   {
-      ip = walk->compile(codeStream, ip, TypeReqString);
-      codeStream[ip++] = OP_PUSH;
-   }
+      ip = walk->compileArg(codeStream, ip);
    if(callType == MethodCall || callType == ParentCall)
       codeStream[ip++] = OP_CALLFUNC;
    else
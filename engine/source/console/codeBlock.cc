@@ -24,6 +24,7 @@
 #include "console/codeBlock.h"
 #include "io/resource/resourceManager.h"
 #include "math/mMath.h"
+#include "memory/dataChunker.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -38,6 +39,8 @@ U32            CodeBlock::smBreakLineCount = 0;
 CodeBlock *    CodeBlock::smCodeBlockList = NULL;
 CodeBlock *    CodeBlock::smCurrentCodeBlock = NULL;
 ConsoleParser *CodeBlock::smCurrentParser = NULL;
+U32 CodeBlock::smMethodCacheHits = 0;
+U32 CodeBlock::smMethodCacheMisses = 0;
 
 //-------------------------------------------------------------------------
 
@@ -57,6 +60,7 @@ CodeBlock::CodeBlock()
    fullPath = NULL;
    modPath = NULL;
    mRoot = StringTable->EmptyString;
+   mMethodCallCaches = NULL;
 }
 
 CodeBlock::~CodeBlock()
@@ -72,6 +76,7 @@ CodeBlock::~CodeBlock()
    delete[] functionFloats;
    delete[] code;
    delete[] breakList;
+   delete mMethodCallCaches;
 }
 
 //-------------------------------------------------------------------------
@@ -27,6 +27,8 @@
 #include "console/consoleParser.h"
 
 class Stream;
+class DataChunker;
+struct StringStackValue;
 
 
 /// Core TorqueScript code management class.
@@ -37,12 +39,24 @@ class CodeBlock
 private:
    static CodeBlock* smCodeBlockList;
    static CodeBlock* smCurrentCodeBlock;
+
+   /// The cached namespace lookup of a method call site.
+   struct MethodCallCache;
+
+   /// Call site caches, allocated when a method call is first executed.
+   DataChunker* mMethodCallCaches;
+
+   MethodCallCache* allocMethodCallCache();
    
 public:
    static U32                       smBreakLineCount;
    static bool                      smInFunction;
    static Compiler::ConsoleParser * smCurrentParser;
 
+   /// Method call site cache statistics.
+   static U32                       smMethodCacheHits;
+   static U32                       smMethodCacheMisses;
+
    static CodeBlock* getCurrentBlock()
    {
       return smCurrentCodeBlock;
@@ -143,9 +157,11 @@ public:
    /// -1 a new frame is created. If the index is out of range the
    /// top stack frame is used.
    /// @param packageName The code package name or null.
+   /// @param argValues The typed function parameter list or null, used
+   /// for parameters that were pushed unboxed.
    const char *exec(U32 offset, const char *fnName, Namespace *ns, U32 argc, 
       const char **argv, bool noCalls, StringTableEntry packageName, 
-      S32 setFrame = -1);
+      S32 setFrame = -1, const StringStackValue* argValues = NULL);
 };
 
 #endif
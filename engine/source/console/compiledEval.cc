@@ -39,6 +39,7 @@
 #include "string/stringStack.h"
 #include "messaging/message.h"
 #include "memory/frameAllocator.h"
+#include "memory/dataChunker.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -69,6 +70,33 @@ StringStack STR;
 U32 FLT = 0;
 U32 UINT = 0;
 
+// Set by OP_CALLFUNC when the caller immediately converts a script function's
+// result to a number so that the function can return it without formatting.
+static bool sNumericReturnRequested = false;
+static StringStackValue sNumericReturnValue = { StringStackValue::TypeString, false, 0, 0.0 };
+
+// Number of method call site caches allocated per block.
+static const S32 MethodCallCacheBlockSize = 64;
+
+struct CodeBlock::MethodCallCache
+{
+   Namespace*        mNamespace;
+   U32               mCacheSequence;
+   Namespace::Entry* mEntry;
+};
+
+CodeBlock::MethodCallCache* CodeBlock::allocMethodCallCache()
+{
+   if(!mMethodCallCaches)
+      mMethodCallCaches = new DataChunker(MethodCallCacheBlockSize * sizeof(MethodCallCache));
+
+   MethodCallCache* pCache = (MethodCallCache*)mMethodCallCaches->alloc(sizeof(MethodCallCache));
+   pCache->mNamespace = NULL;
+   pCache->mCacheSequence = 0;
+   pCache->mEntry = NULL;
+   return pCache;
+}
+
 static const char *getNamespaceList(Namespace *ns)
 {
    U32 size = 1;
@@ -447,12 +475,16 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
     }
 }
 
-const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
+const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame, const StringStackValue* argValues)
 {
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
 #endif
 
+   // Only the call that requested a numeric return may use it.
+   const bool numericReturn = sNumericReturnRequested && !gEvalState.traceOn;
+   sNumericReturnRequested = false;
+
    static char traceBuffer[1024];
    U32 i;
 
@@ -503,7 +535,24 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
       {
          StringTableEntry var = CodeToSTE(code, ip + (2 + 6 + 1) + (i * 2));
          gEvalState.setCurVarNameCreate(var);
-         gEvalState.setStringVariable(argv[i+1]);
+         if(argValues && argValues[i+1].mType == StringStackValue::TypeUInt)
+            gEvalState.setIntVariable((S32)argValues[i+1].mIntValue);
+         else if(argValues && argValues[i+1].mType == StringStackValue::TypeFloat)
+         {
+            // Float locals are stored as F32 so only bind the value directly if that's exact,
+            // otherwise the local must hold the formatted string as it always did.
+            const F64 floatValue = argValues[i+1].mFloatValue;
+            if((F64)(F32)floatValue == floatValue)
+               gEvalState.setFloatVariable(floatValue);
+            else
+            {
+               char floatBuffer[StringStack::NumberBufferSpace];
+               dSprintf(floatBuffer, sizeof(floatBuffer), "%.9g", floatValue);
+               gEvalState.setStringVariable(floatBuffer);
+            }
+         }
+         else
+            gEvalState.setStringVariable(argv[i+1]);
       }
       ip = ip + (fnArgc * 2) + (2 + 6 + 1);
       curFloatTable = functionFloats;
@@ -965,6 +1014,28 @@ breakContinue:
             break;
          case OP_RETURN:
             goto execFinished;
+
+         case OP_RETURN_UINT:
+            if(numericReturn)
+            {
+               sNumericReturnValue.mType = StringStackValue::TypeUInt;
+               sNumericReturnValue.mIntValue = (S32)(U32)intStack[UINT];
+            }
+            else
+               STR.setIntValue((U32)intStack[UINT]);
+            UINT--;
+            goto execFinished;
+
+         case OP_RETURN_FLT:
+            if(numericReturn)
+            {
+               sNumericReturnValue.mType = StringStackValue::TypeFloat;
+               sNumericReturnValue.mFloatValue = floatStack[FLT];
+            }
+            else
+               STR.setFloatValue(floatStack[FLT]);
+            FLT--;
+            goto execFinished;
          case OP_CMPEQ:
             intStack[UINT+1] = bool(floatStack[FLT] == floatStack[FLT-1]);
             UINT++;
@@ -1461,7 +1532,9 @@ breakContinue:
             U32 callType = code[ip+4];
 
             ip += 5;
-            STR.getArgcArgv(fnName, &callArgc, &callArgv);
+
+            // Numeric arguments are only formatted when something needs the strings.
+            STR.getArgcArgv(fnName, &callArgc, &callArgv, false, false);
 
             if(callType == FuncCallExprNode::FunctionCall) 
             {
@@ -1475,10 +1548,22 @@ breakContinue:
             else if(callType == FuncCallExprNode::MethodCall)
             {
                saveObject = gEvalState.thisObject;
-               gEvalState.thisObject = Sim::findObject(callArgv[1]);
+
+               // Object ids pushed unboxed don't need to be formatted and parsed.
+               const StringStackValue& objectValue = STR.getArgValues()[1];
+               if(callArgc > 1 && objectValue.mType == StringStackValue::TypeUInt)
+                  gEvalState.thisObject = Sim::findObject((SimObjectId)objectValue.mIntValue);
+               else
+               {
+                  if(callArgc > 1)
+                     STR.formatArg(1);
+                  gEvalState.thisObject = Sim::findObject(callArgv[1]);
+               }
                if(!gEvalState.thisObject)
                {
                   gEvalState.thisObject = 0;
+                  if(callArgc > 1)
+                     STR.formatArg(1);
                   Con::warnf(ConsoleLogEntry::General,"%s: Unable to find object: '%s' attempting to call function '%s'", getFileLine(ip-6), callArgv[1], fnName);
                   
                   STR.popFrame(); // [neo, 5/7/2007 - #2974]
@@ -1492,12 +1577,47 @@ breakContinue:
                {
                   DynamicConsoleMethodComponent *pComponent = dynamic_cast<DynamicConsoleMethodComponent*>( gEvalState.thisObject );
                   if( pComponent )
+                  {
+                     STR.formatArgs(callArgc);
                      pComponent->callMethodArgList( callArgc, callArgv, false );
+                  }
                }
                
                ns = gEvalState.thisObject->getNamespace();
                if(ns)
-                  nsEntry = ns->lookup(fnName);
+               {
+                  // The unused namespace slot of a method call holds its call site cache.
+#ifdef TORQUE_CPU_X64
+                  MethodCallCache *pCache = ((MethodCallCache *) *((U64*)(code+ip-3)));
+#else
+                  MethodCallCache *pCache = ((MethodCallCache *) *(code+ip-3));
+#endif
+                  if(!pCache)
+                  {
+                     pCache = allocMethodCallCache();
+#ifdef TORQUE_CPU_X64
+                     *((U64*)(code+ip-3)) = ((U64)pCache);
+#else
+                     code[ip-3] = ((U32)pCache);
+#endif
+                  }
+
+                  // The cache is valid until the receiver's namespace changes or
+                  // any namespace is modified.
+                  if(pCache->mNamespace == ns && pCache->mCacheSequence == Namespace::mCacheSequence)
+                  {
+                     nsEntry = pCache->mEntry;
+                     smMethodCacheHits++;
+                  }
+                  else
+                  {
+                     nsEntry = ns->lookup(fnName);
+                     pCache->mNamespace = ns;
+                     pCache->mCacheSequence = Namespace::mCacheSequence;
+                     pCache->mEntry = nsEntry;
+                     smMethodCacheMisses++;
+                  }
+               }
                else
                   nsEntry = NULL;
             }
@@ -1553,13 +1673,41 @@ breakContinue:
             {
                const char *ret = "";
                if(nsEntry->mFunctionOffset)
-                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage);
-               
+               {
+                  if(gEvalState.traceOn)
+                     STR.formatArgs(callArgc);
+
+                  sNumericReturnRequested = code[ip] == OP_STR_TO_UINT || code[ip] == OP_STR_TO_FLT;
+                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage, -1, STR.getArgValues());
+                  sNumericReturnRequested = false;
+               }
+
                STR.popFrame();
-               STR.setStringValue(ret);
+
+               // Consume an unboxed return value.
+               if(sNumericReturnValue.mType == StringStackValue::TypeUInt)
+               {
+                  if(code[ip++] == OP_STR_TO_UINT)
+                     intStack[++UINT] = sNumericReturnValue.mIntValue;
+                  else
+                     floatStack[++FLT] = (F64)sNumericReturnValue.mIntValue;
+                  sNumericReturnValue.mType = StringStackValue::TypeString;
+               }
+               else if(sNumericReturnValue.mType == StringStackValue::TypeFloat)
+               {
+                  if(code[ip++] == OP_STR_TO_UINT)
+                     intStack[++UINT] = (S64)sNumericReturnValue.mFloatValue;
+                  else
+                     floatStack[++FLT] = sNumericReturnValue.mFloatValue;
+                  sNumericReturnValue.mType = StringStackValue::TypeString;
+               }
+               else
+                  STR.setStringValue(ret);
             }
             else
             {
+               STR.formatArgs(callArgc);
+
                const char* nsName = ns? ns->mName: "";
                if((nsEntry->mMinArgs && S32(callArgc) < nsEntry->mMinArgs) || (nsEntry->mMaxArgs && S32(callArgc) > nsEntry->mMaxArgs))
                {
@@ -1693,6 +1841,30 @@ breakContinue:
             STR.push();
             break;
 
+         case OP_PUSH_UINT:
+            STR.pushIntValue(intStack[UINT--]);
+            break;
+
+         case OP_PUSH_FLT:
+            STR.pushFloatValue(floatStack[FLT--]);
+            break;
+
+         case OP_PUSH_VAR:
+            // Push numeric variables unboxed.
+            if(gEvalState.currentVariable && gEvalState.currentVariable->type == Dictionary::Entry::TypeInternalInt)
+               STR.pushIntValue((S32)gEvalState.currentVariable->getIntValue());
+            else if(gEvalState.currentVariable && gEvalState.currentVariable->type == Dictionary::Entry::TypeInternalFloat)
+               STR.pushFloatValue(gEvalState.currentVariable->getFloatValue());
+            else
+            {
+               if(gEvalState.currentVariable)
+                  STR.setStringValue(gEvalState.getStringVariable());
+               else
+                  STR.setStringValue("");
+               STR.push();
+            }
+            break;
+
          case OP_PUSH_FRAME:
             STR.pushFrame();
             break;
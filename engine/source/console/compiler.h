@@ -55,6 +55,8 @@ namespace Compiler
       OP_JMPIF_NP,
       OP_JMP,
       OP_RETURN,
+      OP_RETURN_UINT,
+      OP_RETURN_FLT,
       OP_CMPEQ,
       OP_CMPGR,
       OP_CMPGE,
@@ -137,6 +139,9 @@ namespace Compiler
       OP_COMPARE_STR,
 
       OP_PUSH,
+      OP_PUSH_UINT,
+      OP_PUSH_FLT,
+      OP_PUSH_VAR,
       OP_PUSH_FRAME,
 
       OP_BREAK,
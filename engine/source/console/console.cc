@@ -23,6 +23,7 @@
 #include "platform/platform.h"
 #include "platform/platformTLS.h"
 #include "platform/threads/thread.h"
+#include "platform/threads/jobScheduler.h"
 #include "console/console.h"
 #include "console/consoleInternal.h"
 #include "console/consoleObject.h"
@@ -37,6 +38,7 @@
 #include "string/stringStack.h"
 #include "component/dynamicConsoleMethodComponent.h"
 #include "memory/safeDelete.h"
+#include "console/consoleLogWriter.h"
 #include <stdarg.h>
 
 #include "output_ScriptBinding.h"
@@ -46,7 +48,8 @@
 #include "collection/hashTable.h"
 #endif
 
-static Mutex* sLogMutex;
+static ConsoleLogWriter* sLogWriter;
+static Mutex* sLogHeaderMutex;
 
 extern StringStack STR;
 
@@ -198,11 +201,10 @@ static Vector<ConsoleLogEntry> consoleLog(__FILE__, __LINE__);
 static bool consoleLogLocked;
 static bool logBufferEnabled=true;
 static S32 printLevel = 10;
-static FileStream consoleLogFile;
 static const char *defLogFileName = "console.log";
 static S32 consoleLogMode = 0;
 static bool active = false;
-static bool newLogFile;
+static std::atomic<bool> newLogFile;
 static const char *logFileName;
 
 static const int MaxCompletionBufferSize = 4096;
@@ -234,7 +236,8 @@ void init()
    logFileName                   = NULL;
    newLogFile                    = true;
    gWarnUndefinedScriptVariables = false;
-   sLogMutex                     = new Mutex;
+   sLogWriter                    = new ConsoleLogWriter;
+   sLogHeaderMutex               = new Mutex;
 
 #ifdef TORQUE_MULTITHREAD
    // Note the main thread ID.
@@ -263,6 +266,9 @@ void init()
 
    // And finally, the ACR...
    AbstractClassRep::initialize();
+
+   // Start writing the log in the background.
+   sLogWriter->start();
 }
 
 //--------------------------------------
@@ -272,10 +278,23 @@ void shutdown()
    AssertFatal(active == true, "Con::shutdown should only be called once.");
    active = false;
 
-   consoleLogFile.close();
+   // Stopping the writer writes anything still queued.
+   sLogWriter->stop();
    Namespace::shutdown();
 
-   SAFE_DELETE( sLogMutex );
+   SAFE_DELETE( sLogWriter );
+   SAFE_DELETE( sLogHeaderMutex );
+}
+
+void flushLog( const bool block )
+{
+   if ( sLogWriter )
+      sLogWriter->flush( block );
+}
+
+U32 getDroppedLogLineCount()
+{
+   return sLogWriter ? sLogWriter->getDroppedLineCount() : 0;
 }
 
 bool isActive()
@@ -288,8 +307,8 @@ bool isMainThread()
 #ifdef TORQUE_MULTITHREAD
    return ThreadManager::isCurrentThread(gMainThreadID);
 #else
-   // If we're single threaded we're always in the main thread.
-   return true;
+   // If we're single threaded then only job workers run engine code off the main thread.
+   return JobScheduler::getCurrentParticipantIndex() == 0;
 #endif
 }
 
@@ -420,45 +439,37 @@ U32 tabComplete(char* inputBuffer, U32 cursorPos, U32 maxResultLength, bool forw
 }
 
 //------------------------------------------------------------------------------
-static void log(const char *string)
+static void log(const char *string, const bool canDrop)
 {
-   // Lock.
-   MutexHandle mutex;
-   if( sLogMutex )
-      mutex.lock( sLogMutex, true );
-
    // Bail if we ain't logging.
-   if (!consoleLogMode) 
+   if (!consoleLogMode || !sLogWriter) 
    {
       return;
    }
 
-   // In mode 1, we open, append, close on each log write.
-   if ((consoleLogMode & 0x3) == 1) 
+   // The writer thread does the file work; we only queue the line here.
+   // If this is the first write...
+   if (newLogFile.load(std::memory_order_acquire)) 
    {
-      consoleLogFile.open(defLogFileName, FileStream::ReadWrite);
-   }
+      // Only one thread may queue the header and backlog, and it must do so
+      // before anyone else's line goes in.
+      MutexHandle mutex;
+      mutex.lock(sLogHeaderMutex, true);
 
-   // Write to the log if its status is hunky-dory.
-   if ((consoleLogFile.getStatus() == Stream::Ok) || (consoleLogFile.getStatus() == Stream::EOS)) 
-   {
-      consoleLogFile.setPosition(consoleLogFile.getStreamSize());
-      // If this is the first write...
-      if (newLogFile) 
+      if (newLogFile.load(std::memory_order_relaxed)) 
       {
          // Make a header.
          Platform::LocalTime lt;
          Platform::getLocalTime(lt);
          char buffer[128];
-         dSprintf(buffer, sizeof(buffer), "//-------------------------- %d/%d/%d -- %02d:%02d:%02d -----\r\n",
+         dSprintf(buffer, sizeof(buffer), "//-------------------------- %d/%d/%d -- %02d:%02d:%02d -----",
                lt.month + 1,
                lt.monthday,
                lt.year + 1900,
                lt.hour,
                lt.min,
                lt.sec);
-         consoleLogFile.write(dStrlen(buffer), buffer);
-         newLogFile = false;
+         sLogWriter->pushLine(buffer, false);
          if (consoleLogMode & 0x4) 
          {
             // Dump anything that has been printed to the console so far.
@@ -468,21 +479,16 @@ static void log(const char *string)
             getLockLog(log, size);
             for (line = 0; line < size; line++) 
             {
-               consoleLogFile.write(dStrlen(log[line].mString), log[line].mString);
-               consoleLogFile.write(2, "\r\n");
+               sLogWriter->pushLine(log[line].mString, false);
             }
             unlockLog();
          }
+         newLogFile.store(false, std::memory_order_release);
       }
-      // Now write what we came here to write.
-      consoleLogFile.write(dStrlen(string), string);
-      consoleLogFile.write(2, "\r\n");
    }
 
-   if ((consoleLogMode & 0x3) == 1) 
-   {
-      consoleLogFile.close();
-   }
+   // Now queue what we came here to write.
+   sLogWriter->pushLine(string, canDrop);
 }
 
 //------------------------------------------------------------------------------
@@ -560,7 +566,8 @@ static void _printf(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, co
          if(eofPos)
             *eofPos = 0;
 
-         log(pos);
+         // Errors (and so asserts) and warnings must reach the log even when the writer falls behind.
+         log(pos, level == ConsoleLogEntry::Normal);
          if(logBufferEnabled && !consoleLogLocked)
          {
             ConsoleLogEntry entry;
@@ -1114,15 +1121,16 @@ void setLogMode(S32 newMode)
          // Enabling logging when it was previously disabled.
          newLogFile = true;
       }
-      if ((consoleLogMode & 0x3) == 2)
-      {
-         // Changing away from mode 2, must close logfile.
-         consoleLogFile.close();
-      }
-      else if ((newMode & 0x3) == 2)
+      if (sLogWriter)
       {
-         // Starting mode 2, must open logfile.
-         consoleLogFile.open(defLogFileName, FileStream::Write);
+         // Mode 1 appends to the logfile for each write, mode 2 keeps it open.
+         // Lines already queued are written before the change.
+         if ((newMode & 0x3) == 1)
+            sLogWriter->setOutput(defLogFileName, false);
+         else if ((newMode & 0x3) == 2)
+            sLogWriter->setOutput(defLogFileName, true);
+         else
+            sLogWriter->setOutput(NULL, false);
       }
       consoleLogMode = newMode;
    }
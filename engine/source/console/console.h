@@ -202,7 +202,8 @@ namespace Con
       //  02/16/07 - PAUP - 41->42 DSOs are read with a pointer before every string(ASTnodes changed). Namespace and HashTable revamped
       //  05/17/10 - Luma - 42-43 Adding proper sceneObject physics flags, fixes in general
       //  02/07/13 - JU   - 43->44 Expanded the width of stringtable entries to  64bits 
-      DSOVersion = 44,
+      //  10/17/26 -      - 44->45 Typed numeric argument pushes and returns
+      DSOVersion = 45,
       MaxLineLength = 512,  ///< Maximum length of a line of console input.
       MaxDataTypes = 256    ///< Maximum number of registered data types.
    };
@@ -620,6 +621,13 @@ namespace Con
    void unlockLog(void);
    void setLogMode(S32 mode);
 
+   /// Write any queued log lines to the log file on the calling thread.
+   /// Used when the engine is about to die; if block is false and the writer is busy, nothing is done.
+   void flushLog(const bool block = true);
+
+   /// Number of log lines dropped because the log writer could not keep up.
+   U32 getDroppedLogLineCount();
+
    /// @}
 
    /// @name Dynamic Type System
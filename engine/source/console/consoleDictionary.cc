@@ -340,6 +340,7 @@ Dictionary::Entry::Entry(StringTableEntry in_name)
    ival = 0;
    fval = 0;
    sval = typeValueEmpty;
+   numericValid = true;
 }
 
 Dictionary::Entry::~Entry()
@@ -390,15 +391,17 @@ void Dictionary::Entry::setStringValue(const char * value)
       //
       // (This decision may come back to haunt you. Shame on you if it
       // does.)
+      //
+      // Otherwise the numeric value is only parsed if it's asked for.
       if(stringLen < 256)
       {
-         fval = dAtof(value);
-         ival = dAtoi(value);
+         numericValid = false;
       }
       else
       {
          fval = 0.f;
          ival = 0;
+         numericValid = true;
       }
 
       type = TypeInternalString;
@@ -418,6 +421,13 @@ void Dictionary::Entry::setStringValue(const char * value)
       Con::setData(type, dataPtr, 0, 1, &value);
 }
 
+void Dictionary::Entry::parseNumericValue()
+{
+   fval = dAtof(sval);
+   ival = dAtoi(sval);
+   numericValid = true;
+}
+
 void Dictionary::setVariable(StringTableEntry name, const char *value)
 {
    Entry *ent = add(name);
@@ -62,6 +62,7 @@ public:
         F32 fval;
         U32 bufferLen;
         void *dataPtr;
+        bool numericValid; // whether ival/fval are valid when type = -1
 
         Entry(StringTableEntry name);
         ~Entry();
@@ -69,14 +70,22 @@ public:
         U32 getIntValue()
         {
             if(type <= TypeInternalString)
+            {
+                if(!numericValid)
+                    parseNumericValue();
                 return ival;
+            }
             else
                 return dAtoi(Con::getData(type, dataPtr, 0));
         }
         F32 getFloatValue()
         {
             if(type <= TypeInternalString)
+            {
+                if(!numericValid)
+                    parseNumericValue();
                 return fval;
+            }
             else
                 return dAtof(Con::getData(type, dataPtr, 0));
         }
@@ -97,6 +106,7 @@ public:
             {
                 fval = (F32)val;
                 ival = val;
+                numericValid = true;
                 if(sval != typeValueEmpty)
                 {
                     dFree(sval);
@@ -117,6 +127,7 @@ public:
             {
                 fval = val;
                 ival = static_cast<U32>(val);
+                numericValid = true;
                 if(sval != typeValueEmpty)
                 {
                     dFree(sval);
@@ -132,6 +143,10 @@ public:
             }
         }
         void setStringValue(const char *value);
+
+    private:
+        /// Parse the numeric value of a string value on demand.
+        void parseNumericValue();
     };
 
 private:
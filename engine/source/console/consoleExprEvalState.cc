@@ -33,6 +33,7 @@
 #include "string/findMatch.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "console/codeBlock.h"
 
 #include "consoleExprEvalState_ScriptBinding.h"
 
@@ -64,3 +64,35 @@ ConsoleFunctionWithDocs(backtrace, ConsoleVoid, 1, 1, ())
 }
 
 /*! @} */ // group Callstack
+
+/*! @defgroup MethodCache Method Call Cache
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the number of method calls that used their call site's cached namespace lookup.
+    @return The number of method call cache hits.
+*/
+ConsoleFunctionWithDocs(getMethodCacheHits, ConsoleInt, 1, 1, ())
+{
+   return CodeBlock::smMethodCacheHits;
+}
+
+/*! Gets the number of method calls that had to look the method up in the receiver's namespace.
+    @return The number of method call cache misses.
+*/
+ConsoleFunctionWithDocs(getMethodCacheMisses, ConsoleInt, 1, 1, ())
+{
+   return CodeBlock::smMethodCacheMisses;
+}
+
+/*! Resets the method call cache hit and miss counts.
+    @return No return value
+*/
+ConsoleFunctionWithDocs(resetMethodCacheStats, ConsoleVoid, 1, 1, ())
+{
+   CodeBlock::smMethodCacheHits = 0;
+   CodeBlock::smMethodCacheMisses = 0;
+}
+
+/*! @} */ // group MethodCache
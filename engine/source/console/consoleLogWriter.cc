@@ -0,0 +1,361 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/consoleLogWriter.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter::ConsoleLogWriter() :
+   mEnqueuePosition( 0 ),
+   mDequeuePosition( 0 ),
+   mDroppedLines( 0 ),
+   mReportedDroppedLines( 0 ),
+   mpThread( NULL ),
+   mWakeSemaphore( 0 ),
+   mWriterWaiting( false ),
+   mStopping( false ),
+   mSynchronous( false ),
+   mKeepOpen( false ),
+   mBatchSize( 0 ),
+   mLastFlushTime( 0 )
+{
+   mFileName[0] = '\0';
+
+   for( U32 index = 0; index < QueueCapacity; ++index )
+   {
+      mSlots[index].mSequence.store( index, std::memory_order_relaxed );
+      mSlots[index].mLength = 0;
+      mSlots[index].mpHeapLine = NULL;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter::~ConsoleLogWriter()
+{
+   stop();
+   mFile.close();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::start( void )
+{
+   if ( mpThread != NULL || mSynchronous )
+      return;
+
+#if defined(TORQUE_OS_EMSCRIPTEN)
+   // No threading available so write each line as it arrives.
+   mSynchronous = true;
+   flush();
+#else
+   mStopping = false;
+   mpThread = new Thread( &ConsoleLogWriter::writerThreadFunction, this, true );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::stop( void )
+{
+   if ( mpThread != NULL )
+   {
+      mStopping = true;
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      if ( mWriterWaiting.exchange( false ) )
+         mWakeSemaphore.release();
+
+      mpThread->join();
+      delete mpThread;
+      mpThread = NULL;
+   }
+
+   mSynchronous = false;
+
+   // Write anything that arrived while stopping.
+   flush();
+}
+
+//-----------------------------------------------------------------------------
+
+bool ConsoleLogWriter::tryPush( const char* pLine, const U32 length )
+{
+   // Bounded multi-producer queue: each slot's sequence tells producers and the consumer whose turn it is.
+   U32 position = mEnqueuePosition.load( std::memory_order_relaxed );
+   QueueSlot* pSlot;
+   for(;;)
+   {
+      pSlot = &mSlots[position & (QueueCapacity-1)];
+      const S32 difference = (S32)(pSlot->mSequence.load( std::memory_order_acquire ) - position);
+
+      if ( difference == 0 )
+      {
+         if ( mEnqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+            break;
+      }
+      else if ( difference < 0 )
+      {
+         // Full.
+         return false;
+      }
+      else
+      {
+         position = mEnqueuePosition.load( std::memory_order_relaxed );
+      }
+   }
+
+   char* pDestination = pSlot->mInlineLine;
+   if ( length >= (U32)LineInlineSize )
+      pDestination = pSlot->mpHeapLine = (char*)dMalloc( length + 1 );
+
+   dMemcpy( pDestination, pLine, length );
+   pDestination[length] = '\0';
+   pSlot->mLength = length;
+
+   pSlot->mSequence.store( position + 1, std::memory_order_release );
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ConsoleLogWriter::isEmpty( void )
+{
+   const QueueSlot& slot = mSlots[mDequeuePosition & (QueueCapacity-1)];
+   return slot.mSequence.load( std::memory_order_acquire ) != mDequeuePosition + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::pushLine( const char* pLine, const bool canDrop )
+{
+   const U32 length = dStrlen( pLine );
+
+   if ( !tryPush( pLine, length ) )
+   {
+      if ( canDrop )
+      {
+         mDroppedLines.fetch_add( 1, std::memory_order_relaxed );
+         return;
+      }
+
+      // The line must not be lost so make room on this thread.
+      do
+      {
+         flush();
+      }
+      while ( !tryPush( pLine, length ) );
+   }
+
+   if ( mSynchronous )
+   {
+      flush();
+      return;
+   }
+
+   // Wake the writer if it is asleep.
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   if ( mWriterWaiting.load( std::memory_order_relaxed ) && mWriterWaiting.exchange( false ) )
+      mWakeSemaphore.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::waitForLines( void )
+{
+   mWriterWaiting.store( true );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   // Re-check after announcing we're waiting; if a producer already took the flag then its release is on the way.
+   bool pending;
+   {
+      MutexHandle mutex;
+      mutex.lock( &mWriteMutex, true );
+      pending = !isEmpty();
+   }
+
+   if ( (pending || mStopping) && mWriterWaiting.exchange( false ) )
+      return;
+
+   mWakeSemaphore.acquire();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::writerThreadFunction( void* pArg )
+{
+   ConsoleLogWriter* pWriter = (ConsoleLogWriter*)pArg;
+
+   while( !pWriter->mStopping )
+   {
+      pWriter->waitForLines();
+
+      if ( pWriter->mStopping )
+         break;
+
+      // Let a burst of lines build up so they go out in one write.
+      const U32 sinceFlush = Platform::getRealMilliseconds() - pWriter->mLastFlushTime;
+      if ( sinceFlush < (U32)FlushIntervalMs )
+         Platform::sleep( FlushIntervalMs - sinceFlush );
+
+      pWriter->flush();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+bool ConsoleLogWriter::flush( const bool block )
+{
+   MutexHandle mutex;
+   if ( !mutex.lock( &mWriteMutex, block ) )
+      return false;
+
+   flushLocked();
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::flushLocked( void )
+{
+   // Only one thread drains at a time so the dequeue side needs no atomics of its own.
+   while( !isEmpty() )
+   {
+      QueueSlot& slot = mSlots[mDequeuePosition & (QueueCapacity-1)];
+
+      if ( slot.mpHeapLine != NULL )
+      {
+         appendToBatch( slot.mpHeapLine, slot.mLength );
+         dFree( slot.mpHeapLine );
+         slot.mpHeapLine = NULL;
+      }
+      else
+      {
+         appendToBatch( slot.mInlineLine, slot.mLength );
+      }
+      appendToBatch( "\r\n", 2 );
+
+      slot.mSequence.store( mDequeuePosition + QueueCapacity, std::memory_order_release );
+      ++mDequeuePosition;
+   }
+
+   const U32 droppedLines = mDroppedLines.load( std::memory_order_relaxed );
+   if ( droppedLines != mReportedDroppedLines )
+   {
+      char buffer[96];
+      dSprintf( buffer, sizeof(buffer), "// %d console log line(s) dropped.\r\n", droppedLines - mReportedDroppedLines );
+      appendToBatch( buffer, dStrlen(buffer) );
+      mReportedDroppedLines = droppedLines;
+   }
+
+   writeBatch();
+
+   if ( mKeepOpen )
+      mFile.Flush();
+
+   mLastFlushTime = Platform::getRealMilliseconds();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::appendToBatch( const char* pData, const U32 length )
+{
+   if ( mBatchSize + length > (U32)BatchBufferSize )
+   {
+      writeBatch();
+
+      // Too big to batch at all so write it straight through.
+      if ( length > (U32)BatchBufferSize )
+      {
+         writeData( pData, length );
+         return;
+      }
+   }
+
+   dMemcpy( mBatch + mBatchSize, pData, length );
+   mBatchSize += length;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::writeBatch( void )
+{
+   if ( mBatchSize == 0 )
+      return;
+
+   writeData( mBatch, mBatchSize );
+   mBatchSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::writeData( const char* pData, const U32 length )
+{
+   // No output so discard.
+   if ( mFileName[0] == '\0' )
+      return;
+
+   if ( mKeepOpen )
+   {
+      if ( mFile.getStatus() == Stream::Ok || mFile.getStatus() == Stream::EOS )
+         mFile.write( length, pData );
+      return;
+   }
+
+   // Append and close so the log survives a crash.
+   if ( !mFile.open( mFileName, FileStream::ReadWrite ) )
+      return;
+
+   mFile.setPosition( mFile.getStreamSize() );
+   mFile.write( length, pData );
+   mFile.close();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::setOutput( const char* pFileName, const bool keepOpen )
+{
+   MutexHandle mutex;
+   mutex.lock( &mWriteMutex, true );
+
+   // Lines already queued belong to the previous output.
+   flushLocked();
+
+   mFile.close();
+   mKeepOpen = false;
+   mFileName[0] = '\0';
+
+   if ( pFileName == NULL )
+      return;
+
+   dStrncpy( mFileName, pFileName, sizeof(mFileName) - 1 );
+   mFileName[sizeof(mFileName) - 1] = '\0';
+
+   if ( keepOpen )
+   {
+      mKeepOpen = true;
+      mFile.open( mFileName, FileStream::Write );
+   }
+}
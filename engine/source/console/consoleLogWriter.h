@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONSOLE_LOG_WRITER_H_
+#define _CONSOLE_LOG_WRITER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+
+/// Writes console log lines to the log file from a background thread.
+///
+/// Callers append lines to a bounded lock-free queue and return immediately.  The writer
+/// thread drains the queue into large batches which are written with a single file write,
+/// waiting a short interval after waking so that bursts of output are coalesced.  When
+/// the queue is full new lines are dropped and counted; the count is written to the log
+/// the next time it is flushed.
+///
+/// flush() writes everything queued on the calling thread and is used on shutdown, on a
+/// log-mode change and when the engine is about to die.
+class ConsoleLogWriter
+{
+public:
+   enum
+   {
+      QueueCapacity     = 2048,        // Must be a power of two.
+      LineInlineSize    = 248,         // Longer lines are copied to the heap.
+      BatchBufferSize   = 64 * 1024,
+      FlushIntervalMs   = 50,
+   };
+
+private:
+   struct QueueSlot
+   {
+      std::atomic<U32>  mSequence;
+      U32               mLength;
+      char*             mpHeapLine;
+      char              mInlineLine[LineInlineSize];
+   };
+
+   QueueSlot            mSlots[QueueCapacity];
+   std::atomic<U32>     mEnqueuePosition;
+   U32                  mDequeuePosition;
+
+   std::atomic<U32>     mDroppedLines;
+   U32                  mReportedDroppedLines;
+
+   Thread*              mpThread;
+   Semaphore            mWakeSemaphore;
+   std::atomic<bool>    mWriterWaiting;
+   std::atomic<bool>    mStopping;
+   bool                 mSynchronous;
+
+   Mutex                mWriteMutex;
+   FileStream           mFile;
+   char                 mFileName[1024];
+   bool                 mKeepOpen;
+   char                 mBatch[BatchBufferSize];
+   U32                  mBatchSize;
+   U32                  mLastFlushTime;
+
+   bool tryPush( const char* pLine, const U32 length );
+   bool isEmpty( void );
+   void waitForLines( void );
+   void appendToBatch( const char* pData, const U32 length );
+   void writeBatch( void );
+   void writeData( const char* pData, const U32 length );
+   void flushLocked( void );
+
+   static void writerThreadFunction( void* pArg );
+
+public:
+   ConsoleLogWriter();
+   ~ConsoleLogWriter();
+
+   /// Start the writer thread.  Until this is called lines are only written by flush().
+   void start( void );
+
+   /// Stop the writer thread and write everything still queued.
+   void stop( void );
+
+   /// Queue a line for writing (without a line terminator).
+   /// If the queue is full the line is either dropped or, when it must not be lost, the queue is flushed first.
+   void pushLine( const char* pLine, const bool canDrop = true );
+
+   /// Write everything queued on the calling thread.
+   /// Returns false if the writer could not be locked without blocking and block is false.
+   bool flush( const bool block = true );
+
+   /// Set the file lines are written to.
+   /// If keepOpen is set the file is truncated and kept open otherwise it is opened, appended to and closed for each batch.
+   /// A NULL file name discards all output.
+   void setOutput( const char* pFileName, const bool keepOpen );
+
+   /// Number of lines dropped because the queue was full.
+   inline U32 getDroppedLineCount( void ) const { return mDroppedLines.load( std::memory_order_relaxed ); }
+};
+
+#endif // _CONSOLE_LOG_WRITER_H_
@@ -217,6 +217,30 @@ ConsoleSetType( TypeS32 )
       Con::printf("(TypeS32) Cannot set multiple args to a single S32.");
 }
 
+//////////////////////////////////////////////////////////////////////////
+// TypeU32
+//////////////////////////////////////////////////////////////////////////
+ConsoleType( int, TypeU32, sizeof(U32), "" )
+
+ConsoleGetType( TypeU32 )
+{
+   char* returnBuffer = Con::getReturnBuffer(256);
+   dSprintf(returnBuffer, 256, "%u", *((U32 *) dptr) );
+   return returnBuffer;
+}
+
+ConsoleSetType( TypeU32 )
+{
+   if(argc == 1)
+   {
+      U32 value = 0;
+      dSscanf(argv[0], "%u", &value);
+      *((U32 *) dptr) = value;
+   }
+   else
+      Con::printf("(TypeU32) Cannot set multiple args to a single U32.");
+}
+
 //////////////////////////////////////////////////////////////////////////
 // TypeS32Vector
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,7 @@
 DefineConsoleType( TypeF32 )
 DefineConsoleType( TypeS8 )
 DefineConsoleType( TypeS32 )
+DefineConsoleType( TypeU32 )
 DefineConsoleType( TypeS32Vector )
 DefineConsoleType( TypeBool )
 DefineConsoleType( TypeBoolVector )
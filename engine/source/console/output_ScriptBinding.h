@@ -139,6 +139,15 @@ ConsoleFunctionWithDocs(setLogMode, ConsoleVoid, 2, 2, ( mode ))
    Con::setLogMode(dAtoi(argv[1]));
 }
 
+/*! Use the getLogDroppedLines function to find how many lines were left out of the log file because the log writer could not keep up.
+    @return Returns the number of dropped lines since the console started.
+    @sa setLogMode
+*/
+ConsoleFunctionWithDocs(getLogDroppedLines, ConsoleInt, 1, 1, ())
+{
+   return Con::getDroppedLogLineCount();
+}
+
 /*! Use the setEchoFileLoads function to enable/disable echoing of file loads (to console).
     This does not completely disable message, but rather adds additional methods when echoing is set to true. File loads will always echo a compile statement if compiling is required, and an exec statement at all times
     @param enable A boolean value. If this value is true, extra information will be dumped to the console when files are loaded.
@@ -29,6 +29,7 @@
 #include "collection/vector.h"
 #include "io/fileStream.h"
 #include "platform/threads/thread.h"
+#include "platform/platformTimer.h"
 
 #include "profiler_ScriptBinding.h"
 
@@ -36,9 +37,22 @@
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
+// Only the main thread builds the profiler tree.
 ThreadIdent gMainThread = 0;
-#endif
+
+// Blocks open on a thread other than the main thread.  They only add to the root totals.
+static const S32 sThreadBlockStackDepth = 64;
+struct ProfilerThreadBlock
+{
+   ProfilerRootData *mRoot;
+   U32 mStartTime[2];
+};
+static thread_local ProfilerThreadBlock sThreadBlocks[sThreadBlockStackDepth];
+static thread_local S32 sThreadBlockDepth = 0;
+static std::atomic_flag sThreadTotalsLock = ATOMIC_FLAG_INIT;
+
+// The timeline buffer owned by the current thread, created on its first recorded event.
+static thread_local ProfilerTimelineBuffer *sThreadTimelineBuffer = NULL;
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -192,15 +206,31 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
+   mTimelineCaptureId = 0;
+   mTimelineBuffers = NULL;
+   mTimelineThreadCount = 0;
+   mTimelineCaptureCount = 0;
+   mTimelinePendingFrames = 0;
+   mTimelineFramesRemaining = 0;
+   mTimelineStartTime = 0;
+   mTimelineFileName[0] = '\0';
+
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
 {
    reset();
    free(mRootProfilerData);
+
+   mTimelineCaptureId = 0;
+   ProfilerTimelineBuffer *buffer = mTimelineBuffers.exchange(NULL);
+   while(buffer)
+   {
+      ProfilerTimelineBuffer *next = buffer->mNext;
+      free(buffer);
+      buffer = next;
+   }
    gProfiler = NULL;
 }
 
@@ -219,6 +249,7 @@ void Profiler::reset()
       walk->mSubTime = 0;
       walk->mTotalInvokeCount = 0;
    }
+   mergeThreadTotals(false);
    mCurrentProfilerData = mRootProfilerData;
    mCurrentProfilerData->mNextForRoot = 0;
    mCurrentProfilerData->mFirstChild = 0;
@@ -244,7 +275,11 @@ ProfilerRootData::ProfilerRootData(const char *name)
    mNextRoot = sRootList;
    sRootList = this;
    mTotalTime = 0;
+   mSubTime = 0;
    mTotalInvokeCount = 0;
+   mThreadTotalTime = 0;
+   mThreadSubTime = 0;
+   mThreadInvokeCount = 0;
    mFirstProfilerData = NULL;
    mEnabled = true;
 }
@@ -274,13 +309,121 @@ void Profiler::validate()
    }
 }
 
+ProfilerTimelineBuffer* Profiler::registerTimelineBuffer()
+{
+   ProfilerTimelineBuffer *buffer = (ProfilerTimelineBuffer *) malloc(sizeof(ProfilerTimelineBuffer));
+   buffer->mThreadId = ThreadManager::getCurrentThreadId();
+   buffer->mThreadIndex = mTimelineThreadCount.fetch_add(1) + 1;
+   new (&buffer->mCaptureId) std::atomic<U32>(0);
+   new (&buffer->mWriteCount) std::atomic<U32>(0);
+
+   // Buffers are never removed until shutdown so a simple push is enough.
+   buffer->mNext = mTimelineBuffers.load();
+   while(!mTimelineBuffers.compare_exchange_weak(buffer->mNext, buffer))
+      ;
+
+   return buffer;
+}
+
+void Profiler::recordTimelineEvent(ProfilerRootData *root, const U32 type)
+{
+   const U32 captureId = mTimelineCaptureId.load(std::memory_order_acquire);
+   if(captureId == 0)
+      return;
+
+   ProfilerTimelineBuffer *buffer = sThreadTimelineBuffer;
+   if(!buffer)
+      buffer = sThreadTimelineBuffer = registerTimelineBuffer();
+
+   // Start over if this is the first event of a new capture.
+   U32 count;
+   if(buffer->mCaptureId.load(std::memory_order_relaxed) != captureId)
+   {
+      count = 0;
+      buffer->mWriteCount.store(0, std::memory_order_relaxed);
+      buffer->mCaptureId.store(captureId, std::memory_order_release);
+   }
+   else
+   {
+      count = buffer->mWriteCount.load(std::memory_order_relaxed);
+   }
+
+   ProfilerTimelineEvent &event = buffer->mEvents[count & (ProfilerTimelineBuffer::Capacity - 1)];
+   event.mRoot = root;
+   event.mTime = PlatformTimer::getNanoseconds();
+   event.mType = type;
+   buffer->mWriteCount.store(count + 1, std::memory_order_release);
+}
+
+static void pushThreadBlock(ProfilerRootData *root, const bool enabled)
+{
+   AssertFatal(sThreadBlockDepth < sThreadBlockStackDepth,
+                  "Stack overflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
+
+   // Only time the outermost block of a root so recursion isn't counted twice.
+   ProfilerThreadBlock &block = sThreadBlocks[sThreadBlockDepth++];
+   block.mRoot = enabled && root->mEnabled ? root : NULL;
+   for(S32 i = 0; block.mRoot && i < sThreadBlockDepth - 1; i++)
+      if(sThreadBlocks[i].mRoot == root)
+         block.mRoot = NULL;
+
+   if(block.mRoot)
+      startHighResolutionTimer(block.mStartTime);
+}
+
+static void popThreadBlock()
+{
+   AssertFatal(sThreadBlockDepth > 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
+
+   ProfilerThreadBlock &block = sThreadBlocks[--sThreadBlockDepth];
+   if(!block.mRoot)
+      return;
+
+   const F64 fElapsed = endHighResolutionTimer(block.mStartTime);
+
+   // Find the timed block this one is nested in.
+   ProfilerRootData *parentRoot = NULL;
+   for(S32 i = sThreadBlockDepth - 1; !parentRoot && i >= 0; i--)
+      parentRoot = sThreadBlocks[i].mRoot;
+
+   while(sThreadTotalsLock.test_and_set(std::memory_order_acquire))
+      ;
+   block.mRoot->mThreadTotalTime += fElapsed;
+   block.mRoot->mThreadInvokeCount++;
+   if(parentRoot)
+      parentRoot->mThreadSubTime += fElapsed;
+   sThreadTotalsLock.clear(std::memory_order_release);
+}
+
+void Profiler::mergeThreadTotals(const bool accumulate)
+{
+   while(sThreadTotalsLock.test_and_set(std::memory_order_acquire))
+      ;
+   for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
+   {
+      if(accumulate)
+      {
+         walk->mTotalTime += walk->mThreadTotalTime;
+         walk->mSubTime += walk->mThreadSubTime;
+         walk->mTotalInvokeCount += walk->mThreadInvokeCount;
+      }
+      walk->mThreadTotalTime = 0;
+      walk->mThreadSubTime = 0;
+      walk->mThreadInvokeCount = 0;
+   }
+   sThreadTotalsLock.clear(std::memory_order_release);
+}
+
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   recordTimelineEvent(root, ProfilerTimelineEvent::Begin);
+
+   // Other threads can't share the main thread's profiler tree so they only add to the root totals.
    if(! ThreadManager::isCurrentThread(gMainThread) )
+   {
+      pushThreadBlock(root, mEnabled);
       return;
-#endif
+   }
 
    mStackDepth++;
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
@@ -372,11 +515,14 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   recordTimelineEvent(NULL, ProfilerTimelineEvent::End);
+
+   // Other threads can't share the main thread's profiler tree so they only add to the root totals.
    if(! ThreadManager::isCurrentThread(gMainThread) )
+   {
+      popThreadBlock();
       return;
-#endif
+   }
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
@@ -406,7 +552,156 @@ void Profiler::hashPop()
       if(!mEnabled && mNextEnable)
          startHighResolutionTimer(mCurrentProfilerData->mStartTime);
       mEnabled = mNextEnable;
+
+      if(mTimelinePendingFrames || mTimelineFramesRemaining)
+         updateTimelineCapture();
+   }
+}
+
+void Profiler::captureTimeline(const U32 frameCount, const char *fileName)
+{
+   AssertFatal(dStrlen(fileName) < DumpFileNameLength, "Error, timeline filename too long");
+   if(frameCount == 0 || fileName == NULL || fileName[0] == '\0')
+      return;
+
+   if(isCapturingTimeline())
+   {
+      Con::warnf("Profiler::captureTimeline() - A timeline capture is already in progress.");
+      return;
+   }
+
+   dStrcpy(mTimelineFileName, fileName);
+   mTimelinePendingFrames = frameCount;
+   Con::printf("Profiler capturing a timeline of %d frame(s) to '%s'.", frameCount, fileName);
+}
+
+void Profiler::updateTimelineCapture()
+{
+   // Called on the main thread at the end of each frame.
+   if(mTimelineFramesRemaining)
+   {
+      recordTimelineEvent(NULL, ProfilerTimelineEvent::Frame);
+      if(--mTimelineFramesRemaining == 0)
+      {
+         const U32 captureId = mTimelineCaptureId.exchange(0);
+         exportTimeline(captureId);
+      }
+      return;
+   }
+
+   // Start a pending capture on the frame boundary.
+   mTimelineFramesRemaining = mTimelinePendingFrames;
+   mTimelinePendingFrames = 0;
+   mTimelineStartTime = PlatformTimer::getNanoseconds();
+   mTimelineCaptureId.store(++mTimelineCaptureCount, std::memory_order_release);
+   recordTimelineEvent(NULL, ProfilerTimelineEvent::Frame);
+}
+
+static void writeTimelineString(FileStream &stream, const char *string)
+{
+   char buffer[256];
+   U32 length = 0;
+   for(const char *walk = string; *walk && length < sizeof(buffer) - 2; walk++)
+   {
+      if(*walk == '"' || *walk == '\\')
+         buffer[length++] = '\\';
+      buffer[length++] = *walk;
+   }
+   stream.write(length, buffer);
+}
+
+void Profiler::exportTimeline(const U32 captureId)
+{
+   FileStream stream;
+   if(!stream.open(mTimelineFileName, FileStream::Write))
+   {
+      Con::errorf("Profiler::exportTimeline() - Could not open '%s' for writing.", mTimelineFileName);
+      return;
    }
+
+   char buffer[256];
+   bool firstEvent = true;
+   U32 eventCount = 0;
+   U32 droppedCount = 0;
+   U32 threadCount = 0;
+   U64 endTime = PlatformTimer::getNanoseconds();
+
+   dStrcpy(buffer, "{\"traceEvents\":[\n");
+   stream.write(dStrlen(buffer), buffer);
+
+   for(ProfilerTimelineBuffer *timeline = mTimelineBuffers.load(); timeline; timeline = timeline->mNext)
+   {
+      if(timeline->mCaptureId.load(std::memory_order_acquire) != captureId)
+         continue;
+
+      const U32 count = timeline->mWriteCount.load(std::memory_order_acquire);
+      if(count == 0)
+         continue;
+
+      threadCount++;
+
+      // The oldest events are lost when the ring wraps.  Skip the slot a late writer may still be filling too.
+      U32 first = 0;
+      if(count >= (U32)ProfilerTimelineBuffer::Capacity)
+      {
+         first = count - ProfilerTimelineBuffer::Capacity + 1;
+         droppedCount += first;
+      }
+
+      dSprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+         firstEvent ? "" : ",\n", timeline->mThreadIndex);
+      stream.write(dStrlen(buffer), buffer);
+      if(timeline->mThreadId == (U64)gMainThread)
+         dStrcpy(buffer, "Main Thread\"}}");
+      else
+         dSprintf(buffer, sizeof(buffer), "Thread %d\"}}", timeline->mThreadIndex);
+      stream.write(dStrlen(buffer), buffer);
+      firstEvent = false;
+
+      // Unmatched ends from blocks opened before the capture are dropped and blocks still open are closed at the end.
+      S32 depth = 0;
+      for(U32 index = first; index < count; index++)
+      {
+         const ProfilerTimelineEvent &event = timeline->mEvents[index & (ProfilerTimelineBuffer::Capacity - 1)];
+         const F64 time = event.mTime > mTimelineStartTime ? (event.mTime - mTimelineStartTime) / 1000.0 : 0.0;
+
+         if(event.mType == ProfilerTimelineEvent::Begin)
+         {
+            depth++;
+            dStrcpy(buffer, ",\n{\"name\":\"");
+            stream.write(dStrlen(buffer), buffer);
+            writeTimelineString(stream, event.mRoot->mName);
+            dSprintf(buffer, sizeof(buffer), "\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", time, timeline->mThreadIndex);
+         }
+         else if(event.mType == ProfilerTimelineEvent::End)
+         {
+            if(depth == 0)
+               continue;
+            depth--;
+            dSprintf(buffer, sizeof(buffer), ",\n{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", time, timeline->mThreadIndex);
+         }
+         else
+         {
+            dSprintf(buffer, sizeof(buffer), ",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", time, timeline->mThreadIndex);
+         }
+         stream.write(dStrlen(buffer), buffer);
+         eventCount++;
+      }
+
+      for(; depth > 0; depth--)
+      {
+         dSprintf(buffer, sizeof(buffer), ",\n{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+            (endTime - mTimelineStartTime) / 1000.0, timeline->mThreadIndex);
+         stream.write(dStrlen(buffer), buffer);
+      }
+   }
+
+   dStrcpy(buffer, "\n],\"displayTimeUnit\":\"ms\"}\n");
+   stream.write(dStrlen(buffer), buffer);
+   stream.close();
+
+   Con::printf("Profiler timeline written to '%s' (%d events from %d thread(s), %d dropped).",
+      mTimelineFileName, eventCount, threadCount, droppedCount);
 }
 
 static S32 QSORT_CALLBACK rootDataCompare(const void *s1, const void *s2)
@@ -501,6 +796,9 @@ void Profiler::dump()
    mStackDepth++;
    // may have some profiled calls... gotta turn em off.
 
+   // Fold in the time spent on other threads.
+   mergeThreadTotals(true);
+
    Vector<ProfilerRootData *> rootVector;
    F64 totalTime = 0;
    for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
@@ -27,8 +27,11 @@
 
 #ifdef TORQUE_ENABLE_PROFILER
 
+#include <atomic>
+
 struct ProfilerData;
 struct ProfilerRootData;
+struct ProfilerTimelineBuffer;
 /// The Profiler is used to see how long a specific chunk of code takes to execute.
 /// All values outputted by the profiler are percentages of the time that it takes
 /// to run entire main loop.
@@ -41,6 +44,7 @@ struct ProfilerRootData;
 /// profilerDump();                                         //dumps all profiler data to the console
 /// profilerDumpToFile(string filename);                    //dumps all profiler data to a given file
 /// profilerMarkerEnable((string markerName, bool enable);  //enables or disables a given profile tag
+/// profilerCaptureTimeline(int frames, string filename);  //captures a timeline of all threads to a Chrome trace file
 /// @endcode
 ///
 /// The C++ code side of the profiler uses pairs of PROFILE_START() and PROFILE_END().
@@ -65,6 +69,11 @@ struct ProfilerRootData;
 /// //possibly some code here
 /// PROFILE_END();
 /// @endcode
+///
+/// The timeline capture records every PROFILE_START/PROFILE_END from every thread into
+/// per-thread ring buffers for a number of frames, then writes them as Chrome trace-event
+/// JSON which can be opened with chrome://tracing or Perfetto.  It is independent of the
+/// aggregated profile so both can be used at the same time.
 class Profiler
 {
    enum {
@@ -84,8 +93,24 @@ class Profiler
    bool mDumpToConsole;
    bool mDumpToFile;
    char mDumpFileName[DumpFileNameLength];
+
+   /// Timeline capture.
+   std::atomic<U32> mTimelineCaptureId;
+   std::atomic<ProfilerTimelineBuffer*> mTimelineBuffers;
+   std::atomic<U32> mTimelineThreadCount;
+   U32 mTimelineCaptureCount;
+   U32 mTimelinePendingFrames;
+   U32 mTimelineFramesRemaining;
+   U64 mTimelineStartTime;
+   char mTimelineFileName[DumpFileNameLength];
+
    void dump();
    void validate();
+   void mergeThreadTotals(const bool accumulate);
+   void recordTimelineEvent(ProfilerRootData *root, const U32 type);
+   ProfilerTimelineBuffer* registerTimelineBuffer();
+   void updateTimelineCapture();
+   void exportTimeline(const U32 captureId);
 public:
    Profiler();
    ~Profiler();
@@ -105,6 +130,12 @@ public:
    void hashPop();
    /// Enable a profiler marker
    void enableMarker(const char *marker, bool enabled);
+   /// Capture a timeline of all threads for a number of frames and write it as Chrome trace-event JSON
+   /// @param frameCount number of frames to capture
+   /// @param fileName filename to write the trace to
+   void captureTimeline(const U32 frameCount, const char *fileName);
+   /// Whether a timeline capture is pending or in progress
+   bool isCapturingTimeline() const { return mTimelinePendingFrames > 0 || mTimelineFramesRemaining > 0; }
 };
 
 extern Profiler *gProfiler;
@@ -118,6 +149,10 @@ struct ProfilerRootData
    F64 mTotalTime;
    F64 mSubTime;
    U32 mTotalInvokeCount;
+   /// Totals from threads other than the main thread, folded in when the profile is dumped.
+   F64 mThreadTotalTime;
+   F64 mThreadSubTime;
+   U32 mThreadInvokeCount;
    bool mEnabled;
 
    static ProfilerRootData *sRootList;
@@ -125,6 +160,35 @@ struct ProfilerRootData
    ProfilerRootData(const char *name);
 };
 
+/// A begin or end of a profiled block, or a frame boundary, recorded for the timeline.
+struct ProfilerTimelineEvent
+{
+   enum {
+      Begin,
+      End,
+      Frame
+   };
+
+   ProfilerRootData *mRoot;
+   U64 mTime;
+   U32 mType;
+};
+
+/// A ring of timeline events written only by the thread that owns it.
+struct ProfilerTimelineBuffer
+{
+   enum {
+      Capacity = 1 << 16
+   };
+
+   U64 mThreadId;
+   U32 mThreadIndex;
+   std::atomic<U32> mCaptureId;
+   std::atomic<U32> mWriteCount;
+   ProfilerTimelineBuffer *mNext;
+   ProfilerTimelineEvent mEvents[Capacity];
+};
+
 struct ProfilerData
 {
    ProfilerRootData *mRoot; ///< link to root node.
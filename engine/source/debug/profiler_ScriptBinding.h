@@ -77,6 +77,18 @@ ConsoleFunctionWithDocs(profilerReset, ConsoleVoid, 1, 1, ())
       gProfiler->reset();
 }
 
+/*! Captures every profiled block on every thread for a number of frames and writes them as a Chrome trace-event file.
+    The file can be opened with chrome://tracing or Perfetto.
+    @param frames The number of frames to capture.
+    @param filename The file to write the trace to.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerCaptureTimeline, ConsoleVoid, 3, 3, (int frames, string filename))
+{
+   if(gProfiler)
+      gProfiler->captureTimeline(dAtoi(argv[1]), argv[2]);
+}
+
 ConsoleFunctionGroupEnd( Profiler );
 
 /*! @} */ // group ProfilerFunctions
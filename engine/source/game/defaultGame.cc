@@ -81,6 +81,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -164,6 +168,9 @@ bool initializeLibraries()
 
     // Initialize the particle system.
     ParticleSystem::Init();
+
+    // Initialize the job scheduler.
+    JobScheduler::Init();
     
 #if defined(TORQUE_OS_IOS) && defined(_USE_STORE_KIT)
     storeInit();
@@ -205,6 +212,9 @@ void shutdownLibraries()
 
     // Destroy the particle system.
     ParticleSystem::destroy();
+
+    // Destroy the job scheduler.
+    JobScheduler::destroy();
   
 #ifdef _USE_STORE_KIT
     storeCleanup();
@@ -135,6 +135,13 @@ U32 TextureHandle::getGLName( void ) const
 
 //-----------------------------------------------------------------------------
 
+U32 TextureHandle::getResidentMemorySize( void ) const
+{
+    return object == NULL ? 0 : (U32)(object->mTextureResidentSize + object->mBitmapResidentSize);
+}
+
+//-----------------------------------------------------------------------------
+
 void TextureHandle::setFilter( const GLuint filter )
 {
     // Finish if no object.
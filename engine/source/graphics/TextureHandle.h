@@ -169,6 +169,7 @@ public:
     void refresh( void );
 
     operator TextureObject*() { return object; }
+    inline const TextureObject* getTextureObject( void ) const { return object; }
     inline bool NotNull( void ) const { return object != NULL; }
     inline bool IsNull( void ) const { return object == NULL; }
     const char* getTextureKey( void ) const;
@@ -177,6 +178,7 @@ public:
     GBitmap* getBitmap( void );
     const GBitmap* getBitmap( void ) const;
     U32 getGLName( void ) const;
+    U32 getResidentMemorySize( void ) const;
 
 private:
     void lock( void );
@@ -33,6 +33,11 @@
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
 #include "math/mMath.h"
+#include "debug/profiler.h"
+#include "collection/hashTable.h"
+#include "platform/threads/jobScheduler.h"
+
+#include <atomic>
 
 #include "TextureManager_ScriptBinding.h"
 
@@ -44,6 +49,7 @@ bool TextureManager::mDGLRender = true;
 bool TextureManager::mForce16BitTexture = false;
 bool TextureManager::mAllowTextureCompression = false;
 bool TextureManager::mDisableTextureSubImageUpdates = false;
+bool TextureManager::mTextureAtlasEnabled = false;
 GLenum TextureManager::mTextureCompressionHint = GL_FASTEST;
 S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
@@ -88,6 +94,58 @@ static Vector<EventCallbackEntry> sgEventCallbacks(__FILE__, __LINE__);
 
 //--------------------------------------------------------------------------------------------------------------------
 
+struct TextureAtlasPage
+{
+    TextureHandle   mPageTexture;
+    U32             mShelfX;
+    U32             mShelfY;
+    U32             mShelfHeight;
+    U32             mEntryCount;
+
+    /// Allocate an area on the page using simple shelf packing.
+    bool allocate( const U32 width, const U32 height, U32& x, U32& y )
+    {
+        // Move to a new shelf if the current one is full.
+        if ( mShelfX + width > TextureAtlasPageSize )
+        {
+            mShelfY += mShelfHeight;
+            mShelfX = 0;
+            mShelfHeight = 0;
+        }
+
+        // Finish if the page is full.
+        if ( width > TextureAtlasPageSize || mShelfY + height > TextureAtlasPageSize )
+            return false;
+
+        x = mShelfX;
+        y = mShelfY;
+        mShelfX += width;
+        if ( height > mShelfHeight )
+            mShelfHeight = height;
+        mEntryCount++;
+
+        return true;
+    }
+};
+
+static Vector<TextureAtlasPage*> sgTextureAtlasPages(__FILE__, __LINE__);
+
+//--------------------------------------------------------------------------------------------------------------------
+
+struct BitmapDecode
+{
+    ResourceObject*         mpResourceObject;
+    RESOURCE_CREATE_FN      mpCreateFunction;
+    Stream*                 mpStream;
+    GBitmap*                mpBitmap;
+    bool                    mForcePalletedTo16Bit;
+    std::atomic<bool>       mDecoded;
+};
+
+static HashMap<StringTableEntry, BitmapDecode*> sgBitmapDecodes;
+
+//--------------------------------------------------------------------------------------------------------------------
+
 U32 TextureManager::registerEventCallback(TextureEventCallback callback, void *userData)
 {
     sgEventCallbacks.increment();
@@ -155,6 +213,7 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::OpenGL::textureAtlas", TypeBool, &TextureManager::mTextureAtlasEnabled);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -166,6 +225,12 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Release the texture atlas pages.
+    clearTextureAtlas();
+
+    // Discard any background bitmap decodes.
+    flushBitmapDecodes();
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
@@ -304,6 +369,407 @@ StringTableEntry TextureManager::getUniqueTextureKey( void )
 
 //--------------------------------------------------------------------------------------------------------------------
 
+bool TextureManager::addToTextureAtlas( TextureObject* pTextureObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_AddToTextureAtlas);
+
+    // Finish if the atlas is disabled or there's no texture.
+    if ( !mTextureAtlasEnabled || pTextureObject == NULL )
+        return false;
+
+    // Finish if the texture is already in the atlas.
+    if ( pTextureObject->mpAtlasPage != NULL )
+        return true;
+
+    // Finish if not a bitmap texture.
+    if ( pTextureObject->mHandleType != TextureHandle::BitmapTexture && pTextureObject->mHandleType != TextureHandle::BitmapKeepTexture )
+        return false;
+
+    // Fetch the bitmap dimensions.
+    const U32 bitmapWidth = pTextureObject->mBitmapWidth;
+    const U32 bitmapHeight = pTextureObject->mBitmapHeight;
+
+    // Finish if the texture is too large to share a page.
+    if ( bitmapWidth == 0 || bitmapHeight == 0 || bitmapWidth > TextureAtlasMaximumEntrySize || bitmapHeight > TextureAtlasMaximumEntrySize )
+        return false;
+
+    // Fetch the bitmap, reloading it if it wasn't kept.
+    GBitmap* pBitmap = pTextureObject->mpBitmap;
+    const bool bitmapLoaded = pBitmap == NULL;
+    if ( bitmapLoaded )
+    {
+        pBitmap = loadBitmap( pTextureObject->mTextureKey );
+
+        if ( pBitmap == NULL )
+            return false;
+    }
+
+    bool added = false;
+
+    // Only 8-bit RGB/RGBA bitmaps can be packed.
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    if ( (format == GBitmap::RGB || format == GBitmap::RGBA) &&
+        !pBitmap->mForce16Bit &&
+        pBitmap->getWidth() == bitmapWidth &&
+        pBitmap->getHeight() == bitmapHeight )
+    {
+        // Entries are padded by a texel on each side so filtering doesn't bleed between neighbours.
+        const U32 entryWidth = bitmapWidth + 2;
+        const U32 entryHeight = bitmapHeight + 2;
+        U32 entryX = 0;
+        U32 entryY = 0;
+
+        // Find a page with the same filter and enough space.
+        TextureAtlasPage* pPage = NULL;
+        for( S32 index = 0; index < sgTextureAtlasPages.size(); ++index )
+        {
+            TextureAtlasPage* pProbePage = sgTextureAtlasPages[index];
+            if ( ((TextureObject*)pProbePage->mPageTexture)->mFilter == pTextureObject->mFilter &&
+                pProbePage->allocate( entryWidth, entryHeight, entryX, entryY ) )
+            {
+                pPage = pProbePage;
+                break;
+            }
+        }
+
+        // Create a new page if needed.
+        if ( pPage == NULL && sgTextureAtlasPages.size() < TextureAtlasMaximumPages )
+        {
+            GBitmap* pPageBitmap = new GBitmap( TextureAtlasPageSize, TextureAtlasPageSize, false, GBitmap::RGBA );
+            dMemset( pPageBitmap->getWritableBits(), 0, pPageBitmap->byteSize );
+
+            pPage = new TextureAtlasPage();
+            pPage->mShelfX = 0;
+            pPage->mShelfY = 0;
+            pPage->mShelfHeight = 0;
+            pPage->mEntryCount = 0;
+            pPage->mPageTexture.set( getUniqueTextureKey(), pPageBitmap, TextureHandle::BitmapKeepTexture, true );
+            pPage->mPageTexture.setFilter( pTextureObject->mFilter );
+            sgTextureAtlasPages.push_back( pPage );
+
+            if ( !pPage->allocate( entryWidth, entryHeight, entryX, entryY ) )
+                pPage = NULL;
+        }
+
+        if ( pPage != NULL )
+        {
+            TextureObject* pPageObject = pPage->mPageTexture;
+            const U32 sourceBytesPerPixel = pBitmap->bytesPerPixel;
+
+            // Copy the bitmap into the entry, extending the edges into the padding.
+            U8* pEntryBits = new U8[entryWidth * entryHeight * 4];
+            U8* pDest = pEntryBits;
+            for ( U32 y = 0; y < entryHeight; ++y )
+            {
+                const U32 sourceY = mClamp( (S32)y - 1, 0, (S32)bitmapHeight - 1 );
+                for ( U32 x = 0; x < entryWidth; ++x )
+                {
+                    const U32 sourceX = mClamp( (S32)x - 1, 0, (S32)bitmapWidth - 1 );
+                    const U8* pSource = pBitmap->getAddress( sourceX, sourceY );
+                    *pDest++ = pSource[0];
+                    *pDest++ = pSource[1];
+                    *pDest++ = pSource[2];
+                    *pDest++ = sourceBytesPerPixel == 4 ? pSource[3] : 255;
+                }
+            }
+
+            // Copy the entry into the page bitmap so it survives resurrection.
+            for ( U32 y = 0; y < entryHeight; ++y )
+                dMemcpy( pPageObject->mpBitmap->getAddress( entryX, entryY + y ), pEntryBits + (y * entryWidth * 4), entryWidth * 4 );
+
+            // Update the page texture.
+            if ( mDGLRender && pPageObject->mGLTextureName != 0 )
+            {
+                if ( mDisableTextureSubImageUpdates )
+                {
+                    refresh( pPageObject );
+                }
+                else
+                {
+                    glBindTexture( GL_TEXTURE_2D, pPageObject->mGLTextureName );
+                    glTexSubImage2D( GL_TEXTURE_2D, 0, entryX, entryY, entryWidth, entryHeight, GL_RGBA, GL_UNSIGNED_BYTE, pEntryBits );
+                }
+            }
+
+            delete [] pEntryBits;
+
+            // Set the atlas entry.
+            pTextureObject->mpAtlasPage = pPageObject;
+            pTextureObject->mAtlasOffsetX = entryX + 1;
+            pTextureObject->mAtlasOffsetY = entryY + 1;
+
+            added = true;
+        }
+    }
+
+    // Delete the bitmap if we loaded it.
+    if ( bitmapLoaded )
+        delete pBitmap;
+
+    return added;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::clearTextureAtlas( void )
+{
+    // Detach all textures from the atlas.
+    TextureObject* probe = TextureDictionary::TextureObjectChain;
+    while (probe) 
+    {
+        probe->mpAtlasPage = NULL;
+        probe = probe->next;
+    }
+
+    // Release the pages.
+    for( S32 index = 0; index < sgTextureAtlasPages.size(); ++index )
+    {
+        delete sgTextureAtlasPages[index];
+    }
+    sgTextureAtlasPages.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getTextureAtlasPageCount( void )
+{
+    return (U32)sgTextureAtlasPages.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getTextureAtlasEntryCount( void )
+{
+    U32 entryCount = 0;
+    for( S32 index = 0; index < sgTextureAtlasPages.size(); ++index )
+    {
+        entryCount += sgTextureAtlasPages[index]->mEntryCount;
+    }
+
+    return entryCount;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static bool isBitmapCreateFunction( RESOURCE_CREATE_FN createFunction )
+{
+    return createFunction == constructBitmapPNG ||
+           createFunction == constructBitmapJPEG ||
+#ifdef TORQUE_OS_IOS
+           createFunction == constructBitmapPVR ||
+#endif
+           createFunction == constructBitmapBMP;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static void decodeBitmapJob( void* pJobContext )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_DecodeBitmapJob);
+
+    BitmapDecode* pBitmapDecode = static_cast<BitmapDecode*>( pJobContext );
+
+    // Decode the bitmap.
+    // NOTE: This runs on a background thread so it must only touch the decode itself.
+    GBitmap* pBitmap = (GBitmap*)pBitmapDecode->mpCreateFunction( *pBitmapDecode->mpStream );
+
+    // Discard bitmaps that are too large so the texture load reports it as it normally would.
+    if ( pBitmap != NULL && (pBitmap->getWidth() > MaximumProductSupportedTextureWidth || pBitmap->getHeight() > MaximumProductSupportedTextureHeight) )
+    {
+        delete pBitmap;
+        pBitmap = NULL;
+    }
+
+    // Apply the paletted 16-bit preference read when the decode was queued.
+    if ( pBitmap != NULL && pBitmap->mPalettedSource && pBitmapDecode->mForcePalletedTo16Bit )
+        pBitmap->mForce16Bit = true;
+
+    pBitmapDecode->mpBitmap = pBitmap;
+    pBitmapDecode->mDecoded.store( true, std::memory_order_release );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static BitmapDecode* finishBitmapDecode( StringTableEntry textureKey )
+{
+    HashMap<StringTableEntry, BitmapDecode*>::iterator itr = sgBitmapDecodes.find( textureKey );
+
+    // Finish if there's no decode.
+    if ( itr == sgBitmapDecodes.end() )
+        return NULL;
+
+    BitmapDecode* pBitmapDecode = itr->value;
+    sgBitmapDecodes.erase( itr );
+
+    // Wait for the decode to finish.
+    while( !pBitmapDecode->mDecoded.load( std::memory_order_acquire ) )
+        Platform::sleep( 0 );
+
+    // Close the stream.
+    ResourceManager->closeStream( pBitmapDecode->mpStream );
+
+    return pBitmapDecode;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::queueBitmapDecode( const char* pTextureKey )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_QueueBitmapDecode);
+
+    // Finish if texture key is invalid.
+    if( pTextureKey == NULL || *pTextureKey == 0 )
+        return false;
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert( pTextureKey );
+
+    // Finish if already decoding.
+    if ( sgBitmapDecodes.find( textureKey ) != sgBitmapDecodes.end() )
+        return true;
+
+    // Finish if the texture is already loaded.
+    if ( TextureDictionary::find( textureKey ) != NULL )
+        return false;
+
+    // Finish if there's nothing to decode on.
+    JobScheduler* pJobScheduler = JobScheduler::Instance;
+    if ( pJobScheduler == NULL || pJobScheduler->getBackgroundThreadCount() == 0 )
+        return false;
+
+    // Find the bitmap resource in the same way as loading the bitmap does.
+    // NOTE: The resource manager is not thread-safe so the stream is opened here.
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), textureKey );
+    const U32 len = dStrlen(fileNameBuffer);
+    for (U32 i = 0; i < EXT_ARRAY_SIZE; i++)
+    {
+        dStrcpy(fileNameBuffer + len, extArray[i]);
+
+        ResourceObject* pResourceObject = ResourceManager->find( fileNameBuffer );
+        if ( pResourceObject == NULL )
+            continue;
+
+        // Finish if the resource is not a loose file as volume streams share their archive.
+        if ( !(pResourceObject->flags & ResourceObject::File) )
+            return false;
+
+        // Finish if the resource is not a bitmap.
+        RESOURCE_CREATE_FN createFunction = ResourceManager->getCreateFunction( pResourceObject->name );
+        if ( !isBitmapCreateFunction( createFunction ) )
+            return false;
+
+        Stream* pStream = ResourceManager->openStream( pResourceObject );
+        if ( pStream == NULL )
+            return false;
+
+        // Queue the decode.
+        BitmapDecode* pBitmapDecode = new BitmapDecode;
+        pBitmapDecode->mpResourceObject = pResourceObject;
+        pBitmapDecode->mpCreateFunction = createFunction;
+        pBitmapDecode->mpStream = pStream;
+        pBitmapDecode->mpBitmap = NULL;
+        pBitmapDecode->mDecoded.store( false );
+
+        // Read the paletted 16-bit preference here as the console is only safe to query on the main thread.
+        if ( createFunction == constructBitmapPNG )
+            pBitmapDecode->mForcePalletedTo16Bit = dAtob( Con::getVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit" ) );
+        else if ( createFunction == constructBitmapBMP )
+            pBitmapDecode->mForcePalletedTo16Bit = dAtob( Con::getVariable( "$pref::iPhone::ForcePalletedBMPsTo16Bit" ) );
+        else
+            pBitmapDecode->mForcePalletedTo16Bit = false;
+        sgBitmapDecodes.insert( textureKey, pBitmapDecode );
+
+        pJobScheduler->queueBackgroundJob( &decodeBitmapJob, pBitmapDecode );
+
+        return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::isBitmapDecodePending( const char* pTextureKey )
+{
+    HashMap<StringTableEntry, BitmapDecode*>::iterator itr = sgBitmapDecodes.find( StringTable->insert( pTextureKey ) );
+
+    return itr != sgBitmapDecodes.end() && !itr->value->mDecoded.load( std::memory_order_acquire );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getDecodedBitmapSize( const char* pTextureKey )
+{
+    HashMap<StringTableEntry, BitmapDecode*>::iterator itr = sgBitmapDecodes.find( StringTable->insert( pTextureKey ) );
+
+    // Finish if there's no finished decode.
+    if ( itr == sgBitmapDecodes.end() || !itr->value->mDecoded.load( std::memory_order_acquire ) || itr->value->mpBitmap == NULL )
+        return 0;
+
+    return itr->value->mpBitmap->byteSize;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::takeDecodedBitmap( StringTableEntry textureKey )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_TakeDecodedBitmap);
+
+    BitmapDecode* pBitmapDecode = finishBitmapDecode( textureKey );
+
+    // Finish if there was no decode.
+    if ( pBitmapDecode == NULL )
+        return NULL;
+
+    // Attribute the bitmap to its resource as loading it would.
+    GBitmap* pBitmap = pBitmapDecode->mpBitmap;
+    if ( pBitmap != NULL )
+        pBitmap->mSourceResource = pBitmapDecode->mpResourceObject;
+
+    delete pBitmapDecode;
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::discardDecodedBitmap( const char* pTextureKey )
+{
+    BitmapDecode* pBitmapDecode = finishBitmapDecode( StringTable->insert( pTextureKey ) );
+
+    // Finish if there was no decode.
+    if ( pBitmapDecode == NULL )
+        return;
+
+    delete pBitmapDecode->mpBitmap;
+    delete pBitmapDecode;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::flushBitmapDecodes( void )
+{
+    // Discard all the decodes.
+    while( sgBitmapDecodes.size() > 0 )
+    {
+        discardDecodedBitmap( sgBitmapDecodes.begin()->key );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getBitmapDecodeCount( void )
+{
+    return sgBitmapDecodes.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 GBitmap* TextureManager::createPowerOfTwoBitmap(GBitmap* pBitmap)
 {    
     // Sanity!
@@ -788,6 +1254,9 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
 
     if( pTextureObject )
     {
+        // Any atlas copy of the existing texture is now stale.
+        pTextureObject->mpAtlasPage = NULL;
+
         // Remove bitmap if we have a different existing one.
         if ( pTextureObject->mpBitmap != NULL && pTextureObject->mpBitmap != pNewBitmap)
         {
@@ -873,9 +1342,11 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
 
     if( ret == NULL )
     {
-        // Ok, no hit - is it in the current dir? If so then let's grab it
-        // and use it.
-        bmp = loadBitmap(textureKey, false);
+        // Ok, no hit - has it been decoded in the background?  If not, is it
+        // in the current dir? If so then let's grab it and use it.
+        bmp = takeDecodedBitmap(textureKey);
+        if(!bmp)
+            bmp = loadBitmap(textureKey, false);
 
         if(bmp)
         {
@@ -995,6 +1466,10 @@ void TextureManager::dumpMetrics( void )
         mTextureResidentWasteSize,
         mBitmapResidentSize,
         getResidentFraction() );
+    Con::printf( "TextureAtlas: Enabled=%s, Pages: %d, Entries: %d",
+        mTextureAtlasEnabled ? "YES" : "NO",
+        getTextureAtlasPageCount(),
+        getTextureAtlasEntryCount() );
 
     Con::printBlankLine();
     Con::printSeparator();
@@ -45,6 +45,10 @@
 #define MaximumProductSupportedTextureWidth 2048
 #define MaximumProductSupportedTextureHeight MaximumProductSupportedTextureWidth
 
+#define TextureAtlasPageSize            1024
+#define TextureAtlasMaximumEntrySize    256
+#define TextureAtlasMaximumPages        8
+
 class TextureManager
 {
    friend class TextureHandle;
@@ -80,6 +84,7 @@ private:
     static bool mForce16BitTexture;
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
+    static bool mTextureAtlasEnabled;
 
 public:
     static bool mDGLRender;
@@ -104,6 +109,23 @@ public:
 
     static StringTableEntry getUniqueTextureKey( void );
 
+    /// Texture atlas.
+    static bool getTextureAtlasEnabled( void ) { return mTextureAtlasEnabled; }
+    static bool addToTextureAtlas( TextureObject* pTextureObject );
+    static void clearTextureAtlas( void );
+    static U32 getTextureAtlasPageCount( void );
+    static U32 getTextureAtlasEntryCount( void );
+
+    /// Background bitmap decoding.
+    /// NOTE: A decoded bitmap is claimed by the next load of its texture so only the upload happens on the main thread.
+    static bool queueBitmapDecode( const char* pTextureKey );
+    static bool isBitmapDecodePending( const char* pTextureKey );
+    static U32 getDecodedBitmapSize( const char* pTextureKey );
+    static GBitmap* takeDecodedBitmap( StringTableEntry textureKey );
+    static void discardDecodedBitmap( const char* pTextureKey );
+    static void flushBitmapDecodes( void );
+    static U32 getBitmapDecodeCount( void );
+
     static void dumpMetrics( void );
 
 private:
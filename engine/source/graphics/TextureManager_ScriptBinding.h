@@ -65,6 +65,17 @@ ConsoleFunctionWithDocs( flushTextureCache, ConsoleVoid, 1, 1, ())
 
 //--------------------------------------------------------------------------------------------------------------------
 
+/*! Clears the texture atlas so textures render from their own textures until they are added again.
+    Textures are only packed into the atlas when "$pref::OpenGL::textureAtlas" is enabled.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( clearTextureAtlas, ConsoleVoid, 1, 1, ())
+{
+    TextureManager::clearTextureAtlas();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 /*! Dump the texture manager metrics.
 */
 ConsoleFunctionWithDocs( dumpTextureManagerMetrics, ConsoleVoid, 1, 1, ())
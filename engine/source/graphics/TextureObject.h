@@ -72,6 +72,10 @@ private:
     GLuint              mFilter;
     bool                mClamp;
 
+    TextureObject*      mpAtlasPage;
+    U32                 mAtlasOffsetX;
+    U32                 mAtlasOffsetY;
+
     TextureHandle::TextureHandleType mHandleType;
 
 public:
@@ -90,6 +94,9 @@ public:
         mBitmapHeight( 0 ),
         mFilter( GL_NEAREST ),
         mClamp( false ),
+        mpAtlasPage( NULL ),
+        mAtlasOffsetX( 0 ),
+        mAtlasOffsetY( 0 ),
         mHandleType( TextureHandle::InvalidTexture )
     {
     }
@@ -103,6 +110,11 @@ public:
     inline U32 getBitmapHeight( void ) { return mBitmapHeight; }
     inline GLuint getFilter( void ) { return mFilter; }
     inline bool getClamp( void ) { return mClamp; }
+
+    /// Texture atlas page this texture has been packed into (if any).
+    inline TextureObject* getAtlasPage( void ) const { return mpAtlasPage; }
+    inline U32 getAtlasOffsetX( void ) const { return mAtlasOffsetX; }
+    inline U32 getAtlasOffsetY( void ) const { return mAtlasOffsetY; }
     
     inline S32 getTextureResidentSize( void ) const { return mTextureResidentSize; }
     inline S32 getBitmapResidentSize( void ) const { return mBitmapResidentSize; }
@@ -138,9 +138,14 @@ bool GBitmap::readMSBmp(Stream& stream)
    delete[] rowBuffer;
 
    //-Mat set the mForce16Bit to true for these, if the script variable is set
-   sgForcePalletedBMPsTo16Bit = Con::getVariable("$pref::iPhone::ForcePalletedBMPsTo16Bit");
-   if( bi.biBitCount == 8 && sgForcePalletedBMPsTo16Bit ) {
-       mForce16Bit = true;
+   //     The console is only safe to query on the main thread so background decodes
+   //     have the preference applied by the texture manager that queued them.
+   mPalettedSource = bi.biBitCount == 8;
+   if( mPalettedSource && Con::isMainThread() ) {
+       sgForcePalletedBMPsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedBMPsTo16Bit") );
+       if( sgForcePalletedBMPsTo16Bit ) {
+           mForce16Bit = true;
+       }
    }
    return true;
 }
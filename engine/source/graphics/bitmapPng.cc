@@ -46,15 +46,13 @@ bool sgForcePalletedPNGsTo16Bit= false;
 // Our chunk signatures...
 
 static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
+static thread_local png_bytep sRowPointers[csgMaxRowPointers];
 
 //-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
-static Stream* sg_pStream = NULL;
+//                                        we use a per-thread pointer so
+//                                        that bitmaps can be decoded on
+//                                        background threads.
+static thread_local Stream* sg_pStream = NULL;
 
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
@@ -89,20 +87,16 @@ static void pngFlushDataFn(png_structp /*png_ptr*/)
    //
 }
 
+//-------------------------------------- The frame allocator is not
+//                                        thread-safe so use the heap.
 static png_voidp pngMallocFn(png_structp /*png_ptr*/, png_size_t size)
 {
-#ifndef _WIN64
-   return FrameAllocator::alloc((U32)size);
-#else
    return (png_voidp)dMalloc(size);
-#endif
 }
 
 static void pngFreeFn(png_structp /*png_ptr*/, png_voidp mem)
 {
-#ifdef _WIN64
    dFree(mem);
-#endif
 }
 
 
@@ -136,8 +130,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   U32 prevWaterMark = FrameAllocator::getWaterMark();
-
 #if defined(PNG_USER_MEM_SUPPORTED)
    png_structp png_ptr = png_create_read_struct_2(PNG_LIBPNG_VER_STRING,
                                                 NULL,
@@ -155,7 +147,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    if (png_ptr == NULL) 
    {
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -164,7 +155,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               (png_infopp)NULL,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -173,7 +163,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               &info_ptr,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -293,11 +282,13 @@ bool GBitmap::readPNG(Stream& io_rStream)
    //
    // actually, all of that was handled by allocateBitmap, so we're outta here
    //
-   FrameAllocator::setWaterMark(prevWaterMark);
 
     //
    //-Mat if all palleted images are to be converted, set mForce16bit
-   if( color_type == PNG_COLOR_TYPE_PALETTE ) {
+   //     The console is only safe to query on the main thread so background decodes
+   //     have the preference applied by the texture manager that queued them.
+   mPalettedSource = color_type == PNG_COLOR_TYPE_PALETTE;
+   if( mPalettedSource && Con::isMainThread() ) {
        sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
        if( sgForcePalletedPNGsTo16Bit ) {
            mForce16Bit = true;
@@ -49,7 +49,8 @@ GBitmap::GBitmap()
    numMipLevels(0),
    bytesPerPixel(0),
    pPalette(NULL),
-   mForce16Bit(false)
+   mForce16Bit(false),
+   mPalettedSource(false)
 {
    for (U32 i = 0; i < c_maxMipLevels; i++)
       mipLevelOffsets[i] = 0xffffffff;
@@ -71,6 +72,7 @@ GBitmap::GBitmap(const GBitmap& rCopy)
 
    
    mForce16Bit = rCopy.mForce16Bit;
+   mPalettedSource = rCopy.mPalettedSource;
 
    byteSize = rCopy.byteSize;
    pBits    = new U8[byteSize];
@@ -91,7 +93,8 @@ GBitmap::GBitmap(const U32  in_width,
  : pBits(NULL),
    byteSize(0),
    pPalette(NULL),
-   mForce16Bit(false)
+   mForce16Bit(false),
+   mPalettedSource(false)
 {
    for (U32 i = 0; i < c_maxMipLevels; i++)
       mipLevelOffsets[i] = 0xffffffff;
@@ -144,6 +144,7 @@ class GBitmap: public ResourceInstance
    U32 mipLevelOffsets[c_maxMipLevels];
 
    bool mForce16Bit;//-Mat some paletted images will always be 16bit
+   bool mPalettedSource;    ///< Decoded from a paletted image.
    GPalette* pPalette;      ///< Note that this palette pointer is ALWAYS
                             ///  owned by the bitmap, and will be
                             ///  deleted on exit, or written out on a
@@ -0,0 +1,547 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/glRecorder.h"
+#include "console/console.h"
+#include "console/consoleTypes.h"
+#include "math/mMath.h"
+
+#include "glRecorder_ScriptBinding.h"
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+    bool            sInstalled = false;
+    bool            sCaptureEvents = false;
+    GLRecorder::Trace sTrace;
+    Vector<GLRecorder::Event> sEvents;
+
+    // The maximum number of events captured.
+    const U32       sMaxEvents = 1 << 20;
+
+    static EnumTable::Enums eventTypeLookup[] =
+                {
+                { GLRecorder::EVENT_DRAW_ARRAYS,            "DrawArrays" },
+                { GLRecorder::EVENT_DRAW_ELEMENTS,          "DrawElements" },
+                { GLRecorder::EVENT_DRAW_IMMEDIATE,         "DrawImmediate" },
+                { GLRecorder::EVENT_BIND_TEXTURE,           "BindTexture" },
+                { GLRecorder::EVENT_UPLOAD_TEXTURE,         "UploadTexture" },
+                { GLRecorder::EVENT_ENABLE,                 "Enable" },
+                { GLRecorder::EVENT_DISABLE,                "Disable" },
+                { GLRecorder::EVENT_ENABLE_CLIENT_STATE,    "EnableClientState" },
+                { GLRecorder::EVENT_DISABLE_CLIENT_STATE,   "DisableClientState" },
+                { GLRecorder::EVENT_BLEND_FUNC,             "BlendFunc" },
+                { GLRecorder::EVENT_ALPHA_FUNC,             "AlphaFunc" },
+                { GLRecorder::EVENT_COLOR,                  "Color" },
+                { GLRecorder::EVENT_TEXTURE_ENV,            "TextureEnv" },
+                { GLRecorder::EVENT_POLYGON_MODE,           "PolygonMode" },
+                { GLRecorder::EVENT_ARRAY_POINTER,          "ArrayPointer" },
+                { GLRecorder::EVENT_MATRIX,                 "Matrix" },
+                { GLRecorder::EVENT_CLEAR,                  "Clear" },
+                };
+
+    inline void recordEvent( const GLRecorder::EventType eventType, const U32 value0 = 0, const U32 value1 = 0 )
+    {
+        if ( !sCaptureEvents || (U32)sEvents.size() >= sMaxEvents )
+            return;
+
+        GLRecorder::Event event;
+        event.mType = eventType;
+        event.mValue0 = value0;
+        event.mValue1 = value1;
+        sEvents.push_back( event );
+    }
+
+    inline U32 getTriangleCount( const GLenum mode, const U32 count )
+    {
+        switch( mode )
+        {
+            case GL_TRIANGLES:
+                return count / 3;
+
+            case GL_TRIANGLE_STRIP:
+            case GL_TRIANGLE_FAN:
+                return count > 2 ? count - 2 : 0;
+
+            case GL_QUADS:
+                return (count / 4) * 2;
+
+            default:
+                return 0;
+        }
+    }
+
+    template<typename T> inline U32 getIndexedVertexCount( const GLvoid* pIndices, const U32 count )
+    {
+        // The vertices referenced are assumed to be contiguous from zero which is the case for the batch renderer.
+        const T* pIndex = (const T*)pIndices;
+        U32 maxIndex = 0;
+        for ( U32 n = 0; n < count; ++n )
+        {
+            if ( pIndex[n] > maxIndex )
+                maxIndex = pIndex[n];
+        }
+        return count > 0 ? maxIndex + 1 : 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+#ifdef TORQUE_GL_RECORDER
+
+namespace
+{
+    // Null functions for everything.
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) fn_return GLAPIENTRY null_##fn_name fn_args { fn_value }
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+
+    // The functions that were replaced.
+    struct ReplacedFunctions
+    {
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) decltype(::fn_name) fn_name;
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+    };
+    ReplacedFunctions sReplacedFunctions;
+
+    // The next texture name.
+    GLuint          sNextTextureName = 1;
+
+    //--------------------------------------------------------------------------
+    // Draw calls.
+
+    void GLAPIENTRY record_glDrawArrays( GLenum mode, GLint first, GLsizei count )
+    {
+        sTrace.drawCalls++;
+        sTrace.vertices += (U32)count;
+        sTrace.triangles += getTriangleCount( mode, (U32)count );
+        recordEvent( GLRecorder::EVENT_DRAW_ARRAYS, mode, (U32)count );
+    }
+
+    void GLAPIENTRY record_glDrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices )
+    {
+        sTrace.drawCalls++;
+        sTrace.indices += (U32)count;
+        sTrace.triangles += getTriangleCount( mode, (U32)count );
+
+        if ( indices != NULL )
+        {
+            if ( type == GL_UNSIGNED_SHORT )
+                sTrace.vertices += getIndexedVertexCount<GLushort>( indices, (U32)count );
+            else if ( type == GL_UNSIGNED_INT )
+                sTrace.vertices += getIndexedVertexCount<GLuint>( indices, (U32)count );
+            else if ( type == GL_UNSIGNED_BYTE )
+                sTrace.vertices += getIndexedVertexCount<GLubyte>( indices, (U32)count );
+        }
+
+        recordEvent( GLRecorder::EVENT_DRAW_ELEMENTS, mode, (U32)count );
+    }
+
+    void GLAPIENTRY record_glBegin( GLenum mode )
+    {
+        // NOTE:    Immediate mode vertices are not counted.
+        sTrace.drawCalls++;
+        recordEvent( GLRecorder::EVENT_DRAW_IMMEDIATE, mode );
+    }
+
+    //--------------------------------------------------------------------------
+    // Textures.
+
+    void GLAPIENTRY record_glGenTextures( GLsizei n, GLuint *textures )
+    {
+        for ( GLsizei index = 0; index < n; ++index )
+            textures[index] = sNextTextureName++;
+    }
+
+    void GLAPIENTRY record_glBindTexture( GLenum target, GLuint texture )
+    {
+        sTrace.textureBinds++;
+        recordEvent( GLRecorder::EVENT_BIND_TEXTURE, target, texture );
+    }
+
+    void GLAPIENTRY record_glTexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels )
+    {
+        sTrace.textureUploads++;
+        recordEvent( GLRecorder::EVENT_UPLOAD_TEXTURE, (U32)width, (U32)height );
+    }
+
+    void GLAPIENTRY record_glTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels )
+    {
+        sTrace.textureUploads++;
+        recordEvent( GLRecorder::EVENT_UPLOAD_TEXTURE, (U32)width, (U32)height );
+    }
+
+    //--------------------------------------------------------------------------
+    // State.
+
+    void GLAPIENTRY record_glEnable( GLenum cap )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_ENABLE, cap );
+    }
+
+    void GLAPIENTRY record_glDisable( GLenum cap )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_DISABLE, cap );
+    }
+
+    void GLAPIENTRY record_glEnableClientState( GLenum array )
+    {
+        sTrace.clientStateChanges++;
+        recordEvent( GLRecorder::EVENT_ENABLE_CLIENT_STATE, array );
+    }
+
+    void GLAPIENTRY record_glDisableClientState( GLenum array )
+    {
+        sTrace.clientStateChanges++;
+        recordEvent( GLRecorder::EVENT_DISABLE_CLIENT_STATE, array );
+    }
+
+    void GLAPIENTRY record_glBlendFunc( GLenum sfactor, GLenum dfactor )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_BLEND_FUNC, sfactor, dfactor );
+    }
+
+    void GLAPIENTRY record_glAlphaFunc( GLenum func, GLclampf ref )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_ALPHA_FUNC, func, (U32)(ref * 255.0f) );
+    }
+
+    void GLAPIENTRY record_glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_COLOR,
+            ((U32)(mClampF(red, 0.0f, 1.0f) * 255.0f) << 24) | ((U32)(mClampF(green, 0.0f, 1.0f) * 255.0f) << 16) |
+            ((U32)(mClampF(blue, 0.0f, 1.0f) * 255.0f) << 8) | (U32)(mClampF(alpha, 0.0f, 1.0f) * 255.0f) );
+    }
+
+    void GLAPIENTRY record_glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_COLOR, ((U32)red << 24) | ((U32)green << 16) | ((U32)blue << 8) | (U32)alpha );
+    }
+
+    void GLAPIENTRY record_glTexEnvi( GLenum target, GLenum pname, GLint param )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_TEXTURE_ENV, pname, (U32)param );
+    }
+
+    void GLAPIENTRY record_glPolygonMode( GLenum face, GLenum mode )
+    {
+        sTrace.stateChanges++;
+        recordEvent( GLRecorder::EVENT_POLYGON_MODE, face, mode );
+    }
+
+    void GLAPIENTRY record_glVertexPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer )
+    {
+        sTrace.arrayPointerChanges++;
+        recordEvent( GLRecorder::EVENT_ARRAY_POINTER, GL_VERTEX_ARRAY, (U32)size );
+    }
+
+    void GLAPIENTRY record_glTexCoordPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer )
+    {
+        sTrace.arrayPointerChanges++;
+        recordEvent( GLRecorder::EVENT_ARRAY_POINTER, GL_TEXTURE_COORD_ARRAY, (U32)size );
+    }
+
+    void GLAPIENTRY record_glColorPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer )
+    {
+        sTrace.arrayPointerChanges++;
+        recordEvent( GLRecorder::EVENT_ARRAY_POINTER, GL_COLOR_ARRAY, (U32)size );
+    }
+
+    void GLAPIENTRY record_glClear( GLbitfield mask )
+    {
+        sTrace.clears++;
+        recordEvent( GLRecorder::EVENT_CLEAR, mask );
+    }
+
+    //--------------------------------------------------------------------------
+    // Matrices.
+
+    inline void recordMatrixChange( void )
+    {
+        sTrace.matrixChanges++;
+        recordEvent( GLRecorder::EVENT_MATRIX );
+    }
+
+    void GLAPIENTRY record_glMatrixMode( GLenum mode ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glPushMatrix( void ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glPopMatrix( void ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glLoadIdentity( void ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glLoadMatrixf( const GLfloat *m ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glMultMatrixf( const GLfloat *m ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glTranslatef( GLfloat x, GLfloat y, GLfloat z ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glScalef( GLfloat x, GLfloat y, GLfloat z ) { recordMatrixChange(); }
+    void GLAPIENTRY record_glOrtho( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar ) { recordMatrixChange(); }
+
+    //--------------------------------------------------------------------------
+    // Queries.
+    // NOTE:    Callers expect queries to write their results so sensible values are returned.
+
+    void GLAPIENTRY record_glGetIntegerv( GLenum pname, GLint *params )
+    {
+        switch( pname )
+        {
+            case GL_VIEWPORT:
+                params[0] = params[1] = 0;
+                params[2] = params[3] = 1024;
+                return;
+
+            case GL_MAX_TEXTURE_SIZE:
+                params[0] = 4096;
+                return;
+
+            default:
+                params[0] = 0;
+                return;
+        }
+    }
+
+    void GLAPIENTRY record_glGetFloatv( GLenum pname, GLfloat *params )
+    {
+        switch( pname )
+        {
+            case GL_MODELVIEW_MATRIX:
+            case GL_PROJECTION_MATRIX:
+            case GL_TEXTURE_MATRIX:
+                for ( U32 n = 0; n < 16; ++n )
+                    params[n] = (n % 5) == 0 ? 1.0f : 0.0f;
+                return;
+
+            default:
+                params[0] = 0.0f;
+                return;
+        }
+    }
+
+    const GLubyte* GLAPIENTRY record_glGetString( GLenum name )
+    {
+        switch( name )
+        {
+            case GL_VENDOR:
+                return (const GLubyte*)"Torque";
+
+            case GL_RENDERER:
+                return (const GLubyte*)"GL Recorder";
+
+            case GL_VERSION:
+                return (const GLubyte*)"1.1";
+
+            default:
+                return (const GLubyte*)"";
+        }
+    }
+}
+
+#endif // TORQUE_GL_RECORDER
+
+//------------------------------------------------------------------------------
+
+bool GLRecorder::isSupported( void )
+{
+#ifdef TORQUE_GL_RECORDER
+    return true;
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+bool GLRecorder::install( const bool captureEvents )
+{
+#ifdef TORQUE_GL_RECORDER
+    // Finish if already installed.
+    if ( sInstalled )
+    {
+        setCaptureEvents( captureEvents );
+        return true;
+    }
+
+    // Replace all the functions with null functions.
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) \
+        sReplacedFunctions.fn_name = fn_name; \
+        fn_name = null_##fn_name;
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+
+    // Replace the recorded functions.
+    glDrawArrays = record_glDrawArrays;
+    glDrawElements = record_glDrawElements;
+    glBegin = record_glBegin;
+    glGenTextures = record_glGenTextures;
+    glBindTexture = record_glBindTexture;
+    glTexImage2D = record_glTexImage2D;
+    glTexSubImage2D = record_glTexSubImage2D;
+    glEnable = record_glEnable;
+    glDisable = record_glDisable;
+    glEnableClientState = record_glEnableClientState;
+    glDisableClientState = record_glDisableClientState;
+    glBlendFunc = record_glBlendFunc;
+    glAlphaFunc = record_glAlphaFunc;
+    glColor4f = record_glColor4f;
+    glColor4ub = record_glColor4ub;
+    glTexEnvi = record_glTexEnvi;
+    glPolygonMode = record_glPolygonMode;
+    glVertexPointer = record_glVertexPointer;
+    glTexCoordPointer = record_glTexCoordPointer;
+    glColorPointer = record_glColorPointer;
+    glClear = record_glClear;
+    glMatrixMode = record_glMatrixMode;
+    glPushMatrix = record_glPushMatrix;
+    glPopMatrix = record_glPopMatrix;
+    glLoadIdentity = record_glLoadIdentity;
+    glLoadMatrixf = record_glLoadMatrixf;
+    glMultMatrixf = record_glMultMatrixf;
+    glTranslatef = record_glTranslatef;
+    glRotatef = record_glRotatef;
+    glScalef = record_glScalef;
+    glOrtho = record_glOrtho;
+    glGetIntegerv = record_glGetIntegerv;
+    glGetFloatv = record_glGetFloatv;
+    glGetString = record_glGetString;
+
+    sInstalled = true;
+    setCaptureEvents( captureEvents );
+    reset();
+
+    return true;
+#else
+    // Warn.
+    Con::warnf( "GLRecorder::install() - The GL recorder is not supported on this platform." );
+
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+void GLRecorder::uninstall( void )
+{
+#ifdef TORQUE_GL_RECORDER
+    // Finish if not installed.
+    if ( !sInstalled )
+        return;
+
+    // Restore the replaced functions.
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) \
+        fn_name = sReplacedFunctions.fn_name;
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+
+    sInstalled = false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+bool GLRecorder::isInstalled( void )
+{
+    return sInstalled;
+}
+
+//------------------------------------------------------------------------------
+
+void GLRecorder::setCaptureEvents( const bool captureEvents )
+{
+    sCaptureEvents = captureEvents;
+}
+
+//------------------------------------------------------------------------------
+
+bool GLRecorder::getCaptureEvents( void )
+{
+    return sCaptureEvents;
+}
+
+//------------------------------------------------------------------------------
+
+void GLRecorder::reset( void )
+{
+    sTrace.reset();
+    sEvents.clear();
+}
+
+//------------------------------------------------------------------------------
+
+const GLRecorder::Trace& GLRecorder::getTrace( void )
+{
+    return sTrace;
+}
+
+//------------------------------------------------------------------------------
+
+const Vector<GLRecorder::Event>& GLRecorder::getEvents( void )
+{
+    return sEvents;
+}
+
+//------------------------------------------------------------------------------
+
+const char* GLRecorder::getEventTypeDescription( const EventType eventType )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(eventTypeLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( eventTypeLookup[i].index == eventType )
+            return eventTypeLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "GLRecorder::getEventTypeDescription() - Invalid event type." );
+
+    return StringTable->EmptyString;
+}
+
+//------------------------------------------------------------------------------
+
+void GLRecorder::dumpToConsole( void )
+{
+    Con::printf( "GL Recorder: %s", sInstalled ? "Installed" : "Not Installed" );
+    Con::printf( "- DrawCalls=%d, Vertices=%d, Indices=%d, Triangles=%d",
+        sTrace.drawCalls, sTrace.vertices, sTrace.indices, sTrace.triangles );
+    Con::printf( "- TextureBinds=%d, TextureUploads=%d, StateChanges=%d, ClientStateChanges=%d, ArrayPointerChanges=%d, MatrixChanges=%d, Clears=%d",
+        sTrace.textureBinds, sTrace.textureUploads, sTrace.stateChanges, sTrace.clientStateChanges, sTrace.arrayPointerChanges, sTrace.matrixChanges, sTrace.clears );
+
+    // Finish if no events were captured.
+    if ( sEvents.size() == 0 )
+        return;
+
+    Con::printf( "- Events=%d", sEvents.size() );
+    for ( U32 index = 0; index < (U32)sEvents.size(); ++index )
+    {
+        const Event& event = sEvents[index];
+        Con::printf( "  %d: %s 0x%x 0x%x", index, getEventTypeDescription( event.mType ), event.mValue0, event.mValue1 );
+    }
+}
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _GL_RECORDER_H_
+#define _GL_RECORDER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+#ifndef _PLATFORMGL_H_
+#include "platform/platformGL.h"
+#endif
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+/// The recorder works by rebinding the GL function pointers so it is only available
+/// on the platforms that bind GL at runtime.
+#if defined(TORQUE_OS_WIN) || defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_FREEBSD)
+#define TORQUE_GL_RECORDER
+#endif
+
+//------------------------------------------------------------------------------
+
+/// @defgroup gl_recorder Headless GL Recording
+/// @ingroup dgl
+/// A no-op GL backend that records what would have been submitted to the driver.
+/// Installing it replaces every GL function with one that does nothing other than
+/// count draw calls, vertices, indices and state changes so that render submission
+/// (scene rendering, render queue sorting and batch flushing) can be measured and
+/// regression-tested without a GPU.
+/// @{
+namespace GLRecorder
+{
+    /// Recorded event types.
+    enum EventType
+    {
+        EVENT_DRAW_ARRAYS,
+        EVENT_DRAW_ELEMENTS,
+        EVENT_DRAW_IMMEDIATE,
+        EVENT_BIND_TEXTURE,
+        EVENT_UPLOAD_TEXTURE,
+        EVENT_ENABLE,
+        EVENT_DISABLE,
+        EVENT_ENABLE_CLIENT_STATE,
+        EVENT_DISABLE_CLIENT_STATE,
+        EVENT_BLEND_FUNC,
+        EVENT_ALPHA_FUNC,
+        EVENT_COLOR,
+        EVENT_TEXTURE_ENV,
+        EVENT_POLYGON_MODE,
+        EVENT_ARRAY_POINTER,
+        EVENT_MATRIX,
+        EVENT_CLEAR,
+    };
+
+    /// A recorded event.
+    struct Event
+    {
+        EventType   mType;
+        U32         mValue0;
+        U32         mValue1;
+    };
+
+    /// Recorded totals.
+    struct Trace
+    {
+        Trace() { reset(); }
+
+        void reset( void )
+        {
+            drawCalls = 0;
+            vertices = 0;
+            indices = 0;
+            triangles = 0;
+            textureBinds = 0;
+            textureUploads = 0;
+            stateChanges = 0;
+            clientStateChanges = 0;
+            arrayPointerChanges = 0;
+            matrixChanges = 0;
+            clears = 0;
+        }
+
+        U32 drawCalls;              ///< Draw calls of any kind.
+        U32 vertices;               ///< Vertices drawn.
+        U32 indices;                ///< Indices drawn.
+        U32 triangles;              ///< Triangles drawn.
+        U32 textureBinds;           ///< Texture binds.
+        U32 textureUploads;         ///< Texture (sub-)image uploads.
+        U32 stateChanges;           ///< Enable/disable, blend, alpha-test, color, texture environment and polygon mode changes.
+        U32 clientStateChanges;     ///< Client array enable/disable changes.
+        U32 arrayPointerChanges;    ///< Vertex, texture coordinate and color array pointer changes.
+        U32 matrixChanges;          ///< Matrix stack changes.
+        U32 clears;                 ///< Buffer clears.
+    };
+
+    /// Returns whether the recorder is available on this platform.
+    bool isSupported( void );
+
+    /// Installs the recorder in place of the current GL functions.
+    /// @param captureEvents Whether each call is captured as an event as well as being counted.
+    /// @return Whether the recorder was installed.
+    bool install( const bool captureEvents = false );
+
+    /// Restores the GL functions that were replaced when the recorder was installed.
+    void uninstall( void );
+
+    /// Returns whether the recorder is installed.
+    bool isInstalled( void );
+
+    /// Sets whether each call is captured as an event.
+    void setCaptureEvents( const bool captureEvents );
+    bool getCaptureEvents( void );
+
+    /// Resets the recorded totals and events.
+    void reset( void );
+
+    /// The recorded totals.
+    const Trace& getTrace( void );
+
+    /// The recorded events.
+    /// @note Events are only recorded when capturing events.
+    const Vector<Event>& getEvents( void );
+
+    /// Returns the description of an event type.
+    const char* getEventTypeDescription( const EventType eventType );
+
+    /// Dumps the recorded totals (and events if captured) to the console.
+    void dumpToConsole( void );
+}
+/// @}
+
+#endif // _GL_RECORDER_H_
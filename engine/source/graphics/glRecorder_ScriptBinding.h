@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( GLRecorder, "GL recording functionality.");
+
+/*! @defgroup GLRecorderFunctions GL Recorder
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Installs the GL recorder in place of the GL driver.  Nothing is rendered while recording, GL calls are only counted.
+    @param captureEvents Whether each GL call is captured as an event as well as being counted.  Optional: Defaults to false.
+    @return Whether the recorder was installed.
+*/
+ConsoleFunctionWithDocs(startGLRecording, ConsoleBool, 1, 2, ([captureEvents]))
+{
+    return GLRecorder::install( argc > 1 ? dAtob(argv[1]) : false );
+}
+
+/*! Uninstalls the GL recorder and restores the GL driver.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(stopGLRecording, ConsoleVoid, 1, 1, ())
+{
+    GLRecorder::uninstall();
+}
+
+/*! Resets the GL recording totals and events.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(resetGLRecording, ConsoleVoid, 1, 1, ())
+{
+    GLRecorder::reset();
+}
+
+/*! Gets the GL recording totals.
+    @return The totals as "drawCalls vertices indices triangles textureBinds textureUploads stateChanges clientStateChanges arrayPointerChanges matrixChanges clears".
+*/
+ConsoleFunctionWithDocs(getGLRecording, ConsoleString, 1, 1, ())
+{
+    const GLRecorder::Trace& trace = GLRecorder::getTrace();
+
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%d %d %d %d %d %d %d %d %d %d %d",
+        trace.drawCalls, trace.vertices, trace.indices, trace.triangles,
+        trace.textureBinds, trace.textureUploads,
+        trace.stateChanges, trace.clientStateChanges, trace.arrayPointerChanges, trace.matrixChanges,
+        trace.clears );
+    return pBuffer;
+}
+
+/*! Dumps the GL recording totals (and any captured events) to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(dumpGLRecording, ConsoleVoid, 1, 1, ())
+{
+    GLRecorder::dumpToConsole();
+}
+
+ConsoleFunctionGroupEnd( GLRecorder );
+
+/*! @} */ // group GLRecorderFunctions
@@ -1079,13 +1079,13 @@ GuiInspectorDynamicField::GuiInspectorDynamicField( GuiInspectorGroup* parent, S
 {
    mGroup     = parent;
    mTarget     = target;
-   mDynField   = field;
+   mDynFieldName = field ? field->slotName : NULL;
    mRenameCtrl = NULL;
 }
 
 void GuiInspectorDynamicField::setData( const char* data )
 {
-   if( mTarget == NULL || mDynField == NULL )
+   if( mTarget == NULL || mDynFieldName == NULL )
       return;
 
    char buf[1024];
@@ -1093,7 +1093,7 @@ void GuiInspectorDynamicField::setData( const char* data )
    dStrcpy( buf, newValue ? newValue : "" );
    collapseEscape(buf);
 
-   mTarget->getFieldDictionary()->setFieldValue(mDynField->slotName, buf);
+   mTarget->getFieldDictionary()->setFieldValue(mDynFieldName, buf);
 
    // Force our edit to update
    updateValue( data );
@@ -1102,15 +1102,15 @@ void GuiInspectorDynamicField::setData( const char* data )
 
 const char* GuiInspectorDynamicField::getData()
 {
-   if( mTarget == NULL || mDynField == NULL )
+   if( mTarget == NULL || mDynFieldName == NULL )
       return "";
 
-   return mTarget->getFieldDictionary()->getFieldValue( mDynField->slotName );
+   return mTarget->getFieldDictionary()->getFieldValue( mDynFieldName );
 }
 
 void GuiInspectorDynamicField::renameField( StringTableEntry newFieldName )
 {
-   if( mTarget == NULL || mDynField == NULL || mGroup == NULL || mEdit == NULL )
+   if( mTarget == NULL || mDynFieldName == NULL || mGroup == NULL || mEdit == NULL )
    {
       Con::warnf("GuiInspectorDynamicField::renameField - No target object or dynamic field data found!" );
       return;
@@ -1150,11 +1150,14 @@ void GuiInspectorDynamicField::renameField( StringTableEntry newFieldName )
       return;
    }
 
+   // Keep the new field name as the entry may move once the old field is erased
+   StringTableEntry newSlotName = newEntry->slotName;
+
    // Set our old fields data to "" (which will effectively erase the field)
    mTarget->setDataField( getFieldName(), NULL, "" );
    
-   // Assign our dynamic field pointer (where we retrieve field information from) to our new field pointer
-   mDynField = newEntry;
+   // Assign our dynamic field name (where we retrieve field information from) to our new field name
+   mDynFieldName = newSlotName;
 
    // Lastly we need to reassign our AltCommand fields for our value edit control
    char szBuffer[512];
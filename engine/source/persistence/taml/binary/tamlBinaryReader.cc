@@ -26,6 +26,14 @@
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _PLATFORM_FILEIO_H_
+#include "platform/platformFileIO.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -36,6 +44,47 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_Read);
 
+    // Read header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return NULL;
+
+    return readStream( stream, versionId, compressed, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::read( const char* pFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadMapped);
+
+    // Map the file.
+    FileMapping fileMapping;
+    if ( !fileMapping.open( pFilePath ) )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file '%s' as it could not be mapped.", pFilePath );
+        return NULL;
+    }
+
+    // Read the header from the mapped file.
+    MemStream stream( fileMapping.getSize(), (void*)fileMapping.getData(), true, false );
+
+    // Read header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return NULL;
+
+    return readStream( stream, versionId, compressed, fileMapping.getData() );
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::readHeader( Stream& stream, U32& versionId, bool& compressed )
+{
     // Read Taml signature.
     StringTableEntry tamlSignature = stream.readSTString();
 
@@ -44,17 +93,37 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     {
         // Warn.
         Con::warnf("Taml: Cannot read binary file as signature is incorrect '%s'.", tamlSignature );
-        return NULL;
+        return false;
     }
 
     // Read version Id.
-    U32 versionId;
     stream.read( &versionId );
 
     // Read compressed flag.
-    bool compressed;
     stream.read( &compressed );
 
+    // Is the version supported?
+    if ( versionId > TAML_BINARY_VERSION_ID )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file as version '%d' is newer than the supported version '%d'.", versionId, TAML_BINARY_VERSION_ID );
+        return false;
+    }
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::readStream( Stream& stream, const U32 versionId, const bool compressed, const U8* pStreamData )
+{
+    // Is this a block version?
+    if ( versionId >= 3 )
+    {
+        // Yes, so read the block.
+        return readBlock( stream, compressed, pStreamData );
+    }
+
     SimObject* pSimObject = NULL;
 
     // Is the stream compressed?
@@ -81,6 +150,72 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
 
 //-----------------------------------------------------------------------------
 
+SimObject* TamlBinaryReader::readBlock( Stream& stream, const bool compressed, const U8* pStreamData )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadBlock);
+
+    // Read block size.
+    U32 blockSize;
+    stream.read( &blockSize );
+
+    // Is the block size valid?
+    if ( stream.getStatus() != Stream::Ok || blockSize == 0 || ( !compressed && blockSize > stream.getStreamSize() - stream.getPosition() ) )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Cannot read binary file as the block size is invalid." );
+        return NULL;
+    }
+
+    // Can the block be read in place?
+    if ( !compressed && pStreamData != NULL )
+    {
+        // Yes, so parse it directly.
+        return parseBlock( pStreamData + stream.getPosition(), blockSize );
+    }
+
+    // No, so read the block in one go.
+    U8* pBlock = (U8*)dMalloc( blockSize );
+    bool blockRead;
+
+    // Is the stream compressed?
+    if ( compressed )
+    {
+        // Yes, so attach zip stream.
+        ZipSubRStream zipStream;
+        zipStream.attachStream( &stream );
+
+        // Read block.
+        blockRead = zipStream.read( blockSize, pBlock );
+
+        // Detach zip stream.
+        zipStream.detachStream();
+    }
+    else
+    {
+        // No, so read block.
+        blockRead = stream.read( blockSize, pBlock );
+    }
+
+    // Parse the block.
+    SimObject* pSimObject = NULL;
+    if ( blockRead )
+    {
+        pSimObject = parseBlock( pBlock, blockSize );
+    }
+    else
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file as the block could not be read." );
+    }
+
+    dFree( pBlock );
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlBinaryReader::resetParse( void )
 {
     // Debug Profiling.
@@ -426,4 +561,460 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
             pChildNode->addField( fieldName, valueBuffer );
         }
     }
-}
\ No newline at end of file
+}
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::parseBlock( const U8* pBlock, const U32 blockSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseBlock);
+
+    mpBlock = pBlock;
+    mBlockSize = blockSize;
+    mBlockValid = true;
+
+    // Read the block header.
+    const U32 stringCount = readBlockU32( 0 );
+    const U32 stringTableOffset = readBlockU32( sizeof(U32) );
+    const U32 rootElementOffset = readBlockU32( sizeof(U32) * 2 );
+
+    // Is the string table valid?
+    // NOTE: The block always ends with a terminated string so every string is terminated within it.
+    if ( !mBlockValid ||
+        stringCount == 0 ||
+        stringTableOffset >= blockSize ||
+        stringCount > (blockSize - stringTableOffset) / sizeof(U32) ||
+        pBlock[blockSize-1] != 0 )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Cannot read binary file as the string table is invalid." );
+        mpBlock = NULL;
+        return NULL;
+    }
+
+    // Fetch the strings in place.
+    mBlockStrings.setSize( stringCount );
+    mBlockNames.setSize( stringCount );
+    for( U32 stringIndex = 0; stringIndex < stringCount; ++stringIndex )
+    {
+        const U32 stringOffset = readBlockU32( stringTableOffset + stringIndex * sizeof(U32) );
+
+        if ( stringOffset >= blockSize )
+            mBlockValid = false;
+
+        mBlockStrings[stringIndex] = mBlockValid ? (const char*)pBlock + stringOffset : StringTable->EmptyString;
+        mBlockNames[stringIndex] = NULL;
+    }
+
+    // Parse the root element.
+    SimObject* pSimObject = mBlockValid ? parseBlockElement( rootElementOffset ) : NULL;
+
+    // Warn if the block was corrupt.
+    if ( !mBlockValid )
+    {
+        Con::warnf("Taml: Binary file is corrupt so some objects may not have been read." );
+    }
+
+    // Reset the block.
+    mpBlock = NULL;
+    mBlockSize = 0;
+    mBlockStrings.clear();
+    mBlockNames.clear();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry TamlBinaryReader::getBlockName( const U32 stringIndex )
+{
+    // Is the string index valid?
+    if ( stringIndex >= (U32)mBlockNames.size() )
+    {
+        // No, so flag as invalid.
+        mBlockValid = false;
+        return StringTable->EmptyString;
+    }
+
+    // Insert each name into the string table only once.
+    StringTableEntry& name = mBlockNames[stringIndex];
+    if ( name == NULL )
+        name = StringTable->insert( mBlockStrings[stringIndex] );
+
+    return name;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::parseBlockElement( const U32 elementOffset )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseBlockElement);
+
+    SimObject* pSimObject = NULL;
+
+#ifdef TORQUE_DEBUG
+    // Format the type location.
+    char typeLocationBuffer[64];
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='binary' offset=%u]", elementOffset );
+#endif
+
+    U32 offset = elementOffset;
+
+    // Fetch element name.
+    StringTableEntry typeName = getBlockName( readBlockU32( offset ) );
+    offset += sizeof(U32);
+
+    // Fetch object name.
+    StringTableEntry objectName = getBlockName( readBlockU32( offset ) );
+    offset += sizeof(U32);
+
+    // Read references.
+    const U32 tamlRefId = readBlockU32( offset );
+    offset += sizeof(U32);
+    const U32 tamlRefToId = readBlockU32( offset );
+    offset += sizeof(U32);
+
+    // Finish if the element is corrupt.
+    if ( !mBlockValid )
+        return NULL;
+
+    // Do we have a reference to Id?
+    if ( tamlRefToId != 0 )
+    {
+        // Yes, so fetch reference.
+        typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( tamlRefToId );
+
+        // Did we find the reference?
+        if ( referenceItr == mObjectReferenceMap.end() )
+        {
+            // No, so warn.
+            Con::warnf( "Taml: Could not find a reference Id of '%d'", tamlRefToId );
+            return NULL;
+        }
+
+        // Return object.
+        return referenceItr->value;
+    }
+
+#ifdef TORQUE_DEBUG
+    // Create type.
+    pSimObject = Taml::createType( typeName, mpTaml, typeLocationBuffer );
+#else
+    // Create type.
+    pSimObject = Taml::createType( typeName, mpTaml );
+#endif
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+        return NULL;
+
+    // Find Taml callbacks.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Fetch attribute count.
+    const U32 attributeCount = readBlockU32( offset );
+    offset += sizeof(U32);
+
+    // Iterate attributes.
+    for ( U32 index = 0; index < attributeCount && mBlockValid; ++index )
+    {
+        // Fetch attribute.
+        // NOTE: The value is used in place.
+        StringTableEntry attributeName = getBlockName( readBlockU32( offset ) );
+        const char* pAttributeValue = getBlockString( readBlockU32( offset + sizeof(U32) ) );
+        offset += sizeof(U32) * 2;
+
+        // We can assume this is a field for now.
+        if ( mBlockValid )
+            pSimObject->setPrefixedDataField( attributeName, NULL, pAttributeValue );
+    }
+
+    // Does the object require a name?
+    if ( objectName == StringTable->EmptyString )
+    {
+        // No, so just register anonymously.
+        pSimObject->registerObject();
+    }
+    else
+    {
+        // Yes, so register a named object.
+        pSimObject->registerObject( objectName );
+
+        // Was the name assigned?
+        if ( pSimObject->getName() != objectName )
+        {
+            // No, so warn that the name was rejected.
+#ifdef TORQUE_DEBUG
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.  '%s'", typeName, objectName, typeLocationBuffer );
+#else
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.", typeName, objectName );
+#endif
+        }
+    }
+
+    // Do we have a reference Id?
+    if ( tamlRefId != 0 )
+    {
+        // Yes, so insert reference.
+        mObjectReferenceMap.insert( tamlRefId, pSimObject );
+    }
+
+    // Parse custom elements.
+    TamlCustomNodes customProperties;
+
+    // Parse children.
+    parseBlockChildren( offset, pCallbacks, pSimObject, elementOffset );
+
+    // Parse custom elements.
+    parseBlockCustomElements( offset, pCallbacks, customProperties, elementOffset );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPostRead( pCallbacks, customProperties );
+    }
+
+    // Return object.
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseBlockChildren( U32& offset, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 elementOffset )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseBlockChildren);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Taml: Cannot parse children on a NULL object." );
+
+    // Fetch children count.
+    const U32 childrenCount = readBlockU32( offset );
+    offset += sizeof(U32);
+
+    // Skip the child offsets.
+    const U32 childOffsetsOffset = offset;
+    if ( childrenCount > mBlockSize / sizeof(U32) )
+    {
+        mBlockValid = false;
+        return;
+    }
+    offset += childrenCount * sizeof(U32);
+
+    // Finish if no children.
+    if ( childrenCount == 0 || !mBlockValid )
+        return;
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Is this a sim set?
+    if ( pChildren == NULL )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Child element found under parent but object cannot have children." );
+        return;
+    }
+
+    // Fetch any container child class specifier.
+    AbstractClassRep* pContainerChildClass = pSimObject->getClassRep()->getContainerChildClass( true );
+
+    // Iterate children.
+    for ( U32 index = 0; index < childrenCount; ++ index )
+    {
+        // Fetch the child offset.
+        // NOTE: Children always follow their parent which also prevents any cycles.
+        const U32 childOffset = readBlockU32( childOffsetsOffset + index * sizeof(U32) );
+        if ( childOffset <= elementOffset )
+            mBlockValid = false;
+
+        // Finish if the block is corrupt.
+        if ( !mBlockValid )
+            return;
+
+        // Parse child element.
+        SimObject* pChildSimObject = parseBlockElement( childOffset );
+
+        // Finish if child failed.
+        if ( pChildSimObject == NULL )
+            return;
+
+        // Do we have a container child class?
+        if ( pContainerChildClass != NULL )
+        {
+            // Yes, so is the child object the correctly derived type?
+            if ( !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
+            {
+                // No, so warn.
+                Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
+                    pChildSimObject->getClassName(),
+                    pSimObject->getClassName(),
+                    pContainerChildClass->getClassName() );
+
+                // NOTE: We can't delete the object as it may be referenced elsewhere!
+                pChildSimObject = NULL;
+
+                // Skip.
+                continue;
+            }
+        }
+
+        // Add child.
+        pChildren->addTamlChild( pChildSimObject );
+
+        // Find Taml callbacks for child.
+        TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+        // Do we have callbacks on the child?
+        if ( pChildCallbacks != NULL )
+        {
+            // Yes, so perform callback.
+            mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseBlockCustomElements( U32& offset, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 elementOffset )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseBlockCustomElements);
+
+    // Read custom node count.
+    const U32 customNodeCount = readBlockU32( offset );
+    offset += sizeof(U32);
+
+    // Finish if no custom nodes.
+    if ( customNodeCount == 0 || !mBlockValid )
+        return;
+
+    // Iterate custom nodes.
+    for ( U32 nodeIndex = 0; nodeIndex < customNodeCount && mBlockValid; ++nodeIndex )
+    {
+        // Fetch the custom element offset.
+        const U32 customElementOffset = readBlockU32( offset + nodeIndex * sizeof(U32) );
+        if ( customElementOffset <= elementOffset )
+        {
+            mBlockValid = false;
+            return;
+        }
+
+        // Read custom node name.
+        StringTableEntry nodeName = getBlockName( readBlockU32( customElementOffset ) );
+
+        // Add custom node.
+        TamlCustomNode* pCustomNode = customNodes.addNode( nodeName );
+
+        // Read child node count.
+        const U32 childNodeCount = readBlockU32( customElementOffset + sizeof(U32) );
+
+        // Parse the children nodes.
+        for( U32 childIndex = 0; childIndex < childNodeCount && mBlockValid; ++childIndex )
+        {
+            const U32 childNodeOffset = readBlockU32( customElementOffset + sizeof(U32) * (2 + childIndex) );
+            if ( childNodeOffset <= customElementOffset )
+            {
+                mBlockValid = false;
+                return;
+            }
+
+            parseBlockCustomNode( childNodeOffset, pCustomNode );
+        }
+    }
+
+    // Do we have callbacks?
+    if ( pCallbacks == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Encountered custom data but object does not support custom data." );
+        return;
+    }
+
+    // Custom read callback.
+    mpTaml->tamlCustomRead( pCallbacks, customNodes );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseBlockCustomNode( const U32 nodeOffset, TamlCustomNode* pCustomNode )
+{
+    // Fetch if a proxy object.
+    const bool isProxyObject = readBlockU32( nodeOffset ) != 0;
+
+    // Is this a proxy object?
+    if ( isProxyObject )
+    {
+        // Yes, so parse proxy object.
+        SimObject* pProxyObject = parseBlockElement( nodeOffset + sizeof(U32) );
+
+        // Add child node.
+        pCustomNode->addNode( pProxyObject );
+
+        return;
+    }
+
+    // No, so read custom node name.
+    StringTableEntry nodeName = getBlockName( readBlockU32( nodeOffset + sizeof(U32) ) );
+
+    // Read child node text.
+    const char* pNodeText = getBlockString( readBlockU32( nodeOffset + sizeof(U32) * 2 ) );
+
+    // Read child node count.
+    const U32 childNodeCount = readBlockU32( nodeOffset + sizeof(U32) * 3 );
+
+    // Finish if the node is corrupt.
+    if ( !mBlockValid || childNodeCount > mBlockSize / sizeof(U32) )
+    {
+        mBlockValid = false;
+        return;
+    }
+
+    // Add child node.
+    TamlCustomNode* pChildNode = pCustomNode->addNode( nodeName );
+    pChildNode->setNodeText( pNodeText );
+
+    const U32 childOffsetsOffset = nodeOffset + sizeof(U32) * 4;
+    U32 offset = childOffsetsOffset + childNodeCount * sizeof(U32);
+
+    // Read child field count.
+    const U32 childFieldCount = readBlockU32( offset );
+    offset += sizeof(U32);
+
+    // Parse child fields.
+    for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount && mBlockValid; ++childFieldIndex )
+    {
+        // Read field name.
+        StringTableEntry fieldName = getBlockName( readBlockU32( offset ) );
+
+        // Read field value.
+        const char* pFieldValue = getBlockString( readBlockU32( offset + sizeof(U32) ) );
+        offset += sizeof(U32) * 2;
+
+        // Add field.
+        if ( mBlockValid )
+            pChildNode->addField( fieldName, pFieldValue );
+    }
+
+    // Parse children nodes.
+    for( U32 childIndex = 0; childIndex < childNodeCount && mBlockValid; ++childIndex )
+    {
+        const U32 childNodeOffset = readBlockU32( childOffsetsOffset + childIndex * sizeof(U32) );
+        if ( childNodeOffset <= nodeOffset )
+        {
+            mBlockValid = false;
+            return;
+        }
+
+        parseBlockCustomNode( childNodeOffset, pChildNode );
+    }
+}
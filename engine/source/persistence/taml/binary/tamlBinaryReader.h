@@ -31,6 +31,10 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _PLATFORM_ENDIAN_H_
+#include "platform/platformEndian.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -39,7 +43,10 @@ class TamlBinaryReader
 {
 public:
     TamlBinaryReader( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpBlock( NULL ),
+        mBlockSize( 0 ),
+        mBlockValid( false )
     {
     }
 
@@ -47,6 +54,7 @@ public:
 
     /// Read.
     SimObject* read( FileStream& stream );
+    SimObject* read( const char* pFilePath );
 
 private:
     Taml* mpTaml;
@@ -55,9 +63,50 @@ private:
 
     typeObjectReferenceHash mObjectReferenceMap;
 
+    /// Block being read in place.
+    const U8*                   mpBlock;
+    U32                         mBlockSize;
+    bool                        mBlockValid;
+    Vector<const char*>         mBlockStrings;
+    Vector<StringTableEntry>    mBlockNames;
+
 private:
     void resetParse( void );
 
+    bool readHeader( Stream& stream, U32& versionId, bool& compressed );
+    SimObject* readStream( Stream& stream, const U32 versionId, const bool compressed, const U8* pStreamData );
+    SimObject* readBlock( Stream& stream, const bool compressed, const U8* pStreamData );
+
+    SimObject* parseBlock( const U8* pBlock, const U32 blockSize );
+    inline U32 readBlockU32( const U32 offset )
+    {
+        // Flag the block as invalid if reading outside of it.
+        if ( offset > mBlockSize - sizeof(U32) || mBlockSize < sizeof(U32) )
+        {
+            mBlockValid = false;
+            return 0;
+        }
+
+        U32 value;
+        dMemcpy( &value, mpBlock + offset, sizeof(U32) );
+        return convertLEndianToHost( value );
+    }
+    inline const char* getBlockString( const U32 stringIndex )
+    {
+        if ( stringIndex >= (U32)mBlockStrings.size() )
+        {
+            mBlockValid = false;
+            return StringTable->EmptyString;
+        }
+
+        return mBlockStrings[stringIndex];
+    }
+    StringTableEntry getBlockName( const U32 stringIndex );
+    SimObject* parseBlockElement( const U32 elementOffset );
+    void parseBlockChildren( U32& offset, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 elementOffset );
+    void parseBlockCustomElements( U32& offset, TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 elementOffset );
+    void parseBlockCustomNode( const U32 nodeOffset, TamlCustomNode* pCustomNode );
+
     SimObject* parseElement( Stream& stream, const U32 versionId );
     void parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId );
     void parseChildren( Stream& stream, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId );
@@ -26,11 +26,32 @@
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _PLATFORM_ENDIAN_H_
+#include "platform/platformEndian.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+// Block layout (all values are little-endian U32, offsets are from the start of the block):
+//
+// Block:           stringCount, stringTableOffset, rootElementOffset, <records>, <string table>
+// String table:    stringOffset[stringCount], <null-terminated strings>
+// Element:         typeName, objectName, refId, refToId
+//                  (the rest is omitted when refToId is set)
+//                  attributeCount, { name, value }[attributeCount]
+//                  childCount, childElementOffset[childCount]
+//                  customElementCount, customElementOffset[customElementCount]
+// Custom element:  name, childCount, customNodeOffset[childCount]
+// Custom node:     isProxy, <element when a proxy>
+//                  name, text, childCount, customNodeOffset[childCount], fieldCount, { name, value }[fieldCount]
+//
+// Names and values are indices into the string table.  String index zero is always the empty string.
+
+//-----------------------------------------------------------------------------
+
 bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed )
 {
     // Debug Profiling.
@@ -45,6 +66,17 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
     // Write compressed flag.
     stream.write( compressed );
 
+    // Build the block.
+    resetBlock();
+    const U32 stringCountOffset = reserveU32( 3 );
+    const U32 rootElementOffset = writeElement( pTamlWriteNode );
+    patchU32( stringCountOffset + sizeof(U32) * 2, rootElementOffset );
+    writeStringTable();
+
+    // Write block size.
+    const U32 blockSize = (U32)mBlock.size();
+    stream.write( blockSize );
+
     // Are we compressed?
     if ( compressed )
     {
@@ -52,24 +84,125 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
         ZipSubWStream zipStream;
         zipStream.attachStream( &stream );
 
-        // Write element.
-        writeElement( zipStream, pTamlWriteNode );
+        // Write block.
+        zipStream.write( blockSize, mBlock.address() );
 
         // Detach zip stream.
         zipStream.detachStream();
     }
     else
     {
-        // No, so write element.
-        writeElement( stream, pTamlWriteNode );
+        // No, so write block.
+        stream.write( blockSize, mBlock.address() );
     }
 
-    return true;
+    // Release the block.
+    resetBlock();
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::resetBlock( void )
+{
+    mBlock.clear();
+    mStrings.clear();
+    mStringIndices.clear();
+
+    // String index zero is always the empty string.
+    mStrings.push_back( StringTable->EmptyString );
+    mStringIndices.insert( StringTable->EmptyString, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryWriter::writeU32( const U32 value )
+{
+    const U32 offset = reserveU32( 1 );
+    patchU32( offset, value );
+    return offset;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryWriter::reserveU32( const U32 count )
+{
+    const U32 offset = (U32)mBlock.size();
+    mBlock.setSize( offset + count * sizeof(U32) );
+    dMemset( mBlock.address() + offset, 0, count * sizeof(U32) );
+    return offset;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::patchU32( const U32 offset, const U32 value )
+{
+    // Sanity!
+    AssertFatal( offset + sizeof(U32) <= (U32)mBlock.size(), "TamlBinaryWriter::patchU32() - Offset is outside the block." );
+
+    const U32 littleEndianValue = convertHostToLEndian( value );
+    dMemcpy( mBlock.address() + offset, &littleEndianValue, sizeof(U32) );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryWriter::getStringIndex( const char* pString )
+{
+    // Treat no string as empty.
+    if ( pString == NULL || *pString == 0 )
+        return 0;
+
+    // Fetch the string entry.
+    // NOTE: Values are case-sensitive so they must not share an entry with a different case.
+    StringTableEntry stringEntry = StringTable->insert( pString, true );
+
+    // Is the string already in the table?
+    typeStringIndexHash::iterator stringItr = mStringIndices.find( stringEntry );
+    if ( stringItr != mStringIndices.end() )
+        return stringItr->value;
+
+    // No, so add it.
+    const U32 stringIndex = (U32)mStrings.size();
+    mStrings.push_back( stringEntry );
+    mStringIndices.insert( stringEntry, stringIndex );
+
+    return stringIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeStringTable( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_WriteStringTable);
+
+    const U32 stringCount = (U32)mStrings.size();
+
+    // Write the string count and table offset into the block header.
+    patchU32( 0, stringCount );
+    patchU32( sizeof(U32), (U32)mBlock.size() );
+
+    // Reserve the string offsets.
+    const U32 stringOffsetsOffset = reserveU32( stringCount );
+
+    // Write the strings.
+    for( U32 stringIndex = 0; stringIndex < stringCount; ++stringIndex )
+    {
+        const char* pString = mStrings[stringIndex];
+        const U32 stringLength = dStrlen( pString ) + 1;
+        const U32 stringOffset = (U32)mBlock.size();
+
+        patchU32( stringOffsetsOffset + stringIndex * sizeof(U32), stringOffset );
+
+        mBlock.setSize( stringOffset + stringLength );
+        dMemcpy( mBlock.address() + stringOffset, pString, stringLength );
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode )
+U32 TamlBinaryWriter::writeElement( const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_WriteElement);
@@ -77,23 +210,14 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     // Fetch object.
     SimObject* pSimObject = pTamlWriteNode->mpSimObject;
 
-    // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
-
     // Write element name.
-    stream.writeString( pElementName );
-
-    // Fetch object name.
-    const char* pObjectName = pTamlWriteNode->mpObjectName;
+    const U32 elementOffset = writeU32( getStringIndex( pSimObject->getClassName() ) );
 
     // Write object name.
-    stream.writeString( pObjectName != NULL ? pObjectName : StringTable->EmptyString );
-
-    // Fetch reference Id.
-    const U32 tamlRefId = pTamlWriteNode->mRefId;
+    writeU32( getStringIndex( pTamlWriteNode->mpObjectName ) );
 
     // Write reference Id.
-    stream.write( tamlRefId );
+    writeU32( pTamlWriteNode->mRefId );
 
     // Do we have a reference to node?
     if ( pTamlWriteNode->mRefToNode != NULL )
@@ -105,28 +229,53 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
         AssertFatal( tamlRefToId != 0, "Taml: Invalid reference to Id." );
 
         // Write reference to Id.
-        stream.write( tamlRefToId );
+        writeU32( tamlRefToId );
 
         // Finished.
-        return;
+        return elementOffset;
     }
 
     // No, so write no reference to Id.
-    stream.write( 0 );
+    writeU32( 0 );
 
     // Write attributes.
-    writeAttributes( stream, pTamlWriteNode );
+    writeAttributes( pTamlWriteNode );
+
+    // Fetch children.
+    Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
+    const U32 childCount = pChildren == NULL ? 0 : (U32)pChildren->size();
+
+    // Write children count and reserve their offsets.
+    writeU32( childCount );
+    const U32 childOffsetsOffset = reserveU32( childCount );
+
+    // Fetch custom nodes.
+    const TamlCustomNodeVector& customNodes = pTamlWriteNode->mCustomNodes.getNodes();
+    const U32 customNodeCount = (U32)customNodes.size();
+
+    // Write custom node count and reserve their offsets.
+    writeU32( customNodeCount );
+    const U32 customOffsetsOffset = reserveU32( customNodeCount );
 
     // Write children.
-    writeChildren( stream, pTamlWriteNode );
+    for( U32 childIndex = 0; childIndex < childCount; ++childIndex )
+    {
+        patchU32( childOffsetsOffset + childIndex * sizeof(U32), writeElement( (*pChildren)[childIndex] ) );
+    }
 
     // Write custom elements.
-    writeCustomElements( stream, pTamlWriteNode );
+    for( U32 customIndex = 0; customIndex < customNodeCount; ++customIndex )
+    {
+        patchU32( customOffsetsOffset + customIndex * sizeof(U32), (U32)mBlock.size() );
+        writeCustomElement( customNodes[customIndex] );
+    }
+
+    return elementOffset;
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode )
+void TamlBinaryWriter::writeAttributes( const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_WriteAttributes);
@@ -134,12 +283,8 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
     // Fetch fields.
     const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
 
-    // Write placeholder attribute count.
-    stream.write( (U32)fields.size() );
-
-    // Finish if no fields.
-    if ( fields.size() == 0 )
-        return;
+    // Write attribute count.
+    writeU32( (U32)fields.size() );
 
     // Iterate fields.
     for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
@@ -148,150 +293,90 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
 
         // Write attribute.
-        stream.writeString( pFieldValue->mName );
-        stream.writeLongString( 4096, pFieldValue->mpValue );
-    }
-}
-
-void TamlBinaryWriter::writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(TamlBinaryWriter_WriteChildren);
-
-    // Fetch children.
-    Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
-
-    // Do we have any children?
-    if ( pChildren == NULL )
-    {
-        // No, so write no children.
-        stream.write( (U32)0 );
-        return;
-    }
-
-    // Write children count.
-    stream.write( (U32)pChildren->size() );
-
-    // Iterate children.
-    for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
-    {
-        // Write child.
-        writeElement( stream, (*itr) );
+        writeU32( getStringIndex( pFieldValue->mName ) );
+        writeU32( getStringIndex( pFieldValue->mpValue ) );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryWriter::writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode )
+void TamlBinaryWriter::writeCustomElement( const TamlCustomNode* pCustomNode )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlBinaryWriter_WriteCustomElements);
-
-    // Fetch custom nodes.
-    const TamlCustomNodes& customNodes = pTamlWriteNode->mCustomNodes;
+    PROFILE_SCOPE(TamlBinaryWriter_WriteCustomElement);
 
-    // Fetch custom nodes.
-    const TamlCustomNodeVector& nodes = customNodes.getNodes();
+    // Write custom node name.
+    writeU32( getStringIndex( pCustomNode->getNodeName() ) );
 
-    // Write custom node count.
-    stream.write( (U32)nodes.size() );
+    // Fetch node children.
+    const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    const U32 childCount = (U32)nodeChildren.size();
 
-    // Finish if there are no nodes.
-    if ( nodes.size() == 0 )
-        return;
+    // Write children count and reserve their offsets.
+    writeU32( childCount );
+    const U32 childOffsetsOffset = reserveU32( childCount );
 
-    // Iterate custom nodes.
-    for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
+    // Write the children nodes.
+    for( U32 childIndex = 0; childIndex < childCount; ++childIndex )
     {
-        // Fetch the custom node.
-        TamlCustomNode* pCustomNode = *customNodesItr;
-
-        // Write custom node name.
-        stream.writeString( pCustomNode->getNodeName() );
-
-        // Fetch node children.
-        const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
-
-        // Iterate children nodes.
-        for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
-        {
-            // Fetch child node.
-            const TamlCustomNode* pChildNode = *childNodeItr;
-
-            // Write the custom node.
-            writeCustomNode( stream, pChildNode );
-        }
+        patchU32( childOffsetsOffset + childIndex * sizeof(U32), (U32)mBlock.size() );
+        writeCustomNode( nodeChildren[childIndex] );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode )
+void TamlBinaryWriter::writeCustomNode( const TamlCustomNode* pCustomNode )
 {
     // Is the node a proxy object?
     if ( pCustomNode->isProxyObject() )
     {
         // Yes, so flag as proxy object.
-        stream.write( true );
+        writeU32( 1 );
 
         // Write the element.
-        writeElement( stream, pCustomNode->getProxyWriteNode() );
+        writeElement( pCustomNode->getProxyWriteNode() );
         return;
     }
 
     // No, so flag as custom node.
-    stream.write( false );
+    writeU32( 0 );
 
     // Write custom node name.
-    stream.writeString( pCustomNode->getNodeName() );
+    writeU32( getStringIndex( pCustomNode->getNodeName() ) );
 
     // Write custom node text.
-    stream.writeLongString(MAX_TAML_NODE_FIELDVALUE_LENGTH, pCustomNode->getNodeTextField().getFieldValue());
+    writeU32( getStringIndex( pCustomNode->getNodeTextField().getFieldValue() ) );
 
     // Fetch node children.
     const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
-
-    // Fetch child node count.
     const U32 childNodeCount = (U32)nodeChildren.size();
 
-    // Write custom node count.
-    stream.write( childNodeCount );
-
-    // Do we have any children nodes.
-    if ( childNodeCount > 0 )
-    {
-        // Yes, so iterate children nodes.
-        for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
-        {
-            // Fetch child node.
-            const TamlCustomNode* pChildNode = *childNodeItr;
-
-            // Write the custom node.
-            writeCustomNode( stream, pChildNode );
-        }
-    }
+    // Write custom node count and reserve their offsets.
+    writeU32( childNodeCount );
+    const U32 childOffsetsOffset = reserveU32( childNodeCount );
 
     // Fetch fields.
     const TamlCustomFieldVector& fields = pCustomNode->getFields();
 
-    // Fetch child field count.
-    const U32 childFieldCount = (U32)fields.size();
-
     // Write custom field count.
-    stream.write( childFieldCount );
+    writeU32( (U32)fields.size() );
 
-    // Do we have any child fields?
-    if ( childFieldCount > 0 )
+    // Iterate fields.
+    for ( TamlCustomFieldVector::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
+    {
+        // Fetch node field.
+        const TamlCustomField* pField = *fieldItr;
+
+        // Write the node field.
+        writeU32( getStringIndex( pField->getFieldName() ) );
+        writeU32( getStringIndex( pField->getFieldValue() ) );
+    }
+
+    // Write the children nodes.
+    for( U32 childIndex = 0; childIndex < childNodeCount; ++childIndex )
     {
-        // Yes, so iterate  fields.
-        for ( TamlCustomFieldVector::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
-        {
-            // Fetch node field.
-            const TamlCustomField* pField = *fieldItr;
-
-            // Write the node field.
-            stream.writeString( pField->getFieldName() );
-            stream.writeLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, pField->getFieldValue() );
-        }
+        patchU32( childOffsetsOffset + childIndex * sizeof(U32), (U32)mBlock.size() );
+        writeCustomNode( nodeChildren[childIndex] );
     }
-}
\ No newline at end of file
+}
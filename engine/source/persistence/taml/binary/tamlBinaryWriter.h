@@ -27,6 +27,10 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -36,7 +40,7 @@ class TamlBinaryWriter
 public:
     TamlBinaryWriter( Taml* pTaml ) :
         mpTaml( pTaml ),
-        mVersionId(2)
+        mVersionId(TAML_BINARY_VERSION_ID)
     {
     }
     virtual ~TamlBinaryWriter() {}
@@ -48,12 +52,24 @@ private:
     Taml* mpTaml;
     const U32 mVersionId;
 
+    typedef HashMap<StringTableEntry, U32> typeStringIndexHash;
+
+    Vector<U8>                  mBlock;
+    Vector<StringTableEntry>    mStrings;
+    typeStringIndexHash         mStringIndices;
+
 private:
-    void writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode );
-    void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode );
-    void writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode );
-    void writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode );
-    void writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode );
+    void resetBlock( void );
+    U32 writeU32( const U32 value );
+    U32 reserveU32( const U32 count );
+    void patchU32( const U32 offset, const U32 value );
+    U32 getStringIndex( const char* pString );
+    void writeStringTable( void );
+
+    U32 writeElement( const TamlWriteNode* pTamlWriteNode );
+    void writeAttributes( const TamlWriteNode* pTamlWriteNode );
+    void writeCustomElement( const TamlCustomNode* pCustomNode );
+    void writeCustomNode( const TamlCustomNode* pCustomNode );
 };
 
 #endif // _TAML_BINARYWRITER_H_
\ No newline at end of file
@@ -24,7 +24,7 @@
 #include "persistence/taml/tamlVisitor.h"
 #include "console/console.h"
 #include "io/fileStream.h"
-#include "memory/frameAllocator.h"
+#include "collection/vector.h"
 
 // Debug Profiling.
 #include "debug/profiler.h"
@@ -54,18 +54,21 @@ bool TamlJSONParser::accept( const char* pFilename, TamlVisitor& visitor )
     }
 
     // Read JSON file.
+    // NOTE: The text isn't frame allocated as files can be parsed on job workers.
     const U32 streamSize = stream.getStreamSize();
-    FrameTemp<char> jsonText( streamSize + 1 );
-    if ( !stream.read( streamSize, jsonText ) )
+    Vector<char> jsonText;
+    jsonText.setSize( streamSize + 1 );
+    if ( !stream.read( streamSize, jsonText.address() ) )
     {
         // Warn!
         Con::warnf("TamlJSONParser::parse() - Could not load Taml JSON file from stream.");
         return false;
     }
+    jsonText[streamSize] = 0;
 
     // Create JSON document.
     rapidjson::Document inputDocument;
-    inputDocument.Parse<0>( jsonText );
+    inputDocument.Parse<0>( jsonText.address() );
 
     // Close the stream.
     stream.close();
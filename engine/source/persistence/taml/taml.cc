@@ -276,6 +276,32 @@ SimObject* Taml::read( const char* pFilename )
     // Expand the file-name into the file-path buffer.
     Con::expandPath( mFilePathBuffer, sizeof(mFilePathBuffer), pFilename );
 
+    // Get the file auto-format mode.
+    const TamlFormatMode formatMode = getFileAutoFormatMode( mFilePathBuffer );
+
+    // Is the file binary?
+    if ( formatMode == BinaryFormat )
+    {
+        // Yes, so reset the compilation.
+        resetCompilation();
+
+        // Read the mapped file in place.
+        TamlBinaryReader reader( this );
+        SimObject* pSimObject = reader.read( mFilePathBuffer );
+
+        // Reset the compilation.
+        resetCompilation();
+
+        // Did we generate an object?
+        if ( pSimObject == NULL )
+        {
+            // No, so warn.
+            Con::warnf( "Taml::read() - Failed to load an object from the file '%s'.", mFilePathBuffer );
+        }
+
+        return pSimObject;
+    }
+
     FileStream stream;
 
     // File opened?
@@ -286,9 +312,6 @@ SimObject* Taml::read( const char* pFilename )
         return NULL;
     }
 
-    // Get the file auto-format mode.
-    const TamlFormatMode formatMode = getFileAutoFormatMode( mFilePathBuffer );
-
     // Reset the compilation.
     resetCompilation();
 
@@ -757,28 +780,28 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
     Vector<SimFieldDictionary::Entry*> dynamicFieldList(__FILE__, __LINE__);
 
     // Ensure the dynamic field doesn't conflict with static field.
-    for( U32 hashIndex = 0; hashIndex < SimFieldDictionary::HashTableSize; ++hashIndex )
+    for( SimFieldDictionaryIterator fieldItr( pFieldDictionary ); *fieldItr; ++fieldItr )
     {
-        for( SimFieldDictionary::Entry* pEntry = pFieldDictionary->mHashTable[hashIndex]; pEntry; pEntry = pEntry->next )
+        // Fetch entry.
+        SimFieldDictionary::Entry* pEntry = *fieldItr;
+
+        // Iterate static fields.
+        U32 fieldIndex;
+        for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
         {
-            // Iterate static fields.
-            U32 fieldIndex;
-            for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
-            {
-                if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
-                    break;
-            }
+            if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
+                break;
+        }
 
-            // Skip if found.
-            if( fieldIndex != (U32)fieldList.size() )
-                continue;
+        // Skip if found.
+        if( fieldIndex != (U32)fieldList.size() )
+            continue;
 
-            // Skip if not writing field.
-            if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
-                continue;
+        // Skip if not writing field.
+        if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
+            continue;
 
-            dynamicFieldList.push_back( pEntry );
-        }
+        dynamicFieldList.push_back( pEntry );
     }
 
     // Sort Entries to prevent version control conflicts
@@ -64,6 +64,7 @@ extern StringTableEntry tamlNamedObjectName;
 //-----------------------------------------------------------------------------
 
 #define TAML_SIGNATURE                  "Taml"
+#define TAML_BINARY_VERSION_ID          3
 #define TAML_SCHEMA_VARIABLE            "$pref::T2D::TAMLSchema"
 #define TAML_JSON_STRICT_VARIBLE        "$pref::T2D::JSONStrict"
 
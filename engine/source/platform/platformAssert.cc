@@ -113,6 +113,9 @@ bool PlatformAssert::process(Type         assertType,
    // if not a WARNING pop-up a dialog box
    if (assertType != Warning)
    {
+      // Make sure the log has the assert before we might die.
+      Con::flushLog();
+
       // used for processing navGraphs (an assert won't botch the whole build)
       if(Con::getBoolVariable("$FP::DisableAsserts", false) == true)
          Platform::forceShutdown(1);
@@ -29,6 +29,80 @@
 
 #include "platformFileIO_ScriptBinding.h"
 
+#if defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_OSX) || defined(TORQUE_OS_IOS)
+#define TORQUE_FILE_MAPPING_MMAP
+#include <sys/mman.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+bool FileMapping::open(const char *filename)
+{
+   AssertFatal(filename != NULL, "FileMapping::open: NULL filename");
+
+   close();
+
+   // Open through File so the path is resolved the same way as every other read.
+   File file;
+   if (file.open(filename, File::Read) != File::Ok)
+      return false;
+
+   const U32 size = file.getSize();
+   if (size == 0)
+      return false;
+
+#ifdef TORQUE_FILE_MAPPING_MMAP
+   // Map the file that was opened.
+   const S32 fd = file.getDescriptor();
+   if (fd != -1)
+   {
+      void* pMapping = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (pMapping != MAP_FAILED)
+      {
+         mpData = (U8*)pMapping;
+         mSize = size;
+         mMapped = true;
+         file.close();
+         return true;
+      }
+   }
+#endif
+
+   // Fall back to reading the whole file in one go.
+   mpData = (U8*)dMalloc(size);
+   U32 bytesRead = 0;
+   file.read(size, (char*)mpData, &bytesRead);
+   file.close();
+
+   if (bytesRead != size)
+   {
+      close();
+      return false;
+   }
+
+   mSize = size;
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void FileMapping::close()
+{
+   if (mpData == NULL)
+      return;
+
+#ifdef TORQUE_FILE_MAPPING_MMAP
+   if (mMapped)
+      munmap(mpData, mSize);
+   else
+#endif
+      dFree(mpData);
+
+   mpData = NULL;
+   mSize = 0;
+   mMapped = false;
+}
+
 //-----------------------------------------------------------------------------
 
 StringTableEntry Platform::getTemporaryDirectory()
@@ -114,6 +114,11 @@ public:
    /// Returns the size of the file
    U32 getSize() const;
 
+   /// Returns the operating system descriptor of the open file, or -1 if there isn't one.
+   ///
+   /// Only implemented on platforms that map files (see FileMapping).
+   S32 getDescriptor() const;
+
    /// Make sure everything that's supposed to be written to the file gets written.
    ///
    /// @returns The status of the file.
@@ -145,4 +150,35 @@ protected:
    Status setStatus(Status status);    ///< Setter for the current status.
 };
 
+/// Read-only view of a whole file in memory.
+///
+/// The file is memory-mapped where the platform supports it, otherwise it is
+/// read into a single allocation with one read call.  Either way the contents
+/// can be parsed in place without going through a stream.
+class FileMapping
+{
+private:
+   U8* mpData;       ///< The file contents.
+   U32 mSize;        ///< The size of the file contents.
+   bool mMapped;     ///< Whether the contents are mapped or allocated.
+
+   FileMapping(const FileMapping&);              ///< This is here to disable the copy constructor.
+   FileMapping& operator=(const FileMapping&);   ///< This is here to disable assignment.
+
+public:
+   FileMapping() : mpData( NULL ), mSize( 0 ), mMapped( false ) {}
+   ~FileMapping() { close(); }
+
+   /// Maps the file for reading.
+   /// @returns Whether the file contents are available or not.
+   bool open(const char *filename);
+
+   /// Releases the file contents.
+   void close();
+
+   inline const U8* getData() const { return mpData; }
+   inline U32 getSize() const { return mSize; }
+   inline bool isMapped() const { return mMapped; }
+};
+
 #endif // _FILE_IO_H_
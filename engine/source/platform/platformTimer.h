@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_TIMER_H_
+#define _PLATFORM_TIMER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+
+/// A simple high-resolution timer used for fine-grained timings such as debug stats.
+/// Unlike Platform::getRealMilliseconds(), this has sub-millisecond resolution.
+class PlatformTimer
+{
+private:
+    typedef std::chrono::steady_clock typeClock;
+
+    typeClock::time_point   mStartTime;
+
+public:
+    PlatformTimer() { reset(); }
+
+    /// Reset the timer start.
+    inline void reset( void ) { mStartTime = typeClock::now(); }
+
+    /// Get the elapsed time since the timer start (in milliseconds).
+    inline F32 getElapsedMs( void ) const
+    {
+        return std::chrono::duration<F32, std::milli>( typeClock::now() - mStartTime ).count();
+    }
+
+    /// Get a monotonic timestamp (in microseconds).
+    static inline U64 getMicroseconds( void )
+    {
+        return (U64)std::chrono::duration_cast<std::chrono::microseconds>( typeClock::now().time_since_epoch() ).count();
+    }
+
+    /// Get a monotonic timestamp (in nanoseconds).
+    static inline U64 getNanoseconds( void )
+    {
+        return (U64)std::chrono::duration_cast<std::chrono::nanoseconds>( typeClock::now().time_since_epoch() ).count();
+    }
+};
+
+#endif // _PLATFORM_TIMER_H_
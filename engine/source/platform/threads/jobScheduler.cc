@@ -0,0 +1,313 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/jobScheduler.h"
+#include "platform/platformAssert.h"
+#include "math/mMathFn.h"
+
+#include <thread>
+
+//------------------------------------------------------------------------------
+
+JobScheduler* JobScheduler::Instance = NULL;
+
+// Participant index of the current thread.
+static thread_local U32 sCurrentParticipantIndex = 0;
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::Init( void )
+{
+#if defined(TORQUE_OS_EMSCRIPTEN)
+    // No threading available so all jobs run on the main thread.
+    const U32 workerCount = 0;
+    const U32 backgroundThreadCount = 0;
+#else
+    // Use all available hardware threads except the main thread.
+    const U32 hardwareThreads = (U32)std::thread::hardware_concurrency();
+    const U32 workerCount = hardwareThreads > 1 ? getMin( hardwareThreads - 1, (U32)MAX_WORKER_THREADS ) : 0;
+
+    // Background jobs are mostly waiting on I/O so a quarter of the hardware threads is plenty.
+    const U32 backgroundThreadCount = hardwareThreads > 1 ? getMin( getMax( hardwareThreads / 4, (U32)1 ), (U32)MAX_BACKGROUND_THREADS ) : 0;
+#endif
+
+    // Create the job scheduler.
+    Instance = new JobScheduler( workerCount, backgroundThreadCount );
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::destroy( void )
+{
+    // Delete the job scheduler.
+    delete Instance;
+    Instance = NULL;
+}
+
+//------------------------------------------------------------------------------
+
+JobScheduler::JobScheduler( const U32 workerCount, const U32 backgroundThreadCount ) :
+    mWorkerCount( getMin( workerCount, (U32)MAX_WORKER_THREADS ) ),
+    mpJobCallback( NULL ),
+    mpJobContext( NULL ),
+    mJobItemCount( 0 ),
+    mJobChunkSize( 0 ),
+    mJobParticipantCount( 0 ),
+    mActiveWorkers( 0 ),
+    mJobCompleteSemaphore( 0 ),
+    mJobRunning( false ),
+    mShutdown( false ),
+    mBackgroundThreadCount( getMin( backgroundThreadCount, (U32)MAX_BACKGROUND_THREADS ) ),
+    mBackgroundJobSemaphore( 0 )
+{
+    // Reset the chunk runs.
+    for ( U32 n = 0; n < MAX_PARTICIPANTS; ++n )
+    {
+        mChunkRuns[n].mNextChunk.store( 0 );
+        mChunkRuns[n].mEndChunk = 0;
+    }
+
+    // Start the workers.
+    // NOTE:    The main thread is always participant zero.
+    for ( U32 n = 0; n < mWorkerCount; ++n )
+    {
+        Worker& worker = mWorkers[n];
+        worker.mpScheduler = this;
+        worker.mParticipantIndex = n + 1;
+        worker.mpThread = new Thread( &JobScheduler::workerThreadFunction, &worker, true );
+    }
+
+    // Start the background threads.
+    for ( U32 n = 0; n < mBackgroundThreadCount; ++n )
+        mBackgroundThreads[n] = new Thread( &JobScheduler::backgroundThreadFunction, this, true );
+}
+
+//------------------------------------------------------------------------------
+
+JobScheduler::~JobScheduler()
+{
+    // Sanity!
+    AssertFatal( !mJobRunning.load(), "JobScheduler::~JobScheduler() - Cannot destroy the scheduler whilst a job is running." );
+
+    // Flag shutdown.
+    mShutdown = true;
+
+    // Wake all the workers so they can exit.
+    for ( U32 n = 0; n < mWorkerCount; ++n )
+        mWorkers[n].mWakeSemaphore.release();
+
+    // Wait for the workers to exit.
+    for ( U32 n = 0; n < mWorkerCount; ++n )
+    {
+        delete mWorkers[n].mpThread;
+        mWorkers[n].mpThread = NULL;
+    }
+
+    // Wake all the background threads so they can exit.
+    // NOTE:    Any background jobs still queued are executed before the threads exit.
+    for ( U32 n = 0; n < mBackgroundThreadCount; ++n )
+        mBackgroundJobSemaphore.release();
+
+    // Wait for the background threads to exit.
+    for ( U32 n = 0; n < mBackgroundThreadCount; ++n )
+    {
+        delete mBackgroundThreads[n];
+        mBackgroundThreads[n] = NULL;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::parallelFor( const U32 itemCount, const U32 chunkSize, JobCallback callback, void* pJobContext )
+{
+    // Sanity!
+    AssertFatal( callback != NULL, "JobScheduler::parallelFor() - Invalid job callback." );
+
+    // Finish if nothing to do.
+    if ( itemCount == 0 )
+        return;
+
+    // Calculate the chunk count.
+    const U32 validChunkSize = getMax( chunkSize, (U32)1 );
+    const U32 chunkCount = (itemCount + validChunkSize - 1) / validChunkSize;
+
+    // Run serially if there are no workers, a single chunk or we're already running a job.
+    if ( mWorkerCount == 0 || chunkCount < 2 || mJobRunning.load( std::memory_order_acquire ) )
+    {
+        callback( pJobContext, 0, itemCount );
+        return;
+    }
+
+    // Calculate participants.
+    const U32 participantCount = getMin( mWorkerCount + 1, chunkCount );
+
+    // Assign an even run of chunks to each participant.
+    for ( U32 participant = 0; participant < participantCount; ++participant )
+    {
+        ChunkRun& chunkRun = mChunkRuns[participant];
+        chunkRun.mNextChunk.store( (chunkCount * participant) / participantCount, std::memory_order_relaxed );
+        chunkRun.mEndChunk = (chunkCount * (participant + 1)) / participantCount;
+    }
+
+    // Set the job.
+    mpJobCallback = callback;
+    mpJobContext = pJobContext;
+    mJobItemCount = itemCount;
+    mJobChunkSize = validChunkSize;
+    mJobParticipantCount = participantCount;
+    mJobRunning.store( true, std::memory_order_release );
+    mActiveWorkers.store( participantCount - 1 );
+
+    // Wake the participating workers.
+    for ( U32 n = 0; n < participantCount - 1; ++n )
+        mWorkers[n].mWakeSemaphore.release();
+
+    // Participate on this thread.
+    executeChunks( 0 );
+
+    // Wait for the workers to finish.
+    mJobCompleteSemaphore.acquire();
+
+    // Flag job as finished.
+    mJobRunning.store( false, std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::queueBackgroundJob( BackgroundJobCallback callback, void* pJobContext )
+{
+    // Sanity!
+    AssertFatal( callback != NULL, "JobScheduler::queueBackgroundJob() - Invalid job callback." );
+
+    // Run immediately if there are no background threads.
+    if ( mBackgroundThreadCount == 0 )
+    {
+        callback( pJobContext );
+        return;
+    }
+
+    // Queue the job.
+    BackgroundJob job;
+    job.mpCallback = callback;
+    job.mpJobContext = pJobContext;
+
+    mBackgroundJobMutex.lock();
+    mBackgroundJobs.push_back( job );
+    mBackgroundJobMutex.unlock();
+
+    // Wake a background thread.
+    mBackgroundJobSemaphore.release();
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::executeChunks( const U32 participantIndex )
+{
+    // Start with our own run then steal from the other participants.
+    for ( U32 offset = 0; offset < mJobParticipantCount; ++offset )
+    {
+        ChunkRun& chunkRun = mChunkRuns[(participantIndex + offset) % mJobParticipantCount];
+
+        while( true )
+        {
+            // Claim the next chunk in the run.
+            const U32 chunk = chunkRun.mNextChunk.fetch_add( 1 );
+
+            // Finish with this run if it's exhausted.
+            if ( chunk >= chunkRun.mEndChunk )
+                break;
+
+            // Execute the chunk.
+            const U32 startIndex = chunk * mJobChunkSize;
+            const U32 endIndex = getMin( startIndex + mJobChunkSize, mJobItemCount );
+            mpJobCallback( mpJobContext, startIndex, endIndex );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+U32 JobScheduler::getCurrentParticipantIndex( void )
+{
+    return sCurrentParticipantIndex;
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::workerThreadFunction( void* pWorkerData )
+{
+    Worker* pWorker = static_cast<Worker*>( pWorkerData );
+    JobScheduler* pScheduler = pWorker->mpScheduler;
+
+    // Note the participant index of this thread.
+    sCurrentParticipantIndex = pWorker->mParticipantIndex;
+
+    while( true )
+    {
+        // Wait for a job.
+        pWorker->mWakeSemaphore.acquire();
+
+        // Finish if shutting down.
+        if ( pScheduler->mShutdown )
+            return;
+
+        // Execute chunks.
+        pScheduler->executeChunks( pWorker->mParticipantIndex );
+
+        // Signal the job as complete if we're the last worker out.
+        if ( pScheduler->mActiveWorkers.fetch_sub( 1 ) == 1 )
+            pScheduler->mJobCompleteSemaphore.release();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void JobScheduler::backgroundThreadFunction( void* pSchedulerData )
+{
+    JobScheduler* pScheduler = static_cast<JobScheduler*>( pSchedulerData );
+
+    // Background threads are never the main thread nor a job participant.
+    sCurrentParticipantIndex = BACKGROUND_PARTICIPANT_INDEX;
+
+    while( true )
+    {
+        // Wait for a job.
+        pScheduler->mBackgroundJobSemaphore.acquire();
+
+        // Take the oldest job.
+        pScheduler->mBackgroundJobMutex.lock();
+
+        // Finish if there's no job as we've been woken to shut down.
+        if ( pScheduler->mBackgroundJobs.size() == 0 )
+        {
+            pScheduler->mBackgroundJobMutex.unlock();
+            return;
+        }
+
+        const BackgroundJob job = pScheduler->mBackgroundJobs.front();
+        pScheduler->mBackgroundJobs.pop_front();
+        pScheduler->mBackgroundJobMutex.unlock();
+
+        // Execute the job.
+        job.mpCallback( job.mpJobContext );
+    }
+}
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#define _PLATFORM_THREADS_JOBSCHEDULER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+
+/// The job scheduler owns a fixed pool of worker threads and executes data-parallel
+/// jobs across them.  A job is a range of items split into fixed-size chunks.  Each
+/// participant (the workers plus the calling thread) is handed a contiguous run of
+/// chunks and, once its own run is exhausted, steals chunks from the front of the
+/// other participants' runs until no work remains.
+///
+/// Jobs are always issued from the main thread and the call blocks until every chunk
+/// has been executed.  If there are no workers available (or a job is issued whilst
+/// another is running) then the job is simply executed serially on the calling thread.
+///
+/// Background jobs are single callbacks that run asynchronously on a separate, smaller
+/// pool of threads so that long-running work never holds up a data-parallel job.  The
+/// caller is responsible for tracking completion, typically with an atomic flag.
+class JobScheduler
+{
+public:
+    /// Job callback, executed for items in the range [startIndex, endIndex).
+    typedef void (*JobCallback)( void* pJobContext, const U32 startIndex, const U32 endIndex );
+
+    /// Background job callback.
+    typedef void (*BackgroundJobCallback)( void* pJobContext );
+
+    enum
+    {
+        MAX_WORKER_THREADS = 15,
+        MAX_PARTICIPANTS = MAX_WORKER_THREADS + 1,
+        MAX_BACKGROUND_THREADS = 4,
+
+        /// Participant index reported on the background threads.
+        BACKGROUND_PARTICIPANT_INDEX = MAX_PARTICIPANTS,
+    };
+
+private:
+    /// A run of chunks assigned to a single participant.
+    struct ChunkRun
+    {
+        std::atomic<U32>    mNextChunk;
+        U32                 mEndChunk;
+        U8                  mPadding[64 - sizeof(std::atomic<U32>) - sizeof(U32)];
+    };
+
+    /// Per-worker state.
+    struct Worker
+    {
+        JobScheduler*       mpScheduler;
+        U32                 mParticipantIndex;
+        Semaphore           mWakeSemaphore;
+        Thread*             mpThread;
+
+        Worker() : mpScheduler(NULL), mParticipantIndex(0), mWakeSemaphore(0), mpThread(NULL) {}
+    };
+
+    /// Queued background job.
+    struct BackgroundJob
+    {
+        BackgroundJobCallback   mpCallback;
+        void*                   mpJobContext;
+    };
+
+    Worker                  mWorkers[MAX_WORKER_THREADS];
+    U32                     mWorkerCount;
+    ChunkRun                mChunkRuns[MAX_PARTICIPANTS];
+
+    /// Current job.
+    JobCallback             mpJobCallback;
+    void*                   mpJobContext;
+    U32                     mJobItemCount;
+    U32                     mJobChunkSize;
+    U32                     mJobParticipantCount;
+    std::atomic<U32>        mActiveWorkers;
+    Semaphore               mJobCompleteSemaphore;
+    std::atomic<bool>       mJobRunning;
+    bool                    mShutdown;
+
+    /// Background jobs.
+    Thread*                 mBackgroundThreads[MAX_BACKGROUND_THREADS];
+    U32                     mBackgroundThreadCount;
+    Vector<BackgroundJob>   mBackgroundJobs;
+    Mutex                   mBackgroundJobMutex;
+    Semaphore               mBackgroundJobSemaphore;
+
+    static void             workerThreadFunction( void* pWorker );
+    static void             backgroundThreadFunction( void* pScheduler );
+    void                    executeChunks( const U32 participantIndex );
+
+public:
+    static void Init( void );
+    static void destroy( void );
+    static JobScheduler* Instance;
+
+    JobScheduler( const U32 workerCount, const U32 backgroundThreadCount = 0 );
+    ~JobScheduler();
+
+    /// Execute the job callback over "itemCount" items in chunks of "chunkSize".
+    void                    parallelFor( const U32 itemCount, const U32 chunkSize, JobCallback callback, void* pJobContext );
+
+    /// Queue the callback to run on a background thread.
+    /// NOTE:   If there are no background threads then the callback is executed immediately on the calling thread.
+    void                    queueBackgroundJob( BackgroundJobCallback callback, void* pJobContext );
+
+    inline U32              getWorkerCount( void ) const { return mWorkerCount; }
+    inline U32              getBackgroundThreadCount( void ) const { return mBackgroundThreadCount; }
+    inline bool             isJobRunning( void ) const { return mJobRunning.load( std::memory_order_acquire ); }
+
+    /// Gets the participant index of the calling thread.
+    /// NOTE:   The main thread is always participant zero and workers are numbered from one so
+    ///         this can be used to select per-participant storage from within a job callback.
+    static U32              getCurrentParticipantIndex( void );
+};
+
+#endif // _PLATFORM_THREADS_JOBSCHEDULER_H_
@@ -402,6 +402,17 @@ U32 File::getSize() const
 
 //-----------------------------------------------------------------------------
 
+S32 File::getDescriptor() const
+{
+    // Only an open file has a descriptor.
+    if ( handle == NULL || (Ok != currentStatus && EOS != currentStatus) )
+        return -1;
+    
+    return fileno((FILE*)handle);
+}
+
+//-----------------------------------------------------------------------------
+
 File::Status File::flush()
 {
     // Before proceeding, make sure the file is open, the handle is valid, and the file can
@@ -619,6 +619,17 @@ bool dPathCopy(const char *fromName, const char *toName, bool nooverwrite)
          return 0;                                               // unsuccessful
  }
  
+ //-----------------------------------------------------------------------------
+ // Get the descriptor of the open file so it can be mapped.
+ //-----------------------------------------------------------------------------
+ S32 File::getDescriptor() const
+ {
+     if (NULL == handle || (Ok != currentStatus && EOS != currentStatus))
+         return -1;
+
+     return *((int *)handle);
+ }
+
  //-----------------------------------------------------------------------------
  // Flush the file.
  // It is an error to flush a read-only file.
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "console/console.h"
+#include "platform/types.h"
+#include "graphics/glRecorder.h"
+
+#include "platformX86UNIX/platformX86UNIX.h"
+#include "platformX86UNIX/x86UNIXNullVideo.h"
+#include "platformX86UNIX/x86UNIXState.h"
+
+//------------------------------------------------------------------------------
+NullDevice::NullDevice()
+{
+   initDevice();
+}
+
+//------------------------------------------------------------------------------
+NullDevice::~NullDevice()
+{
+}
+
+//------------------------------------------------------------------------------
+void NullDevice::initDevice()
+{
+   // Registered under the OpenGL name so that the existing device selection
+   // (and "$pref::Video::displayDevice") keeps working unchanged.
+   mDeviceName = "OpenGL";
+   mFullScreenOnly = false;
+
+   mResolutionList.clear();
+   mResolutionList.push_back(Resolution(640, 480, 32));
+   mResolutionList.push_back(Resolution(800, 600, 32));
+   mResolutionList.push_back(Resolution(1024, 768, 32));
+   mResolutionList.push_back(Resolution(1280, 1024, 32));
+   mResolutionList.push_back(Resolution(1920, 1080, 32));
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::activate( U32 width, U32 height, U32 bpp, bool fullScreen )
+{
+   if ( !GLRecorder::isInstalled() )
+   {
+      Con::errorf( "NullDevice::activate() - The GL recorder is not installed." );
+      return false;
+   }
+
+   if (!setScreenMode(width, height, bpp, fullScreen))
+   {
+      Con::printf("Unable to set screen mode.");
+      return false;
+   }
+
+   Con::printf( "Null GL device activated." );
+   Con::setVariable( "$pref::Video::displayDevice", mDeviceName );
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+void NullDevice::shutdown()
+{
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::setScreenMode( U32 width, U32 height, U32 bpp,
+   bool fullScreen, bool forceIt, bool repaint )
+{
+   if (height == 0 || width == 0)
+   {
+      width = 800;
+      height = 600;
+   }
+
+   if (bpp == 0)
+      bpp = 32;
+
+   Con::printf( "Setting null screen mode to %dx%dx%d...", width, height, bpp );
+
+   // There is no window so the display is never full-screen.
+   smCurrentRes = Resolution( width, height, bpp );
+   smIsFullScreen = false;
+   Platform::setWindowSize( width, height );
+   Con::setBoolVariable( "$pref::Video::fullScreen", smIsFullScreen );
+   char tempBuf[15];
+   dSprintf( tempBuf, sizeof( tempBuf ), "%d %d %d",
+      smCurrentRes.w, smCurrentRes.h, smCurrentRes.bpp );
+   Con::setVariable( "$pref::Video::resolution", tempBuf );
+
+   if ( repaint )
+      Video::resetCanvas();
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+void NullDevice::swapBuffers()
+{
+}
+
+//------------------------------------------------------------------------------
+const char* NullDevice::getDriverInfo()
+{
+   return "Torque\tGL Recorder\t1.1\t";
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::getGammaCorrection(F32 &g)
+{
+   g = 1.0f;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::setGammaCorrection(F32 g)
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::getVerticalSync()
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+bool NullDevice::setVerticalSync( bool on )
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+DisplayDevice* NullDevice::create()
+{
+   return new NullDevice();
+}
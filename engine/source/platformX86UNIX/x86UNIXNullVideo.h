@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _X86UNIXNULLVIDEO_H_
+#define _X86UNIXNULLVIDEO_H_
+
+#ifndef _PLATFORMVIDEO_H_
+#include "platform/platformVideo.h"
+#endif
+
+// Display device used when running with "-nullgl".  It never opens a window;
+// all rendering goes through the GL recorder which must be installed first.
+class NullDevice : public DisplayDevice
+{
+   public:
+      NullDevice();
+      virtual ~NullDevice();
+
+      virtual void initDevice();
+      bool activate( U32 width, U32 height, U32 bpp, bool fullScreen );
+      void shutdown();
+      bool setScreenMode( U32 width, U32 height, U32 bpp, bool fullScreen, bool forceIt = false, bool repaint = true );
+      void swapBuffers();
+      const char* getDriverInfo();
+      bool getGammaCorrection(F32 &g);
+      bool setGammaCorrection(F32 g);
+      bool getVerticalSync();
+      bool setVerticalSync( bool on );
+
+      static DisplayDevice* create();
+};
+
+#endif // _X86UNIXNULLVIDEO_H_
@@ -68,6 +68,8 @@ static void SignalHandler(int sigtype)
    {
       signal(SIGSEGV, SIG_DFL);
       signal(SIGTRAP, SIG_DFL);
+      // write what we can of the log without waiting on the writer
+      Con::flushLog(false);
       // restore the signal handling to default so that we don't get into 
       // a crash loop with ImmediateShutdown
       ImmediateShutdown(-sigtype, sigtype);
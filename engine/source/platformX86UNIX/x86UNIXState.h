@@ -60,6 +60,7 @@ class x86UNIXPlatformState
       bool                 mDedicated;
       bool                 mDSleep;
       bool                 mUseRedirect;
+      bool                 mNullGraphics;
 
       // Access to the display* needs to be controlled because the SDL event
       // loop runs in a separate thread.  If you need the display pointer,
@@ -147,6 +148,9 @@ class x86UNIXPlatformState
 
       bool getUseRedirect() { return mUseRedirect; }
       void setUseRedirect(bool enabled) { mUseRedirect = enabled; }
+
+      bool isNullGraphics() { return mNullGraphics; }
+      void setNullGraphics(bool enabled) { mNullGraphics = enabled; }
       
       x86UNIXPlatformState()
       {
@@ -160,6 +164,7 @@ class x86UNIXPlatformState
          mXWindowsRunning = false;
          mDedicated = false;
          mDSleep = false;
+         mNullGraphics = false;
 #ifdef USE_FILE_REDIRECT
          mUseRedirect = true;
 #else
@@ -34,8 +34,10 @@
 #include "platform/platformInput.h"
 #include "platform/platformVideo.h"
 #include "debug/profiler.h"
+#include "graphics/glRecorder.h"
 #include "platformX86UNIX/platformGL.h"
 #include "platformX86UNIX/x86UNIXOGLVideo.h"
+#include "platformX86UNIX/x86UNIXNullVideo.h"
 #include "platformX86UNIX/x86UNIXState.h"
 
 #ifndef DEDICATED
@@ -97,6 +99,12 @@ static S32 ParseCommandLine(S32 argc, const char **argv,
          x86UNIXState->setDSleep(true);
          continue;
       }
+      if (dStrcmp(argv[i], "-nullgl") == 0)
+      {
+         // render through the GL recorder without a window or GPU
+         x86UNIXState->setNullGraphics(true);
+         continue;
+      }
       if (dStrcmp(argv[i], "-nohomedir") == 0)
       {
          x86UNIXState->setUseRedirect(false);
@@ -682,8 +690,25 @@ void Platform::init()
    StdConsole::create();
    
 #ifndef DEDICATED
+   // if we're running headless, record GL calls instead of opening a window
+   if (!x86UNIXState->isDedicated() && x86UNIXState->isNullGraphics())
+   {
+      Con::printf( "Video Init:" );
+
+      if (!GLRecorder::install())
+      {
+         DisplayErrorAlert("Unable to install the GL recorder.");
+         ImmediateShutdown(1);
+      }
+
+      Video::init();
+      if ( Video::installDevice( NullDevice::create() ) )
+         Con::printf( "   Null GL display device installed." );
+
+      Con::printf(" ");
+   }
    // if we're not dedicated do more initialization
-   if (!x86UNIXState->isDedicated())
+   else if (!x86UNIXState->isDedicated())
    {
       // init SDL
       if (!InitSDL())
@@ -748,8 +773,9 @@ void Platform::init()
 void Platform::initWindow(const Point2I &initialSize, const char *name)
 {
 #ifndef DEDICATED
-   // initialize window
-   InitWindow(initialSize, name);
+   // initialize window (there is none when running headless)
+   if (!x86UNIXState->isNullGraphics())
+      InitWindow(initialSize, name);
    if (!InitOpenGL())
       ImmediateShutdown(1);
 #endif
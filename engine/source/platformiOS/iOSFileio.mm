@@ -255,6 +255,17 @@ U32 File::getSize() const
    return 0;
 }
 
+//-----------------------------------------------------------------------------
+// Get the descriptor of the open file so it can be mapped.
+//-----------------------------------------------------------------------------
+S32 File::getDescriptor() const
+{
+   if (handle == NULL || (Ok != currentStatus && EOS != currentStatus))
+      return -1;
+   
+   return fileno((FILE*)handle);
+}
+
 //-----------------------------------------------------------------------------
 // Flush the file.
 // It is an error to flush a read-only file.
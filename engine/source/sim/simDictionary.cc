@@ -25,95 +25,356 @@
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
-extern U32 HashPointer(StringTableEntry e);
 
-SimNameDictionary::SimNameDictionary()
+namespace
 {
-   hashTable = NULL;
-   mutex = Mutex::createMutex();
+   // Each thread's read scope state.  The epoch is zero outside a read scope.
+   struct EpochRecord
+   {
+      std::atomic<U64>  mEpoch;
+      std::atomic<bool> mInUse;
+      U32               mDepth;
+      EpochRecord*      mNext;
+
+      // Keep each record on its own cache line.
+      U8                mPadding[64];
+   };
+
+   // Returns the thread's record to the pool when the thread exits.
+   struct EpochRecordOwner
+   {
+      EpochRecord* mpRecord;
+
+      EpochRecordOwner() : mpRecord(NULL) {}
+      ~EpochRecordOwner()
+      {
+         if(mpRecord)
+            mpRecord->mInUse.store(false, std::memory_order_release);
+      }
+   };
 }
 
-SimNameDictionary::~SimNameDictionary()
+static std::atomic<U64> sGlobalEpoch(1);
+static std::atomic<EpochRecord*> sEpochRecords(NULL);
+static thread_local EpochRecordOwner sThreadEpochRecord;
+
+static EpochRecord* getThreadEpochRecord(void)
 {
-   delete[] hashTable;
-   Mutex::destroyMutex(mutex);
+   EpochRecord* pRecord = sThreadEpochRecord.mpRecord;
+   if(pRecord)
+      return pRecord;
+
+   // Reuse a record left by a thread that has exited.
+   for(pRecord = sEpochRecords.load(std::memory_order_acquire); pRecord; pRecord = pRecord->mNext)
+   {
+      bool inUse = false;
+      if(!pRecord->mInUse.load(std::memory_order_relaxed) && pRecord->mInUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+         break;
+   }
+
+   // Records are never freed so that a writer can always walk the list.
+   if(!pRecord)
+   {
+      pRecord = new EpochRecord;
+      pRecord->mEpoch.store(0, std::memory_order_relaxed);
+      pRecord->mInUse.store(true, std::memory_order_relaxed);
+      pRecord->mNext = sEpochRecords.load(std::memory_order_relaxed);
+      while(!sEpochRecords.compare_exchange_weak(pRecord->mNext, pRecord, std::memory_order_release, std::memory_order_relaxed))
+         ;
+   }
+
+   pRecord->mDepth = 0;
+   sThreadEpochRecord.mpRecord = pRecord;
+   return pRecord;
 }
 
-void SimNameDictionary::insert(SimObject* obj)
+void SimDictionaryEpoch::enter(void)
 {
-   if(!obj->objectName)
+   EpochRecord* pRecord = getThreadEpochRecord();
+   if(pRecord->mDepth++ > 0)
       return;
 
-   Mutex::lockMutex(mutex);
-   
-   if(!hashTable)
+   // The record must be visible before anything in a dictionary is read.
+   pRecord->mEpoch.store(sGlobalEpoch.load());
+   std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void SimDictionaryEpoch::leave(void)
+{
+   EpochRecord* pRecord = sThreadEpochRecord.mpRecord;
+   AssertFatal(pRecord && pRecord->mDepth > 0, "SimDictionaryEpoch::leave - Not inside a read scope!");
+
+   if(--pRecord->mDepth == 0)
+      pRecord->mEpoch.store(0, std::memory_order_release);
+}
+
+U64 SimDictionaryEpoch::advance(void)
+{
+   return sGlobalEpoch.fetch_add(1);
+}
+
+bool SimDictionaryEpoch::isReclaimable(const U64 epoch)
+{
+   // The calling thread cannot be holding anything it is unlinking itself.
+   const EpochRecord* pThreadRecord = sThreadEpochRecord.mpRecord;
+
+   for(EpochRecord* pRecord = sEpochRecords.load(std::memory_order_acquire); pRecord; pRecord = pRecord->mNext)
+   {
+      if(pRecord == pThreadRecord)
+         continue;
+
+      const U64 recordEpoch = pRecord->mEpoch.load();
+      if(recordEpoch != 0 && recordEpoch <= epoch)
+         return false;
+   }
+
+   return true;
+}
+
+void SimDictionaryEpoch::synchronize(void)
+{
+   const U64 epoch = advance();
+   while(!isReclaimable(epoch))
+      Platform::sleep(0);
+}
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+// Marks a name slot whose object was removed so that probing continues past it.
+static const StringTableEntry TombstoneName = (StringTableEntry)1;
+
+SimNameTable::SimNameTable() :
+   mTable(NULL),
+   mEntryCount(0),
+   mTombstoneCount(0)
+{
+}
+
+SimNameTable::~SimNameTable()
+{
+   Table* pTable = mTable.load(std::memory_order_relaxed);
+   if(pTable)
+      destroyTable(pTable);
+
+   for(S32 i = 0; i < mRetiredTables.size(); i++)
+      destroyTable(mRetiredTables[i].mTable);
+}
+
+SimNameTable::Table* SimNameTable::createTable(const U32 size)
+{
+   Table* pTable = new Table;
+   pTable->mSize = size;
+   pTable->mSlots = new Slot[size];
+   for(U32 i = 0; i < size; i++)
+      pTable->mSlots[i].reset();
+   return pTable;
+}
+
+void SimNameTable::destroyTable(Table* pTable)
+{
+   delete[] pTable->mSlots;
+   delete pTable;
+}
+
+void SimNameTable::releaseRetiredTables(void)
+{
+   // Tables are retired in epoch order.
+   S32 releaseCount = 0;
+   while(releaseCount < mRetiredTables.size() && SimDictionaryEpoch::isReclaimable(mRetiredTables[releaseCount].mEpoch))
+      destroyTable(mRetiredTables[releaseCount++].mTable);
+
+   for(S32 i = 0; i < releaseCount; i++)
+      mRetiredTables.erase(U32(0));
+}
+
+void SimNameTable::rebuild(const U32 size)
+{
+   Table* pOldTable = mTable.load(std::memory_order_relaxed);
+   Table* pNewTable = createTable(size);
+   const U32 oldMask = pOldTable->mSize - 1;
+   const U32 newMask = size - 1;
+
+   // Start just after an empty slot so that each cluster is copied in probe
+   // order, which keeps objects sharing a name newest-first.
+   U32 start = 0;
+   while(pOldTable->mSlots[start].getKey() != NULL)
+      start++;
+
+   for(U32 i = 1; i <= pOldTable->mSize; i++)
+   {
+      const Slot& oldSlot = pOldTable->mSlots[(start + i) & oldMask];
+      StringTableEntry name = oldSlot.getKey();
+      if(name == NULL || name == TombstoneName)
+         continue;
+
+      U32 index = hashName(name, size);
+      while(pNewTable->mSlots[index].getKey() != NULL)
+         index = (index + 1) & newMask;
+      pNewTable->mSlots[index].write(name, oldSlot.getObject());
+   }
+
+   mTable.store(pNewTable);
+   mTombstoneCount = 0;
+
+   // Readers that may still be probing the old table entered no later than this epoch.
+   RetiredTable retiredTable;
+   retiredTable.mTable = pOldTable;
+   retiredTable.mEpoch = SimDictionaryEpoch::advance();
+   mRetiredTables.push_back(retiredTable);
+   releaseRetiredTables();
+}
+
+void SimNameTable::insert(StringTableEntry name, SimObject* obj)
+{
+   Table* pTable = mTable.load(std::memory_order_relaxed);
+   if(!pTable)
+   {
+      pTable = createTable(DefaultTableSize);
+      mTable.store(pTable);
+   }
+   else if((mEntryCount + mTombstoneCount + 1) * 4 > pTable->mSize * 3)
+   {
+      // Grow when live entries alone would fill more than half of the table,
+      // otherwise just sweep the tombstones out.
+      U32 size = pTable->mSize;
+      while((mEntryCount + 1) * 2 > size)
+         size *= 2;
+
+      rebuild(size);
+      pTable = mTable.load(std::memory_order_relaxed);
+   }
+   else
    {
-      hashTable = new SimObject *[DefaultTableSize];
-      hashTableSize = DefaultTableSize;
-      hashEntryCount = 0;
-      S32 i;
-      for(i = 0; i < hashTableSize; i++)
-         hashTable[i] = NULL;
+      releaseRetiredTables();
    }
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
+
+   const U32 mask = pTable->mSize - 1;
+   U32 index = hashName(name, pTable->mSize);
+
+   // An object with the same name is pushed further along the probe so that
+   // the newest object is found first.
+   SimObject* pCarry = obj;
+   for(;;)
    {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
+      Slot& slot = pTable->mSlots[index];
+      StringTableEntry slotName = slot.getKey();
+      if(slotName == NULL || slotName == TombstoneName)
+      {
+         if(slotName == TombstoneName)
+            mTombstoneCount--;
+
+         slot.write(name, pCarry);
+         break;
+      }
+
+      AssertFatal(slot.getObject() != obj, "SimNameTable::insert - Object is already in the table!");
+
+      if(slotName == name)
+      {
+         SimObject* pSlotObject = slot.getObject();
+         slot.write(name, pCarry);
+         pCarry = pSlotObject;
+      }
+
+      index = (index + 1) & mask;
+   }
+
+   mEntryCount++;
+}
+
+bool SimNameTable::remove(StringTableEntry name, SimObject* obj)
+{
+   Table* pTable = mTable.load(std::memory_order_relaxed);
+   if(!pTable)
+      return false;
+
+   const U32 mask = pTable->mSize - 1;
+   U32 index = hashName(name, pTable->mSize);
+
+   for(;;)
+   {
+      Slot& slot = pTable->mSlots[index];
+      StringTableEntry slotName = slot.getKey();
+      if(slotName == NULL)
+         return false;
+
+      if(slotName == name && slot.getObject() == obj)
+      {
+         // The end of a cluster can simply be emptied.
+         if(pTable->mSlots[(index + 1) & mask].getKey() == NULL)
          {
-            temp = walk->nextNameObject;
-            walk->nextNameObject = head;
-            head = walk;
-            walk = temp;
+            slot.write(NULL, NULL);
          }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
-      {
-         temp = head->nextNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
+         else
+         {
+            slot.write(TombstoneName, NULL);
+            mTombstoneCount++;
+         }
+
+         mEntryCount--;
+         return true;
       }
+
+      index = (index + 1) & mask;
    }
-   Mutex::unlockMutex(mutex);
 }
 
-SimObject* SimNameDictionary::find(StringTableEntry name)
+SimObject* SimNameTable::find(StringTableEntry name)
 {
    // NULL is a valid lookup - it will always return NULL
-   if(!hashTable)
+   if(!name || mTable.load(std::memory_order_relaxed) == NULL)
       return NULL;
-      
-   Mutex::lockMutex(mutex);
 
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
+   SimDictionaryEpoch::ReadScope readScope;
+
+   Table* pTable = mTable.load();
+   const U32 mask = pTable->mSize - 1;
+   U32 index = hashName(name, pTable->mSize);
+
+   for(;;)
    {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextNameObject;
+      StringTableEntry slotName;
+      SimObject* slotObject;
+      pTable->mSlots[index].read(slotName, slotObject);
+      if(slotName == NULL)
+         return NULL;
+
+      if(slotName == name)
+         return slotObject;
+
+      index = (index + 1) & mask;
    }
+}
+
+//----------------------------------------------------------------------------
+
+SimNameDictionary::SimNameDictionary()
+{
+   mutex = Mutex::createMutex();
+}
+
+SimNameDictionary::~SimNameDictionary()
+{
+   Mutex::destroyMutex(mutex);
+}
+
+void SimNameDictionary::insert(SimObject* obj)
+{
+   if(!obj->objectName)
+      return;
+
+   Mutex::lockMutex(mutex);
+
+   nameTable.insert(obj->objectName, obj);
+   obj->nextNameObject = NULL;
 
    Mutex::unlockMutex(mutex);
-   return NULL;
+}
+
+SimObject* SimNameDictionary::find(StringTableEntry name)
+{
+   return nameTable.find(name);
 }
 
 void SimNameDictionary::remove(SimObject* obj)
@@ -123,40 +384,26 @@ void SimNameDictionary::remove(SimObject* obj)
 
    Mutex::lockMutex(mutex);
 
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
-   {
-      if(*walk == obj)
-      {
-         *walk = obj->nextNameObject;
-			obj->nextNameObject = (SimObject*)-1;
-         hashEntryCount--;
-
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextNameObject);
-   }
+   const bool removed = nameTable.remove(obj->objectName, obj);
+   if(removed)
+      obj->nextNameObject = (SimObject*)-1;
 
    Mutex::unlockMutex(mutex);
-}	
+
+   // Don't let the object go until no lookup can still be using it.
+   if(removed)
+      SimDictionaryEpoch::synchronize();
+}
 
 //----------------------------------------------------------------------------
 
 SimManagerNameDictionary::SimManagerNameDictionary()
 {
-   hashTable = new SimObject *[DefaultTableSize];
-   hashTableSize = DefaultTableSize;
-   hashEntryCount = 0;
-   S32 i;
-   for(i = 0; i < hashTableSize; i++)
-      hashTable[i] = NULL;
    mutex = Mutex::createMutex();
 }
 
 SimManagerNameDictionary::~SimManagerNameDictionary()
 {
-   delete[] hashTable;
    Mutex::destroyMutex(mutex);
 }
 
@@ -167,64 +414,15 @@ void SimManagerNameDictionary::insert(SimObject* obj)
 
    Mutex::lockMutex(mutex);
 
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextManagerNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
-   {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
-         {
-            temp = walk->nextManagerNameObject;
-            walk->nextManagerNameObject = head;
-            head = walk;
-            walk = temp;
-         }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
-      {
-         temp = head->nextManagerNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextManagerNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
-      }
-   }
-   
+   nameTable.insert(obj->objectName, obj);
+   obj->nextManagerNameObject = NULL;
+
    Mutex::unlockMutex(mutex);
 }
 
 SimObject* SimManagerNameDictionary::find(StringTableEntry name)
 {
-   // NULL is a valid lookup - it will always return NULL
-
-   Mutex::lockMutex(mutex);
-
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
-   {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextManagerNameObject;
-   }
-
-   Mutex::unlockMutex(mutex);
-   return NULL;
+   return nameTable.find(name);
 }
 
 void SimManagerNameDictionary::remove(SimObject* obj)
@@ -234,85 +432,206 @@ void SimManagerNameDictionary::remove(SimObject* obj)
 
    Mutex::lockMutex(mutex);
 
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
-   {
-      if(*walk == obj)
-      {
-         *walk = obj->nextManagerNameObject;
-			obj->nextManagerNameObject = (SimObject*)-1;
-         hashEntryCount--;
-
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextManagerNameObject);
-   }
+   const bool removed = nameTable.remove(obj->objectName, obj);
+   if(removed)
+      obj->nextManagerNameObject = (SimObject*)-1;
 
    Mutex::unlockMutex(mutex);
-}	
+
+   // Don't let the object go until no lookup can still be using it.
+   if(removed)
+      SimDictionaryEpoch::synchronize();
+}
 
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
 
-SimIdDictionary::SimIdDictionary()
+SimIdDictionary::SimIdDictionary() :
+   mFreePages(NULL),
+   mOverflowCount(0)
 {
-   for(S32 i = 0; i < DefaultTableSize; i++)
-      table[i] = NULL;
+   for(S32 i = 0; i < DirectorySize; i++)
+      mDirectory[i].store(NULL, std::memory_order_relaxed);
+   for(S32 i = 0; i < OverflowTableSize; i++)
+      mOverflowTable[i] = NULL;
    mutex = Mutex::createMutex();
 }
 
 SimIdDictionary::~SimIdDictionary()
 {
+   for(S32 i = 0; i < mAllocatedPages.size(); i++)
+      delete mAllocatedPages[i];
+
    Mutex::destroyMutex(mutex);
 }
 
+void SimIdDictionary::insertOverflow(SimObject* obj)
+{
+   SimObject** bucket = &mOverflowTable[obj->getId() & OverflowTableMask];
+   obj->nextIdObject = *bucket;
+   AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
+   *bucket = obj;
+   mOverflowCount++;
+}
+
+bool SimIdDictionary::removeOverflow(SimObject* obj)
+{
+   SimObject **walk = &mOverflowTable[obj->getId() & OverflowTableMask];
+   while(*walk && *walk != obj)
+      walk = &((*walk)->nextIdObject);
+   if(!*walk)
+      return false;
+
+   *walk = obj->nextIdObject;
+   obj->nextIdObject = NULL;
+   mOverflowCount--;
+   return true;
+}
+
+SimObject* SimIdDictionary::findOverflow(const U32 id) const
+{
+   SimObject *walk = mOverflowTable[id & OverflowTableMask];
+   while(walk && walk->getId() != id)
+      walk = walk->nextIdObject;
+   return walk;
+}
+
+SimObject* SimIdDictionary::takeOverflow(const U32 id)
+{
+   if(mOverflowCount.load(std::memory_order_relaxed) == 0)
+      return NULL;
+
+   SimObject* obj = findOverflow(id);
+   if(obj)
+      removeOverflow(obj);
+   return obj;
+}
+
 void SimIdDictionary::insert(SimObject* obj)
 {
    Mutex::lockMutex(mutex);
 
-   S32 idx = obj->getId() & TableBitMask;
-   obj->nextIdObject = table[idx];
-   AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
-   table[idx] = obj;
+   const U32 id = obj->getId();
+   if(id >= (U32)MaxDenseId)
+   {
+      insertOverflow(obj);
+      Mutex::unlockMutex(mutex);
+      return;
+   }
+
+   std::atomic<Page*>& directoryEntry = mDirectory[id >> PageShift];
+   Page* pPage = directoryEntry.load(std::memory_order_relaxed);
+   if(!pPage)
+   {
+      if(mFreePages)
+      {
+         // Recycled pages have already been emptied.
+         pPage = mFreePages;
+         mFreePages = pPage->mNextFree;
+      }
+      else
+      {
+         pPage = new Page;
+         for(S32 i = 0; i < PageSize; i++)
+            pPage->mSlots[i].reset();
+         mAllocatedPages.push_back(pPage);
+      }
+
+      pPage->mLiveCount = 0;
+      pPage->mNextFree = NULL;
+      directoryEntry.store(pPage, std::memory_order_release);
+   }
+
+   Slot& slot = pPage->mSlots[id & PageMask];
+   SimObject* current = slot.getObject();
+   if(current)
+   {
+      // The newest object with an id owns the slot, older ones wait in the overflow table.
+      AssertFatal( current != obj, "SimIdDictionary::insert - Object is already in the dictionary!" );
+      insertOverflow(current);
+   }
+   else
+   {
+      pPage->mLiveCount++;
+   }
+   slot.write(id, obj);
 
    Mutex::unlockMutex(mutex);
 }
 
 SimObject* SimIdDictionary::find(S32 id)
 {
-   Mutex::lockMutex(mutex);
+   const U32 objectId = U32(id);
 
-   S32 idx = id & TableBitMask;
-   SimObject *walk = table[idx];
-   while(walk)
+   if(objectId < (U32)MaxDenseId)
    {
-      if(walk->getId() == U32(id))
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextIdObject;
+      SimDictionaryEpoch::ReadScope readScope;
+
+      Page* pPage = mDirectory[objectId >> PageShift].load(std::memory_order_acquire);
+      if(!pPage)
+         return NULL;
+
+      // The page may have been recycled under us so check the id held in the slot.
+      U32 slotId;
+      SimObject* obj;
+      pPage->mSlots[objectId & PageMask].read(slotId, obj);
+      return obj && slotId == objectId ? obj : NULL;
    }
 
+   if(mOverflowCount.load(std::memory_order_relaxed) == 0)
+      return NULL;
+
+   Mutex::lockMutex(mutex);
+   SimObject* obj = findOverflow(objectId);
    Mutex::unlockMutex(mutex);
 
-   return NULL;
+   return obj;
 }
 
 void SimIdDictionary::remove(SimObject* obj)
 {
    Mutex::lockMutex(mutex);
 
-   SimObject **walk = &table[obj->getId() & TableBitMask];
-   while(*walk && *walk != obj)
-      walk = &((*walk)->nextIdObject);
-   if(*walk)
-      *walk = obj->nextIdObject;
+   const U32 id = obj->getId();
+   if(id < (U32)MaxDenseId)
+   {
+      std::atomic<Page*>& directoryEntry = mDirectory[id >> PageShift];
+      Page* pPage = directoryEntry.load(std::memory_order_relaxed);
+      if(pPage && pPage->mSlots[id & PageMask].getObject() == obj)
+      {
+         Slot& slot = pPage->mSlots[id & PageMask];
+         SimObject* pOlder = takeOverflow(id);
+         if(pOlder)
+         {
+            slot.write(id, pOlder);
+         }
+         else
+         {
+            slot.write(0, NULL);
+
+            if(--pPage->mLiveCount == 0)
+            {
+               directoryEntry.store(NULL, std::memory_order_release);
+               pPage->mNextFree = mFreePages;
+               mFreePages = pPage;
+            }
+         }
+
+         Mutex::unlockMutex(mutex);
+
+         // Don't let the object go until no lookup can still be using it.
+         SimDictionaryEpoch::synchronize();
+         return;
+      }
+   }
+
+   const bool removed = removeOverflow(obj);
 
    Mutex::unlockMutex(mutex);
+
+   if(removed)
+      SimDictionaryEpoch::synchronize();
 }
 
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
-
@@ -33,23 +33,166 @@
 #include "platform/threads/mutex.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#include <atomic>
+
 class SimObject;
 
 //----------------------------------------------------------------------------
-/// Map of names to SimObjects
+/// Epoch-based reclamation for the lock-free dictionary lookups.
 ///
-/// Provides fast lookup for name->object and
-/// for fast removal of an object given object*
-class SimNameDictionary
+/// A thread inside a read scope publishes the global epoch it saw on entry in
+/// a record of its own, so readers never write a shared cache line.  Writers
+/// advance the epoch when they unlink something and only release it once no
+/// reader that entered at or before that epoch is still inside a scope.
+///
+/// Objects removed from a dictionary are not deleted until the readers that
+/// could have found them have left, so a thread other than the main thread
+/// may use what a lookup returns for as long as it holds a ReadScope.  Don't
+/// block inside a read scope as removals wait for it.
+class SimDictionaryEpoch
+{
+public:
+   class ReadScope
+   {
+   public:
+      ReadScope() { SimDictionaryEpoch::enter(); }
+      ~ReadScope() { SimDictionaryEpoch::leave(); }
+   };
+
+   /// Read scopes nest.
+   static void enter(void);
+   static void leave(void);
+
+   /// Start a new epoch, returning the one that just ended.
+   static U64 advance(void);
+
+   /// Whether every other thread that could have seen data unlinked in an epoch has left its scope.
+   static bool isReclaimable(const U64 epoch);
+
+   /// Wait until every other thread that could have seen data unlinked before the call has left its scope.
+   static void synchronize(void);
+};
+
+//----------------------------------------------------------------------------
+/// A dictionary slot that holds its key next to its object.
+///
+/// Lookups compare the key so they never dereference an object.  The pair is
+/// published under a sequence count so a reader never sees the key of one
+/// entry with the object of another.
+template<class KeyType> struct SimDictionarySlot
+{
+   std::atomic<U32>        mSequence;
+   std::atomic<KeyType>    mKey;
+   std::atomic<SimObject*> mObject;
+
+   void reset(void)
+   {
+      mSequence.store(0, std::memory_order_relaxed);
+      mKey.store(KeyType(0), std::memory_order_relaxed);
+      mObject.store(NULL, std::memory_order_relaxed);
+   }
+
+   /// Writers must be serialised.
+   void write(KeyType key, SimObject* obj)
+   {
+      const U32 sequence = mSequence.load(std::memory_order_relaxed);
+      mSequence.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      mKey.store(key, std::memory_order_relaxed);
+      mObject.store(obj, std::memory_order_relaxed);
+      mSequence.store(sequence + 2, std::memory_order_release);
+   }
+
+   void read(KeyType& key, SimObject*& obj) const
+   {
+      for(;;)
+      {
+         const U32 sequence = mSequence.load(std::memory_order_acquire);
+         key = mKey.load(std::memory_order_relaxed);
+         obj = mObject.load(std::memory_order_relaxed);
+         std::atomic_thread_fence(std::memory_order_acquire);
+         if((sequence & 1) == 0 && mSequence.load(std::memory_order_relaxed) == sequence)
+            return;
+      }
+   }
+
+   /// Only the writer may read without the sequence check.
+   inline KeyType getKey(void) const { return mKey.load(std::memory_order_relaxed); }
+   inline SimObject* getObject(void) const { return mObject.load(std::memory_order_relaxed); }
+};
+
+//----------------------------------------------------------------------------
+/// Open-addressed table of names to SimObjects shared by the name dictionaries.
+///
+/// Lookups never lock.  Writers are serialised by the owning dictionary's
+/// mutex and publish slot changes atomically.  When the table is grown or
+/// rebuilt the old table is retired and released by the dictionary epoch.
+/// Objects with a duplicate name are kept newest-first so that a lookup
+/// always returns the most recently inserted object.
+class SimNameTable
 {
    enum
    {
-      DefaultTableSize = 29
+      DefaultTableSize = 32
+   };
+
+   typedef SimDictionarySlot<StringTableEntry> Slot;
+
+   struct Table
+   {
+      U32   mSize;
+      Slot* mSlots;
    };
 
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
+   struct RetiredTable
+   {
+      Table*   mTable;
+      U64      mEpoch;
+   };
+
+   std::atomic<Table*>  mTable;
+   U32                  mEntryCount;
+   U32                  mTombstoneCount;
+   Vector<RetiredTable> mRetiredTables;
+
+   static inline U32 hashName(StringTableEntry name, const U32 size)
+   {
+      // Fibonacci hashing spreads the string-table pointers across a power-of-two table.
+      return (U32)(((U64)(dsize_t)name * 0x9E3779B97F4A7C15ULL) >> 32) & (size - 1);
+   }
+
+   static Table* createTable(const U32 size);
+   static void destroyTable(Table* pTable);
+
+   void rebuild(const U32 size);
+   void releaseRetiredTables(void);
+
+public:
+   SimNameTable();
+   ~SimNameTable();
+
+   /// Writers must hold the owning dictionary's mutex.
+   void insert(StringTableEntry name, SimObject* obj);
+   bool remove(StringTableEntry name, SimObject* obj);
+
+   /// Safe to call from any thread without locking.
+   SimObject* find(StringTableEntry name);
+
+   inline U32 size(void) const { return mEntryCount; }
+};
+
+//----------------------------------------------------------------------------
+/// Map of names to SimObjects
+///
+/// Provides fast lookup for name->object and
+/// for fast removal of an object given object*
+class SimNameDictionary
+{
+   SimNameTable nameTable;
 
    void *mutex;
 
@@ -64,14 +207,7 @@ public:
 
 class SimManagerNameDictionary
 {
-   enum
-   {
-      DefaultTableSize = 29
-   };
-
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
+   SimNameTable nameTable;
 
    void *mutex;
 
@@ -87,19 +223,50 @@ public:
 //----------------------------------------------------------------------------
 /// Map of ID's to SimObjects.
 ///
-/// Provides fast lookup for ID->object and
-/// for fast removal of an object given object*
+/// Ids are dense and mostly allocated sequentially, so they index straight
+/// into pages of object slots.  Lookups never lock: the page directory and
+/// the slots are atomics and each slot holds the id of its object, which is
+/// compared instead of the object's own.  Writers are serialised by the mutex.
+/// Pages that empty out are recycled rather than freed so a concurrent reader
+/// never touches released memory.  Ids beyond the dense range, and an id
+/// registered twice, fall back to a chained table that is only read under the
+/// mutex.
 class SimIdDictionary
 {
    enum
    {
-      DefaultTableSize = 4096,
-      TableBitMask = 4095
+      PageShift = 12,
+      PageSize = 1 << PageShift,
+      PageMask = PageSize - 1,
+      DirectorySize = 4096,
+      MaxDenseId = DirectorySize * PageSize,
+      OverflowTableSize = 256,
+      OverflowTableMask = OverflowTableSize - 1
+   };
+
+   typedef SimDictionarySlot<U32> Slot;
+
+   struct Page
+   {
+      Slot                    mSlots[PageSize];
+      U32                     mLiveCount;
+      Page*                   mNextFree;
    };
-   SimObject *table[DefaultTableSize];
+
+   std::atomic<Page*>   mDirectory[DirectorySize];
+   Page*                mFreePages;
+   Vector<Page*>        mAllocatedPages;
+
+   SimObject*           mOverflowTable[OverflowTableSize];
+   std::atomic<U32>     mOverflowCount;
 
    void *mutex;
 
+   void insertOverflow(SimObject* obj);
+   bool removeOverflow(SimObject* obj);
+   SimObject* findOverflow(const U32 id) const;
+   SimObject* takeOverflow(const U32 id);
+
 public:
    void insert(SimObject* obj);
    void remove(SimObject* obj);
@@ -21,65 +21,173 @@
 //-----------------------------------------------------------------------------
 
 #include "sim/simFieldDictionary.h"
-#include "memory/dataChunker.h"
 #include "console/consoleInternal.h"
 #include "memory/frameAllocator.h"
 
 //-----------------------------------------------------------------------------
 
-SimFieldDictionary::Entry *SimFieldDictionary::mFreeList = NULL;
+static inline U32 hashSlotName(StringTableEntry slotName, U32 tableSize)
+{
+   // Fibonacci hashing spreads the string-table pointers across a power-of-two table.
+   return (U32)(((U64)(dsize_t)slotName * 0x9E3779B97F4A7C15ULL) >> 32) & (tableSize - 1);
+}
 
-static Chunker<SimFieldDictionary::Entry> fieldChunker;
+SimFieldDictionary::SimFieldDictionary()
+{
+   for(U32 i = 0; i < InlineEntryCount; i++)
+   {
+      mInlineEntries[i].slotName = NULL;
+      mInlineEntries[i].value = NULL;
+   }
+
+   mTable = NULL;
+   mTableSize = 0;
+   mEntryCount = 0;
+   mVersion = 0;
+}
 
-SimFieldDictionary::Entry *SimFieldDictionary::allocEntry()
+SimFieldDictionary::~SimFieldDictionary()
 {
-   if(mFreeList)
+   Entry *slots = getSlots();
+   const U32 slotCount = getSlotCount();
+   for(U32 i = 0; i < slotCount; i++)
    {
-      Entry *ret = mFreeList;
-      mFreeList = ret->next;
-      return ret;
+      if(slots[i].slotName)
+         dFree(slots[i].value);
    }
-   else
-      return fieldChunker.alloc();
+
+   delete[] mTable;
 }
 
-void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
+SimFieldDictionary::Entry *SimFieldDictionary::findEntry(StringTableEntry slotName)
 {
-   ent->next = mFreeList;
-   mFreeList = ent;
+   if(!mTable)
+   {
+      for(U32 i = 0; i < mEntryCount; i++)
+      {
+         if(mInlineEntries[i].slotName == slotName)
+            return &mInlineEntries[i];
+      }
+      return NULL;
+   }
+
+   const U32 mask = mTableSize - 1;
+   for(U32 index = hashSlotName(slotName, mTableSize);; index = (index + 1) & mask)
+   {
+      Entry *entry = &mTable[index];
+      if(entry->slotName == slotName)
+         return entry;
+      if(!entry->slotName)
+         return NULL;
+   }
 }
 
-SimFieldDictionary::SimFieldDictionary()
+SimFieldDictionary::Entry *SimFieldDictionary::insertEntry(StringTableEntry slotName)
 {
-   for(U32 i = 0; i < HashTableSize; i++)
-      mHashTable[i] = 0;
+   // Stay inline while there is room, otherwise keep the table under three-quarters full.
+   if(!mTable)
+   {
+      if(mEntryCount < InlineEntryCount)
+      {
+         Entry *entry = &mInlineEntries[mEntryCount++];
+         entry->slotName = slotName;
+         entry->value = NULL;
+         return entry;
+      }
 
-   mVersion = 0;
+      resizeTable(MinTableSize);
+   }
+   else if((mEntryCount + 1) * 4 > mTableSize * 3)
+   {
+      resizeTable(mTableSize * 2);
+   }
+
+   const U32 mask = mTableSize - 1;
+   U32 index = hashSlotName(slotName, mTableSize);
+   while(mTable[index].slotName)
+      index = (index + 1) & mask;
+
+   Entry *entry = &mTable[index];
+   entry->slotName = slotName;
+   entry->value = NULL;
+   mEntryCount++;
+   return entry;
 }
 
-SimFieldDictionary::~SimFieldDictionary()
+void SimFieldDictionary::removeEntry(Entry *entry)
 {
-   for(U32 i = 0; i < HashTableSize; i++)
+   mEntryCount--;
+
+   if(!mTable)
+   {
+      // Keep the inline entries packed.
+      *entry = mInlineEntries[mEntryCount];
+      mInlineEntries[mEntryCount].slotName = NULL;
+      mInlineEntries[mEntryCount].value = NULL;
+      return;
+   }
+
+   // Shift the rest of the cluster back so that no tombstones are needed.
+   const U32 mask = mTableSize - 1;
+   U32 hole = (U32)(entry - mTable);
+   for(U32 index = (hole + 1) & mask; mTable[index].slotName; index = (index + 1) & mask)
    {
-      for(Entry *walk = mHashTable[i]; walk;)
+      const U32 home = hashSlotName(mTable[index].slotName, mTableSize);
+      if(((index - home) & mask) >= ((index - hole) & mask))
       {
-         Entry *temp = walk;
-         walk = temp->next;
+         mTable[hole] = mTable[index];
+         hole = index;
+      }
+   }
+
+   mTable[hole].slotName = NULL;
+   mTable[hole].value = NULL;
+}
+
+void SimFieldDictionary::resizeTable(U32 tableSize)
+{
+   Entry *oldSlots = getSlots();
+   const U32 oldSlotCount = getSlotCount();
+
+   Entry *table = new Entry[tableSize];
+   for(U32 i = 0; i < tableSize; i++)
+   {
+      table[i].slotName = NULL;
+      table[i].value = NULL;
+   }
 
-         dFree(temp->value);
-         freeEntry(temp);
+   const U32 mask = tableSize - 1;
+   for(U32 i = 0; i < oldSlotCount; i++)
+   {
+      if(!oldSlots[i].slotName)
+         continue;
+
+      U32 index = hashSlotName(oldSlots[i].slotName, tableSize);
+      while(table[index].slotName)
+         index = (index + 1) & mask;
+      table[index] = oldSlots[i];
+   }
+
+   if(mTable)
+   {
+      delete[] mTable;
+   }
+   else
+   {
+      for(U32 i = 0; i < InlineEntryCount; i++)
+      {
+         mInlineEntries[i].slotName = NULL;
+         mInlineEntries[i].value = NULL;
       }
    }
+
+   mTable = table;
+   mTableSize = tableSize;
 }
 
 void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
-   Entry **walk = &mHashTable[bucket];
-   while(*walk && (*walk)->slotName != slotName)
-      walk = &((*walk)->next);
-
-   Entry *field = *walk;
+   Entry *field = findEntry(slotName);
    if(!*value)
    {
       if(field)
@@ -87,8 +195,7 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
          mVersion++;
 
          dFree(field->value);
-         *walk = field->next;
-         freeEntry(field);
+         removeEntry(field);
       }
    }
    else
@@ -102,24 +209,16 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
       {
          mVersion++;
 
-         field = allocEntry();
+         field = insertEntry(slotName);
          field->value = dStrdup(value);
-         field->slotName = slotName;
-         field->next = NULL;
-         *walk = field;
       }
    }
 }
 
 const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
-
-   for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
-      if(walk->slotName == slotName)
-         return walk->value;
-
-   return NULL;
+   Entry *field = findEntry(slotName);
+   return field ? field->value : NULL;
 }
 
 
@@ -127,9 +226,13 @@ void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 {
    mVersion++;
 
-   for(U32 i = 0; i < HashTableSize; i++)
-      for(Entry *walk = dict->mHashTable[i];walk; walk = walk->next)
-         setFieldValue(walk->slotName, walk->value);
+   Entry *slots = dict->getSlots();
+   const U32 slotCount = dict->getSlotCount();
+   for(U32 i = 0; i < slotCount; i++)
+   {
+      if(slots[i].slotName)
+         setFieldValue(slots[i].slotName, slots[i].value);
+   }
 }
 
 static S32 QSORT_CALLBACK compareEntries(const void* a,const void* b)
@@ -145,25 +248,28 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    const AbstractClassRep::FieldList &list = obj->getFieldList();
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   Entry *slots = getSlots();
+   const U32 slotCount = getSlotCount();
+   for(U32 slot = 0; slot < slotCount; slot++)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = &slots[slot];
+      if(!walk->slotName)
+         continue;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
+      if(i != list.size())
+         continue;
 
-         if (!obj->writeField(walk->slotName, walk->value))
-            continue;
 
-         flist.push_back(walk);
-      }
+      if (!obj->writeField(walk->slotName, walk->value))
+         continue;
+
+      flist.push_back(walk);
    }
 
    // Sort Entries to prevent version control conflicts
@@ -191,21 +297,24 @@ void SimFieldDictionary::printFields(SimObject *obj)
    char expandedBuffer[4096];
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   Entry *slots = getSlots();
+   const U32 slotCount = getSlotCount();
+   for(U32 slot = 0; slot < slotCount; slot++)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = &slots[slot];
+      if(!walk->slotName)
+         continue;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
-         flist.push_back(walk);
-      }
+      if(i != list.size())
+         continue;
+
+      flist.push_back(walk);
    }
    dQsort(flist.address(),flist.size(),sizeof(Entry *),compareEntries);
 
@@ -222,7 +331,7 @@ void SimFieldDictionary::printFields(SimObject *obj)
 SimFieldDictionaryIterator::SimFieldDictionaryIterator(SimFieldDictionary * dictionary)
 {
    mDictionary = dictionary;
-   mHashIndex = -1;
+   mSlotIndex = -1;
    mEntry = 0;
    operator++();
 }
@@ -232,11 +341,15 @@ SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator++()
    if(!mDictionary)
       return(mEntry);
 
-   if(mEntry)
-      mEntry = mEntry->next;
+   SimFieldDictionary::Entry *slots = mDictionary->getSlots();
+   const S32 slotCount = (S32)mDictionary->getSlotCount();
 
-   while(!mEntry && (mHashIndex < (SimFieldDictionary::HashTableSize-1)))
-      mEntry = mDictionary->mHashTable[++mHashIndex];
+   mEntry = 0;
+   while(!mEntry && (mSlotIndex < (slotCount-1)))
+   {
+      if(slots[++mSlotIndex].slotName)
+         mEntry = &slots[mSlotIndex];
+   }
 
    return(mEntry);
 }
@@ -34,7 +34,11 @@ class SimObject;
 //-----------------------------------------------------------------------------
 
 /// Dictionary to keep track of dynamic fields on SimObject.
-
+///
+/// Most objects carry only a handful of dynamic fields so the first few are
+/// kept unordered inline.  Past that the fields move to an open-addressed
+/// table keyed by the slot name which grows as needed.  Entries are stored
+/// by value, so an Entry pointer is only valid until the dictionary changes.
 class SimFieldDictionary
 {
    friend class SimFieldDictionaryIterator;
@@ -44,26 +48,35 @@ class SimFieldDictionary
    {
       StringTableEntry slotName;
       char *value;
-      Entry *next;
    };
    enum
    {
-      HashTableSize = 19
+      InlineEntryCount = 4,
+      MinTableSize = 16
    };
-   Entry *mHashTable[HashTableSize];
-  private:
 
-   static Entry *mFreeList;
-   static void freeEntry(Entry *entry);
-   static Entry *allocEntry();
+  private:
+   Entry mInlineEntries[InlineEntryCount];
+   Entry *mTable;
+   U32 mTableSize;
+   U32 mEntryCount;
 
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
    U32 mVersion;
 
+   Entry *findEntry(StringTableEntry slotName);
+   Entry *insertEntry(StringTableEntry slotName);
+   void removeEntry(Entry *entry);
+   void resizeTable(U32 tableSize);
+
+   inline Entry *getSlots() { return mTable ? mTable : mInlineEntries; }
+   inline U32 getSlotCount() const { return mTable ? mTableSize : mEntryCount; }
+
 public:
    const U32 getVersion() const { return mVersion; }
+   inline U32 getFieldCount() const { return mEntryCount; }
 
    SimFieldDictionary();
    ~SimFieldDictionary();
@@ -79,7 +92,7 @@ public:
 class SimFieldDictionaryIterator
 {
    SimFieldDictionary *          mDictionary;
-   S32                           mHashIndex;
+   S32                           mSlotIndex;
    SimFieldDictionary::Entry *   mEntry;
 
   public:
@@ -88,4 +101,4 @@ class SimFieldDictionaryIterator
    SimFieldDictionary::Entry* operator*();
 };
 
-#endif // _SIM_FIELD_DICTIONARY_H_
\ No newline at end of file
+#endif // _SIM_FIELD_DICTIONARY_H_
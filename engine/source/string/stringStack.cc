@@ -23,16 +23,23 @@
 #include "stringStack.h"
 #include "math/mMath.h"
 
-void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame /* = false */)
+void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame /* = false */, bool formatValues /* = true */)
 {
    U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
    U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs);
 
    *in_argv = mArgV;
    mArgV[0] = name;
+   mArgStartStack = startStack;
    
    for(U32 i = 0; i < argCount; i++)
+   {
+      if(formatValues)
+         formatStackValue(startStack + i);
+
       mArgV[i+1] = mBuffer + mStartOffsets[startStack + i];
+      mArgValues[i+1] = mStartValues[startStack + i];
+   }
    argCount++;
    
    *argc = argCount;
@@ -40,3 +47,15 @@ void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in
    if(popStackFrame)
       popFrame();
 }
+
+void StringStack::formatArgs(U32 argc)
+{
+   for(U32 i = 1; i < argc; i++)
+   {
+      if(mArgValues[i].mType != StringStackValue::TypeString && !mArgValues[i].mFormatted)
+      {
+         formatStackValue(mArgStartStack + i - 1);
+         mArgValues[i].mFormatted = true;
+      }
+   }
+}
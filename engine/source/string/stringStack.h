@@ -28,6 +28,24 @@
 #include "console/compiler.h"
 #include "string/stringTable.h"
 
+/// A value pushed onto the string stack.
+///
+/// Numeric function arguments are pushed unboxed and are only formatted
+/// as strings when something actually asks for the string.
+struct StringStackValue
+{
+   enum ValueType {
+      TypeString,
+      TypeUInt,
+      TypeFloat
+   };
+
+   U8  mType;
+   bool mFormatted;
+   S64 mIntValue;
+   F64 mFloatValue;
+};
+
 /// Core stack for interpreter operations.
 ///
 /// This class provides some powerful semantics for working with strings, and is
@@ -37,13 +55,18 @@ struct StringStack
    enum {
       MaxStackDepth = 1024,
       MaxArgs = 20,
-      ReturnBufferSpace = 512
+      ReturnBufferSpace = 512,
+      NumberBufferSpace = 32
    };
    char *mBuffer;
    U32   mBufferSize;
-   const char *mArgV[MaxArgs];
+   // The arguments follow the function name.
+   const char *mArgV[MaxArgs + 1];
+   StringStackValue mArgValues[MaxArgs + 1];
+   U32 mArgStartStack;
    U32 mFrameOffsets[MaxStackDepth];
    U32 mStartOffsets[MaxStackDepth];
+   StringStackValue mStartValues[MaxStackDepth];
 
    U32 mNumFrames;
    U32 mArgc;
@@ -81,6 +104,9 @@ struct StringStack
       mLen = 0;
       mStartStackSize = 0;
       mFunctionOffset = 0;
+      mArgStartStack = 0;
+      mArgValues[0].mType = StringStackValue::TypeString;
+      mArgValues[0].mFormatted = true;
       validateBufferSize(8192);
       validateArgBufferSize(2048);
    }
@@ -184,6 +210,7 @@ struct StringStack
    ///       properly push the stack.
    void advance()
    {
+      mStartValues[mStartStackSize].mType = StringStackValue::TypeString;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mLen = 0;
@@ -196,6 +223,7 @@ struct StringStack
    ///       properly push the stack.
    void advanceChar(char c)
    {
+      mStartValues[mStartStackSize].mType = StringStackValue::TypeString;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mBuffer[mStart] = c;
@@ -210,6 +238,57 @@ struct StringStack
       advanceChar(0);
    }
 
+   /// Push an unboxed integer, placing a zero-length string on the top.
+   ///
+   /// Space is reserved for the string so it can be formatted in-place if needed.
+   void pushIntValue(S64 value)
+   {
+      StringStackValue &stackValue = mStartValues[mStartStackSize];
+      stackValue.mType = StringStackValue::TypeUInt;
+      stackValue.mFormatted = false;
+      stackValue.mIntValue = value;
+      pushNumberSpace();
+   }
+
+   /// Push an unboxed float, placing a zero-length string on the top.
+   ///
+   /// Space is reserved for the string so it can be formatted in-place if needed.
+   void pushFloatValue(F64 value)
+   {
+      StringStackValue &stackValue = mStartValues[mStartStackSize];
+      stackValue.mType = StringStackValue::TypeFloat;
+      stackValue.mFormatted = false;
+      stackValue.mFloatValue = value;
+      pushNumberSpace();
+   }
+
+   /// Reserve the string space for an unboxed value.
+   void pushNumberSpace()
+   {
+      validateBufferSize(mStart + NumberBufferSpace + 2);
+      mStartOffsets[mStartStackSize++] = mStart;
+      mBuffer[mStart] = 0;
+      mStart += NumberBufferSpace;
+      mBuffer[mStart] = 0;
+      mLen = 0;
+   }
+
+   /// Format an unboxed value in-place.
+   void formatStackValue(U32 index)
+   {
+      StringStackValue &stackValue = mStartValues[index];
+      if(stackValue.mType == StringStackValue::TypeString || stackValue.mFormatted)
+         return;
+
+      // NOTE: These match the formatting used when converting to strings on the stack.
+      char *buffer = mBuffer + mStartOffsets[index];
+      if(stackValue.mType == StringStackValue::TypeUInt)
+         dSprintf(buffer, NumberBufferSpace, "%d", (U32)stackValue.mIntValue);
+      else
+         dSprintf(buffer, NumberBufferSpace, "%.9g", stackValue.mFloatValue);
+      stackValue.mFormatted = true;
+   }
+
    inline void setLen(U32 newlen)
    {
       mLen = newlen;
@@ -265,7 +344,30 @@ struct StringStack
    }
 
    /// Get the arguments for a function call from the stack.
-   void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false);
+   ///
+   /// If the values aren't formatted then unboxed arguments are empty strings
+   /// until formatArgs() is called and must be read using getArgValues().
+   void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false, bool formatValues = true);
+
+   /// Format a single unboxed argument from the last getArgcArgv().
+   ///
+   /// @note The stack frame must not have been popped.
+   inline void formatArg(U32 argIndex)
+   {
+      formatStackValue(mArgStartStack + argIndex - 1);
+      mArgValues[argIndex].mFormatted = true;
+   }
+
+   /// Format all the unboxed arguments from the last getArgcArgv().
+   ///
+   /// @note The stack frame must not have been popped.
+   void formatArgs(U32 argc);
+
+   /// Get the typed arguments from the last getArgcArgv().
+   inline const StringStackValue *getArgValues() const
+   {
+      return mArgValues;
+   }
 };
 
 #endif
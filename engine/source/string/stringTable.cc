@@ -23,8 +23,11 @@
 #include "platform/platform.h"
 #include "stringTable.h"
 
+#include <new>
+#include <string.h>
+
 _StringTable *_gStringTable = NULL;
-const U32 _StringTable::csm_stInitSize = 29;
+const U32 _StringTable::csm_stInitSize = 64;
 StringTableEntry _StringTable::EmptyString;
 
 //---------------------------------------------------------------
@@ -34,60 +37,97 @@ StringTableEntry _StringTable::EmptyString;
 //---------------------------------------------------------------
 
 namespace {
-bool sgInitTable = true;
-U8   sgHashTable[256];
 
-void initTolowerTable()
+const U64 csm_hashMultiplier1 = 0x87c37b91114253d5ULL;
+const U64 csm_hashMultiplier2 = 0x4cf5ad432745937fULL;
+
+inline U64 rotateLeft(const U64 value, const U32 shift)
+{
+   return (value << shift) | (value >> (64 - shift));
+}
+
+// Lower-case the ASCII letters in eight characters at once, matching dStricmp.
+inline U64 foldCase(const U64 chars)
+{
+   const U64 ones = 0x0101010101010101ULL;
+   const U64 low7 = chars & (ones * 0x7f);
+   const U64 atLeastA = low7 + ones * (0x80 - 'A');
+   const U64 aboveZ = low7 + ones * (0x80 - 'Z' - 1);
+   const U64 upper = atLeastA & ~aboveZ & ~chars & (ones * 0x80);
+   return chars | (upper >> 2);
+}
+
+inline U64 mixWord(U64 hash, U64 chars)
+{
+   chars *= csm_hashMultiplier1;
+   chars = rotateLeft(chars, 31);
+   chars *= csm_hashMultiplier2;
+   hash ^= chars;
+   return rotateLeft(hash, 27) * 5 + 0x52dce729;
+}
+
+U32 hashChars(const char* str, const U32 length)
 {
-   for (U32 i = 0; i < 256; i++) {
-      U8 c = dTolower(i);
-      sgHashTable[i] = c * c;
+   U64 hash = 0x9e3779b97f4a7c15ULL ^ length;
+
+   // Eight characters per step.
+   U32 remaining = length;
+   while(remaining >= 8)
+   {
+      U64 chars;
+      dMemcpy(&chars, str, 8);
+      hash = mixWord(hash, foldCase(chars));
+      str += 8;
+      remaining -= 8;
    }
 
-   sgInitTable = false;
+   if(remaining)
+   {
+      U64 chars = 0;
+      dMemcpy(&chars, str, remaining);
+      hash = mixWord(hash, foldCase(chars));
+   }
+
+   // Final avalanche.
+   hash ^= hash >> 33;
+   hash *= 0xff51afd7ed558ccdULL;
+   hash ^= hash >> 33;
+   hash *= 0xc4ceb9fe1a85ec53ULL;
+   hash ^= hash >> 33;
+   return (U32)hash;
+}
+
+// Length of a string up to a limit, as dStrncpy would copy.
+inline U32 boundedLength(const char* str, const S32 len)
+{
+   const void* end = len > 0 ? memchr(str, 0, len) : str;
+   return end ? (U32)((const char*)end - str) : (U32)len;
 }
 
 } // namespace {}
 
 U32 _StringTable::hashString(const char* str)
 {
-   if (sgInitTable)
-      initTolowerTable();
-
-   U32 ret = 0;
-   char c;
-   while((c = *str++) != 0) {
-      ret <<= 1;
-      ret ^= sgHashTable[c];
-   }
-   return ret;
+   return hashChars(str, dStrlen(str));
 }
 
 U32 _StringTable::hashStringn(const char* str, S32 len)
 {
-   if (sgInitTable)
-      initTolowerTable();
-
-   U32 ret = 0;
-   char c;
-   while((c = *str++) != 0 && len--) {
-      ret <<= 1;
-      ret ^= sgHashTable[c];
-   }
-   return ret;
+   return hashChars(str, boundedLength(str, len));
 }
 
 //--------------------------------------
 _StringTable::_StringTable()
 {
-   buckets = (Node **) dMalloc(csm_stInitSize * sizeof(Node *));
-   for(U32 i = 0; i < csm_stInitSize; i++) {
-      buckets[i] = 0;
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      shard.table = createTable(csm_stInitSize);
+      shard.oldTable = NULL;
+      shard.migrateIndex = 0;
+      shard.itemCount = 0;
+      shard.retiredTables = NULL;
    }
 
-   numBuckets = csm_stInitSize;
-   itemCount = 0;
-
    // Insert empty string.
    EmptyString = insert("");
 }
@@ -95,7 +135,15 @@ _StringTable::_StringTable()
 //--------------------------------------
 _StringTable::~_StringTable()
 {
-   dFree(buckets);
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      dFree(shard.table.load());
+      while(shard.retiredTables) {
+         Table* next = shard.retiredTables->retired;
+         dFree(shard.retiredTables);
+         shard.retiredTables = next;
+      }
+   }
 }
 
 
@@ -118,37 +166,154 @@ void _StringTable::destroy()
 }
 
 //--------------------------------------
-StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
+_StringTable::Table* _StringTable::createTable(const U32 capacity)
 {
-   if ( val == NULL )
-       return StringTable->EmptyString;
+   AssertFatal(isPow2(capacity), "StringTable::createTable: capacity must be a power of two.");
+
+   Table* table = (Table *) dMalloc(sizeof(Table) + (capacity - 1) * sizeof(Slot));
+   table->mask = capacity - 1;
+   table->count = 0;
+   table->retired = NULL;
+   for(U32 i = 0; i < capacity; i++) {
+      new (&table->slots[i].node) std::atomic<Node*>(NULL);
+      new (&table->slots[i].hash) std::atomic<U32>(0);
+   }
+   return table;
+}
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-         return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
+//--------------------------------------
+_StringTable::Node* _StringTable::find(const Table* table, const U32 hash, const char* val, const U32 length, const bool caseSens)
+{
+   // Linear probe until an empty slot.  Slots are never emptied so a reader can't miss an entry that was there when it started.
+   for(U32 index = hash & table->mask; ; index = (index + 1) & table->mask) {
+      const Slot& slot = table->slots[index];
+      Node* node = slot.node.load(std::memory_order_acquire);
+      if(!node)
+         return NULL;
+
+      if(slot.hash.load(std::memory_order_relaxed) != hash || node->length != length)
+         continue;
+
+      if(caseSens) {
+         if(!dMemcmp(node->val, val, length))
+            return node;
+      }
+      else if(!dStrnicmp(node->val, val, length)) {
+         return node->canonical;
+      }
+   }
+}
+
+//--------------------------------------
+void _StringTable::place(Table* table, Node* node)
+{
+   U32 index = node->hash & table->mask;
+   while(table->slots[index].node.load(std::memory_order_relaxed))
+      index = (index + 1) & table->mask;
+
+   // The hash must be visible before the node that publishes it.
+   table->slots[index].hash.store(node->hash, std::memory_order_relaxed);
+   table->slots[index].node.store(node, std::memory_order_release);
+   table->count++;
+}
+
+//--------------------------------------
+_StringTable::Node* _StringTable::findInShard(const Shard& shard, const U32 hash, const char* val, const U32 length, const bool caseSens) const
+{
+   // Load the current table first; if a later grow retires the old table everything it held is already in this one.
+   const Table* table = shard.table.load(std::memory_order_acquire);
+   const Table* oldTable = shard.oldTable.load(std::memory_order_acquire);
+
+   Node* node = find(table, hash, val, length, caseSens);
+   if(!node && oldTable)
+      node = find(oldTable, hash, val, length, caseSens);
+   return node;
+}
+
+//--------------------------------------
+void _StringTable::migrateShard(Shard& shard, const U32 slotCount)
+{
+   Table* oldTable = shard.oldTable.load(std::memory_order_relaxed);
+   if(!oldTable)
+      return;
+
+   Table* table = shard.table.load(std::memory_order_relaxed);
+   const U32 capacity = oldTable->mask + 1;
+   const U32 end = slotCount < capacity - shard.migrateIndex ? shard.migrateIndex + slotCount : capacity;
+   for(; shard.migrateIndex < end; shard.migrateIndex++) {
+      Node* node = oldTable->slots[shard.migrateIndex].node.load(std::memory_order_relaxed);
+      if(node)
+         place(table, node);
    }
-   char *ret = 0;
-   if(!*walk) {
-      *walk = (Node *) mempool.alloc(sizeof(Node));
-      (*walk)->next = 0;
-      (*walk)->val = (char *) mempool.alloc(dStrlen(val) + 1);
-      dStrcpy((*walk)->val, val);
-      ret = (*walk)->val;
-      itemCount ++;
+
+   if(shard.migrateIndex == capacity) {
+      // Readers may still be probing the old table so it's only freed with the StringTable.
+      shard.oldTable.store(NULL, std::memory_order_release);
+      oldTable->retired = shard.retiredTables;
+      shard.retiredTables = oldTable;
    }
-   if(itemCount > 2 * numBuckets) {
-      resize(4 * numBuckets - 1);
+}
+
+//--------------------------------------
+void _StringTable::growShard(Shard& shard, const U32 capacity)
+{
+   // Only one move at a time.
+   migrateShard(shard, U32_MAX);
+
+   shard.migrateIndex = 0;
+   shard.oldTable.store(shard.table.load(std::memory_order_relaxed), std::memory_order_release);
+   shard.table.store(createTable(capacity), std::memory_order_release);
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::insertHashed(const char* val, const U32 length, const U32 hash, const bool caseSens)
+{
+   Shard& shard = mShards[hash >> (32 - ShardBits)];
+
+   // Strings already in the table need no lock.
+   Node* node = findInShard(shard, hash, val, length, caseSens);
+   if(node)
+      return node->val;
+
+   MutexHandle mutex;
+   mutex.lock(&shard.mutex, true);
+
+   // Someone may have added it meanwhile.
+   node = findInShard(shard, hash, val, length, caseSens);
+   if(node)
+      return node->val;
+
+   migrateShard(shard, MigrateSlotsPerInsert);
+
+   Table* table = shard.table.load(std::memory_order_relaxed);
+   if((table->count + 1) * 2 > table->mask + 1) {
+      growShard(shard, (table->mask + 1) * 2);
+      table = shard.table.load(std::memory_order_relaxed);
    }
-   return ret;
+
+   node = (Node *) shard.mempool.alloc(Offset(val, Node) + length + 1);
+   dMemcpy(node->val, val, length);
+   node->val[length] = 0;
+   node->hash = hash;
+   node->length = length;
+
+   // Case-sensitive entries that differ only in case share the first one inserted.
+   Node* canonical = caseSens ? findInShard(shard, hash, val, length, false) : NULL;
+   node->canonical = canonical ? canonical : node;
+
+   place(table, node);
+   shard.itemCount++;
+   return node->val;
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
+{
+   if ( val == NULL )
+       return StringTable->EmptyString;
+
+   const U32 length = dStrlen(val);
+   return insertHashed(val, length, hashChars(val, length), caseSens);
 }
 
 //--------------------------------------
@@ -157,14 +322,8 @@ StringTableEntry _StringTable::insertn(const char* src, S32 len, const bool  cas
    if ( src == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   char val[1024];
-   AssertFatal(len < sizeof(val), "Invalid string to insertn");
-   dStrncpy(val, src, len);
-   val[len] = 0;
-   return insert(val, caseSens);
+   const U32 length = boundedLength(src, len);
+   return insertHashed(src, length, hashChars(src, length), caseSens);
 }
 
 //--------------------------------------
@@ -173,20 +332,10 @@ StringTableEntry _StringTable::lookup(const char* val, const bool  caseSens)
    if ( val == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-            return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+   const U32 length = dStrlen(val);
+   const U32 hash = hashChars(val, length);
+   Node* node = findInShard(mShards[hash >> (32 - ShardBits)], hash, val, length, caseSens);
+   return node ? node->val : NULL;
 }
 
 //--------------------------------------
@@ -194,57 +343,34 @@ StringTableEntry _StringTable::lookupn(const char* val, S32 len, const bool  cas
 {
    if ( val == NULL )
        return StringTable->EmptyString;
-       
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashStringn(val, len);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL) {
-      if(caseSens && !dStrncmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      else if(!caseSens && !dStrnicmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+
+   const U32 length = boundedLength(val, len);
+   const U32 hash = hashChars(val, length);
+   Node* node = findInShard(mShards[hash >> (32 - ShardBits)], hash, val, length, caseSens);
+   return node ? node->val : NULL;
 }
 
 //--------------------------------------
 void _StringTable::resize(const U32 newSize)
 {
-   Node *head = NULL, *walk, *temp;
-   U32 i;
-   // reverse individual bucket lists
-   // we do this because new strings are added at the end of bucket
-   // lists so that case sens strings are always after their
-   // corresponding case insens strings
-
-   for(i = 0; i < numBuckets; i++) {
-      walk = buckets[i];
-      while(walk)
-      {
-         temp = walk->next;
-         walk->next = head;
-         head = walk;
-         walk = temp;
-      }
-   }
-   buckets = (Node **) dRealloc(buckets, newSize * sizeof(Node));
-   for(i = 0; i < newSize; i++) {
-      buckets[i] = 0;
-   }
-   numBuckets = newSize;
-   walk = head;
-   while(walk) {
-      U32 key;
-      Node *temp = walk;
-
-      walk = walk->next;
-      key = hashString(temp->val);
-      temp->next = buckets[key % newSize];
-      buckets[key % newSize] = temp;
+   // Spread over the shards, keeping each at most half full.
+   const U32 capacity = getMax(getNextPow2(getMax(newSize / ShardCount, (U32)1) * 2), csm_stInitSize);
+
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      MutexHandle mutex;
+      mutex.lock(&shard.mutex, true);
+
+      if(capacity > shard.table.load(std::memory_order_relaxed)->mask + 1)
+         growShard(shard, capacity);
    }
 }
 
+//--------------------------------------
+U32 _StringTable::getItemCount() const
+{
+   U32 itemCount = 0;
+   for(U32 i = 0; i < ShardCount; i++)
+      itemCount += mShards[i].itemCount;
+   return itemCount;
+}
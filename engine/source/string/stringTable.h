@@ -33,6 +33,8 @@
 #include "memory/dataChunker.h"
 #endif
 
+#include <atomic>
+
 //--------------------------------------
 /// A global table for the hashing and tracking of strings.
 ///
@@ -75,6 +77,13 @@
 /// @note Be aware that the StringTable NEVER DEALLOCATES memory, so be careful when you
 ///       add strings to it. If you carelessly add many strings, you will end up wasting
 ///       space.
+///
+/// The table is safe to use from any thread.  It is split into shards by hash, each an
+/// open-addressed table of entries that stores the case-folded hash alongside the entry.
+/// Finding a string that is already in the table takes no locks; only adding a new string
+/// locks its shard.  A shard grows by moving a few slots into a table twice the size on
+/// each insert rather than rehashing everything at once, and lookups check both tables
+/// until the move is complete.
 class _StringTable
 {
 private:
@@ -84,16 +93,54 @@ private:
    /// This is internal to the _StringTable class.
    struct Node
    {
-      char *val;
-      Node *next;
+      /// The first string inserted that matches this one ignoring case.
+      Node *canonical;
+      U32 hash;
+      U32 length;
+      char val[1];
+   };
+
+   struct Slot
+   {
+      std::atomic<Node*> node;
+      std::atomic<U32> hash;
+   };
+
+   struct Table
+   {
+      U32 mask;
+      U32 count;
+      Table *retired;
+      Slot slots[1];
    };
 
-   Node**      buckets;
-   U32         numBuckets;
-   U32         itemCount;
-   DataChunker mempool;
+   enum {
+      ShardBits = 4,
+      ShardCount = 1 << ShardBits,
+      MigrateSlotsPerInsert = 16
+   };
 
-   Mutex mMutex;
+   struct Shard
+   {
+      std::atomic<Table*> table;
+      std::atomic<Table*> oldTable;
+      U32 migrateIndex;
+      U32 itemCount;
+      Table *retiredTables;
+      DataChunker mempool;
+      Mutex mutex;
+      U8 padding[64];
+   };
+
+   Shard mShards[ShardCount];
+
+   static Table* createTable(const U32 capacity);
+   static Node* find(const Table* table, const U32 hash, const char* val, const U32 length, const bool caseSens);
+   static void place(Table* table, Node* node);
+   Node* findInShard(const Shard& shard, const U32 hash, const char* val, const U32 length, const bool caseSens) const;
+   StringTableEntry insertHashed(const char* val, const U32 length, const U32 hash, const bool caseSens);
+   void growShard(Shard& shard, const U32 capacity);
+   void migrateShard(Shard& shard, const U32 slotCount);
 
   protected:
    static const U32 csm_stInitSize;
@@ -152,7 +199,11 @@ private:
    /// @param newSize   Number of new items to allocate space for.
    void             resize(const U32 newSize);
 
+   /// Number of strings in the table.
+   U32              getItemCount() const;
+
    /// Hash a string into a U32.
+   /// The hash ignores case so strings that only differ in case hash the same.
    static U32 hashString(const char* in_pString);
 
    /// Hash a string of given length into a U32.
@@ -28,7 +28,8 @@
 
 namespace StringUnit
 {
-   static char _returnBuffer[4096];
+   // Per-thread so that units can be fetched from job workers.
+   static thread_local char _returnBuffer[4096];
 
    StringTableEntry getStringTableUnit(const char* string, U32 index, const char* set)
    {
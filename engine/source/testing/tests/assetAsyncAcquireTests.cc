@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBSCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_ASYNC_UNITTEST_PNG_FILE   "_unitTestAssetAsync_RemoveMe.png"
+
+// A 2x2 paletted PNG.
+static const U8 sAssetAsyncPalettedPNG[] =
+{
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x03, 0x00, 0x00, 0x00, 0x45, 0x68, 0xfd,
+    0x16, 0x00, 0x00, 0x00, 0x06, 0x50, 0x4c, 0x54, 0x45, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6c,
+    0xa1, 0xfd, 0x8e, 0x00, 0x00, 0x00, 0x0e, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x60,
+    0x64, 0x60, 0x60, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x4f, 0x41, 0x36, 0xf9, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+//-----------------------------------------------------------------------------
+
+class AssetAsyncAcquireCallback : public AssetPtrCallback
+{
+public:
+    AssetAsyncAcquireCallback() : mAcquiredCount( 0 ) {}
+
+    U32 mAcquiredCount;
+
+protected:
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase ) {}
+    virtual void onAssetAcquired( AssetPtrBase* pAssetPtrBase ) { mAcquiredCount++; }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquireTests, AcquireCompletionTest )
+{
+    ASSERT_TRUE( AssetDatabase.isProperlyAdded() );
+
+    // Flush anything already pending so the counts below are ours.
+    AssetDatabase.processAsyncLoads( true );
+
+    AssetBase* pAssetBase = new AssetBase();
+    ASSERT_TRUE( pAssetBase->registerObject() );
+    StringTableEntry assetId = AssetDatabase.addPrivateAsset( pAssetBase );
+    ASSERT_NE( assetId, StringTable->EmptyString );
+
+    // The pointer stays pending until the asset manager completes the load.
+    AssetAsyncAcquireCallback callback;
+    AssetPtr<AssetBase> assetPtr;
+    ASSERT_TRUE( assetPtr.setAssetIdAsync( assetId, &callback ) );
+    ASSERT_TRUE( assetPtr.isPending() );
+    ASSERT_TRUE( assetPtr.isNull() );
+    ASSERT_EQ( assetPtr.getAssetId(), assetId );
+    ASSERT_EQ( AssetDatabase.getAsyncLoadCount(), (U32)1 );
+
+    // A cancelled acquire is never completed.
+    AssetAsyncAcquireCallback cancelledCallback;
+    AssetPtr<AssetBase> cancelledAssetPtr;
+    ASSERT_TRUE( cancelledAssetPtr.setAssetIdAsync( assetId, &cancelledCallback ) );
+    cancelledAssetPtr.cancelAsyncAcquire();
+    ASSERT_FALSE( cancelledAssetPtr.isPending() );
+
+    // Nothing decodes for the asset so the next tick completes it.
+    AssetDatabase.processAsyncLoads();
+    ASSERT_FALSE( assetPtr.isPending() );
+    ASSERT_TRUE( assetPtr.notNull() );
+    ASSERT_EQ( (AssetBase*)assetPtr, pAssetBase );
+    ASSERT_EQ( callback.mAcquiredCount, (U32)1 );
+    ASSERT_EQ( cancelledCallback.mAcquiredCount, (U32)0 );
+    ASSERT_TRUE( cancelledAssetPtr.isNull() );
+    ASSERT_EQ( AssetDatabase.getAsyncLoadCount(), (U32)0 );
+
+    // Releasing the private asset removes it.
+    assetPtr.clear();
+    ASSERT_FALSE( AssetDatabase.isDeclaredAsset( assetId ) );
+
+    // Unknown assets are rejected.
+    ASSERT_FALSE( assetPtr.setAssetIdAsync( "_unitTestAssetAsync:Missing" ) );
+    ASSERT_FALSE( assetPtr.isPending() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncAcquireTests, BitmapDecodeTest )
+{
+    // Background decoding needs background threads.
+    if ( JobScheduler::Instance == NULL || JobScheduler::Instance->getBackgroundThreadCount() == 0 )
+        return;
+
+    FileStream stream;
+    ASSERT_TRUE( stream.open( ASSET_ASYNC_UNITTEST_PNG_FILE, FileStream::Write ) );
+    ASSERT_TRUE( stream.write( sizeof(sAssetAsyncPalettedPNG), sAssetAsyncPalettedPNG ) );
+    stream.close();
+
+    StringTableEntry textureKey = StringTable->insert( ASSET_ASYNC_UNITTEST_PNG_FILE );
+    const char* pPreviousPreference = StringTable->insert( Con::getVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit" ) );
+
+    // The paletted preference is read when queued and applied by the background decode.
+    for( U32 pass = 0; pass < 2; ++pass )
+    {
+        const bool forcePalleted16Bit = pass == 0;
+        Con::setBoolVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit", forcePalleted16Bit );
+
+        ASSERT_TRUE( TextureManager::queueBitmapDecode( textureKey ) );
+        ASSERT_EQ( TextureManager::getBitmapDecodeCount(), (U32)1 );
+
+        // Changing the preference after queueing must not affect the decode.
+        Con::setBoolVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit", !forcePalleted16Bit );
+
+        while( TextureManager::isBitmapDecodePending( textureKey ) )
+            Platform::sleep( 1 );
+
+        ASSERT_GT( TextureManager::getDecodedBitmapSize( textureKey ), (U32)0 );
+
+        GBitmap* pBitmap = TextureManager::takeDecodedBitmap( textureKey );
+        ASSERT_TRUE( pBitmap != NULL );
+        ASSERT_EQ( pBitmap->getWidth(), (U32)2 );
+        ASSERT_EQ( pBitmap->getHeight(), (U32)2 );
+        ASSERT_TRUE( pBitmap->mPalettedSource );
+        ASSERT_EQ( pBitmap->mForce16Bit, forcePalleted16Bit );
+        ASSERT_EQ( TextureManager::getBitmapDecodeCount(), (U32)0 );
+        delete pBitmap;
+    }
+
+    Con::setVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit", pPreviousPreference );
+
+    ASSERT_TRUE( Platform::fileDelete( ASSET_ASYNC_UNITTEST_PNG_FILE ) );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,116 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#include "assets/assetManifestCache.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_MANIFEST_UNITTEST_ASSET_FILE      "_unitTestAsset_RemoveMe.asset.taml"
+#define ASSET_MANIFEST_UNITTEST_MANIFEST_FILE   "_unitTestAssetManifest_RemoveMe.cache"
+
+//-----------------------------------------------------------------------------
+
+static void writeAssetManifestTestFile( const char* pText )
+{
+    FileStream stream;
+    ASSERT_TRUE( stream.open( ASSET_MANIFEST_UNITTEST_ASSET_FILE, FileStream::Write ) );
+    stream.writeStringBuffer( pText );
+    stream.close();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetManifestCacheTests, SaveLoadValidateTest )
+{
+    writeAssetManifestTestFile( "<ImageAsset AssetName=\"Test\"/>" );
+
+    StringTableEntry assetFilePath = StringTable->insert( ASSET_MANIFEST_UNITTEST_ASSET_FILE );
+    StringTableEntry dependencyAssetId = StringTable->insert( "Module:Dependency" );
+
+    // Store a declaration and save the manifest.
+    {
+        AssetManifestCache manifestCache;
+        ASSERT_FALSE( manifestCache.load( ASSET_MANIFEST_UNITTEST_MANIFEST_FILE ) );
+
+        AssetManifestCache::FileStamp fileStamp;
+        ASSERT_TRUE( AssetManifestCache::getFileStamp( assetFilePath, fileStamp ) );
+
+        TamlAssetDeclaredVisitor assetDeclaredVisitor;
+        assetDeclaredVisitor.getAssetDefinition().mAssetName = StringTable->insert( "Test" );
+        assetDeclaredVisitor.getAssetDefinition().mAssetType = StringTable->insert( "ImageAsset" );
+        assetDeclaredVisitor.getAssetDefinition().mAssetAutoUnload = false;
+        assetDeclaredVisitor.getAssetDependencies().push_back( dependencyAssetId );
+        manifestCache.storeDeclaredAsset( assetFilePath, fileStamp, assetDeclaredVisitor );
+
+        ASSERT_TRUE( manifestCache.isDirty() );
+        ASSERT_TRUE( manifestCache.save() );
+        ASSERT_FALSE( manifestCache.isDirty() );
+    }
+
+    // Load the manifest and restore the declaration.
+    {
+        AssetManifestCache manifestCache;
+        ASSERT_TRUE( manifestCache.load( ASSET_MANIFEST_UNITTEST_MANIFEST_FILE ) );
+
+        const AssetManifestCache::DeclaredAssetRecord* pRecord = manifestCache.findDeclaredAsset( assetFilePath );
+        ASSERT_TRUE( pRecord != NULL );
+
+        AssetManifestCache::FileStamp fileStamp;
+        ASSERT_TRUE( AssetManifestCache::validateFileStamp( assetFilePath, pRecord->mFileStamp, fileStamp ) );
+
+        TamlAssetDeclaredVisitor assetDeclaredVisitor;
+        AssetManifestCache::restoreDeclaredAsset( *pRecord, assetFilePath, assetDeclaredVisitor );
+        ASSERT_EQ( assetDeclaredVisitor.getAssetDefinition().mAssetName, StringTable->insert( "Test" ) );
+        ASSERT_EQ( assetDeclaredVisitor.getAssetDefinition().mAssetType, StringTable->insert( "ImageAsset" ) );
+        ASSERT_EQ( assetDeclaredVisitor.getAssetDefinition().mAssetBaseFilePath, assetFilePath );
+        ASSERT_FALSE( assetDeclaredVisitor.getAssetDefinition().mAssetAutoUnload );
+        ASSERT_EQ( assetDeclaredVisitor.getAssetDependencies().size(), 1 );
+        ASSERT_EQ( assetDeclaredVisitor.getAssetDependencies()[0], dependencyAssetId );
+
+        // Changing the content must invalidate the record.
+        writeAssetManifestTestFile( "<ImageAsset AssetName=\"Changed\"/>" );
+        ASSERT_FALSE( AssetManifestCache::validateFileStamp( assetFilePath, pRecord->mFileStamp, fileStamp ) );
+
+        // Unused records are pruned.
+        manifestCache.pruneDeclaredAssets();
+        ASSERT_TRUE( manifestCache.findDeclaredAsset( assetFilePath ) == NULL );
+        ASSERT_TRUE( manifestCache.isDirty() );
+    }
+
+    ASSERT_TRUE( Platform::fileDelete( ASSET_MANIFEST_UNITTEST_ASSET_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( ASSET_MANIFEST_UNITTEST_MANIFEST_FILE ) );
+}
+
+#endif // TORQUE_SHIPPING
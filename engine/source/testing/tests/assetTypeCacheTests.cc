@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_TYPE_CACHE_H_
+#include "assets/assetTypeCache.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static Vector<AssetSharedMemory> createAssetTypeCacheSharedMemory( const void* pResource, const U32 memorySize )
+{
+    Vector<AssetSharedMemory> sharedMemory;
+    AssetSharedMemory resourceMemory;
+    resourceMemory.mpResource = pResource;
+    resourceMemory.mMemorySize = memorySize;
+    sharedMemory.push_back( resourceMemory );
+    return sharedMemory;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetTypeCacheTests, LeastRecentlyReleasedTest )
+{
+    AssetTypeCache assetTypeCache;
+    assetTypeCache.mMemoryBudget = 100;
+
+    AssetDefinition assets[3];
+    Vector<AssetSharedMemory> noSharedMemory;
+
+    // Released assets are linked most recent first.
+    assetTypeCache.linkIdleAsset( &assets[0], 40, noSharedMemory );
+    assetTypeCache.linkIdleAsset( &assets[1], 40, noSharedMemory );
+    ASSERT_TRUE( assets[0].mAssetIdle );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)80 );
+    ASSERT_EQ( assetTypeCache.mIdleAssetCount, (U32)2 );
+    ASSERT_EQ( assetTypeCache.mpIdleHead, &assets[1] );
+    ASSERT_EQ( assetTypeCache.mpIdleTail, &assets[0] );
+    ASSERT_TRUE( assetTypeCache.getEvictionCandidate() == NULL );
+
+    // Going over budget offers the least recently released asset.
+    assetTypeCache.linkIdleAsset( &assets[2], 40, noSharedMemory );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)120 );
+    ASSERT_EQ( assetTypeCache.getEvictionCandidate(), &assets[0] );
+
+    // Reviving an asset takes it out wherever it is in the list.
+    assetTypeCache.unlinkIdleAsset( &assets[1] );
+    ASSERT_FALSE( assets[1].mAssetIdle );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)80 );
+    ASSERT_EQ( assets[2].mpIdleNext, &assets[0] );
+    ASSERT_EQ( assets[0].mpIdlePrevious, &assets[2] );
+    ASSERT_TRUE( assetTypeCache.getEvictionCandidate() == NULL );
+
+    // Releasing it again makes it the most recent, so trimming evicts from the tail.
+    assetTypeCache.linkIdleAsset( &assets[1], 40, noSharedMemory );
+    AssetDefinition* pAssetDefinition;
+    Vector<AssetDefinition*> evicted;
+    while( (pAssetDefinition = assetTypeCache.getEvictionCandidate()) != NULL )
+    {
+        evicted.push_back( pAssetDefinition );
+        assetTypeCache.unlinkIdleAsset( pAssetDefinition );
+    }
+    ASSERT_EQ( evicted.size(), (U32)1 );
+    ASSERT_EQ( evicted[0], &assets[0] );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)80 );
+    ASSERT_EQ( assetTypeCache.mpIdleHead, &assets[1] );
+    ASSERT_EQ( assetTypeCache.mpIdleTail, &assets[2] );
+
+    // Lowering the budget trims everything that no longer fits.
+    assetTypeCache.mMemoryBudget = 0;
+    while( (pAssetDefinition = assetTypeCache.getEvictionCandidate()) != NULL )
+        assetTypeCache.unlinkIdleAsset( pAssetDefinition );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)0 );
+    ASSERT_EQ( assetTypeCache.mIdleAssetCount, (U32)0 );
+    ASSERT_TRUE( assetTypeCache.mpIdleHead == NULL );
+    ASSERT_TRUE( assetTypeCache.mpIdleTail == NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetTypeCacheTests, SharedMemoryTest )
+{
+    AssetTypeCache assetTypeCache;
+    assetTypeCache.mMemoryBudget = 1000;
+
+    AssetDefinition assets[2];
+    U32 sharedTexture;
+    const Vector<AssetSharedMemory> sharedMemory = createAssetTypeCacheSharedMemory( &sharedTexture, 500 );
+
+    // The first asset brings in the shared texture.
+    ASSERT_EQ( assetTypeCache.getIdleMemoryIncrease( 10, sharedMemory ), (U32)510 );
+    assetTypeCache.linkIdleAsset( &assets[0], 10, sharedMemory );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)510 );
+
+    // The second asset using the same texture only adds its own memory.
+    ASSERT_EQ( assetTypeCache.getIdleMemoryIncrease( 20, sharedMemory ), (U32)20 );
+    assetTypeCache.linkIdleAsset( &assets[1], 20, sharedMemory );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)530 );
+
+    // The texture stays counted until no idle asset holds it.
+    assetTypeCache.unlinkIdleAsset( &assets[0] );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)520 );
+    assetTypeCache.unlinkIdleAsset( &assets[1] );
+    ASSERT_EQ( assetTypeCache.mIdleMemorySize, (U32)0 );
+    ASSERT_EQ( assetTypeCache.getIdleMemoryIncrease( 20, sharedMemory ), (U32)520 );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,85 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BITMAP_FONT_H_
+#include "bitmapFont/BitmapFont.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static const char* sBitmapFontTestDescriptor =
+    "info face=\"Test\" size=32\n"
+    "common lineHeight=32 base=26 scaleW=256 scaleH=256 pages=1\n"
+    "page id=0 file=\"test.png\"\n"
+    "chars count=3\n"
+    "char id=65 x=0 y=0 width=20 height=24 xoffset=1 yoffset=2 xadvance=21 page=0\n"
+    "char id=86 x=20 y=0 width=20 height=24 xoffset=0 yoffset=2 xadvance=20 page=0\n"
+    "char id=1046 x=40 y=0 width=24 height=24 xoffset=0 yoffset=2 xadvance=25 page=0\n"
+    "kernings count=2\n"
+    "kerning first=65 second=86 amount=-2\n"
+    "kerning first=86 second=65 amount=-3\n";
+
+//-----------------------------------------------------------------------------
+
+TEST( BitmapFontTests, GlyphAndKerningLookupTest )
+{
+    MemStream stream( dStrlen(sBitmapFontTestDescriptor), (void*)sBitmapFontTestDescriptor, true, false );
+
+    font::BitmapFont bitmapFont;
+    bitmapFont.parseFont( stream );
+
+    ASSERT_EQ( bitmapFont.mLineHeight, 32 );
+    ASSERT_EQ( bitmapFont.mBaseline, 26 );
+
+    // Glyphs are found in both the Latin and Cyrillic pages.
+    ASSERT_EQ( bitmapFont.getCharacter( 65 ).mCharID, 65 );
+    ASSERT_EQ( bitmapFont.getCharacter( 65 ).mXAdvance, 21.0f );
+    ASSERT_EQ( bitmapFont.getCharacter( 1046 ).mCharID, 1046 );
+    ASSERT_EQ( bitmapFont.getCharacter( 1046 ).mWidth, 24 );
+
+    // Missing glyphs return the empty glyph without adding it.
+    ASSERT_EQ( bitmapFont.getCharacter( 66 ).mWidth, 0 );
+    ASSERT_EQ( bitmapFont.getCharacter( 0x4E00 ).mWidth, 0 );
+    const U32 memorySize = bitmapFont.getGlyphTableMemorySize();
+    bitmapFont.getCharacter( 0x4E01 );
+    ASSERT_EQ( bitmapFont.getGlyphTableMemorySize(), memorySize );
+
+    // Kerning pairs are ordered and missing pairs are zero.
+    ASSERT_EQ( bitmapFont.getKerning( 65, 86 ), -2 );
+    ASSERT_EQ( bitmapFont.getKerning( 86, 65 ), -3 );
+    ASSERT_EQ( bitmapFont.getKerning( 65, 65 ), 0 );
+    ASSERT_EQ( bitmapFont.getKerning( 1046, 65 ), 0 );
+    ASSERT_EQ( bitmapFont.getGlyphTableMemorySize(), memorySize );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_LOG_WRITER_H_
+#include "console/consoleLogWriter.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLE_LOG_WRITER_UNITTEST_FILE        "_unitTestConsoleLog_RemoveMe.log"
+#define CONSOLE_LOG_WRITER_UNITTEST_LINE_COUNT  20000
+
+//-----------------------------------------------------------------------------
+
+static U32 readConsoleLogWriterTestLines( Vector<U32>& lineValues, U32& droppedNotices )
+{
+    FileStream stream;
+    if ( !stream.open( CONSOLE_LOG_WRITER_UNITTEST_FILE, FileStream::Read ) )
+        return 0;
+
+    U32 lineCount = 0;
+    droppedNotices = 0;
+    char buffer[512];
+    while( stream.getStatus() == Stream::Ok )
+    {
+        stream.readLine( (U8*)buffer, sizeof(buffer) );
+        if ( buffer[0] == '\0' )
+            continue;
+
+        lineCount++;
+        if ( dStrncmp( buffer, "// ", 3 ) == 0 )
+            droppedNotices++;
+        else
+            lineValues.push_back( dAtoi( buffer + 5 ) );
+    }
+
+    return lineCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleLogWriterTests, WriteTest )
+{
+    // Lines written from the writer thread must all arrive in order.
+    {
+        // The writer holds its whole queue so keep it off the stack.
+        ConsoleLogWriter* pWriter = new ConsoleLogWriter;
+        pWriter->setOutput( CONSOLE_LOG_WRITER_UNITTEST_FILE, true );
+        pWriter->start();
+
+        char buffer[32];
+        for( U32 index = 0; index < CONSOLE_LOG_WRITER_UNITTEST_LINE_COUNT; ++index )
+        {
+            dSprintf( buffer, sizeof(buffer), "Line %d", index );
+            pWriter->pushLine( buffer, false );
+        }
+
+        pWriter->stop();
+        const U32 droppedLines = pWriter->getDroppedLineCount();
+        delete pWriter;
+        ASSERT_EQ( droppedLines, (U32)0 );
+    }
+
+    Vector<U32> lineValues;
+    U32 droppedNotices;
+    ASSERT_EQ( readConsoleLogWriterTestLines( lineValues, droppedNotices ), (U32)CONSOLE_LOG_WRITER_UNITTEST_LINE_COUNT );
+    ASSERT_EQ( droppedNotices, (U32)0 );
+    for( U32 index = 0; index < (U32)lineValues.size(); ++index )
+        ASSERT_EQ( lineValues[index], index );
+
+    ASSERT_TRUE( Platform::fileDelete( CONSOLE_LOG_WRITER_UNITTEST_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleLogWriterTests, DropTest )
+{
+    // Without the writer thread nothing drains the queue so lines beyond its capacity are dropped.
+    {
+        ConsoleLogWriter* pWriter = new ConsoleLogWriter;
+        pWriter->setOutput( CONSOLE_LOG_WRITER_UNITTEST_FILE, false );
+
+        char buffer[32];
+        for( U32 index = 0; index < ConsoleLogWriter::QueueCapacity + 10; ++index )
+        {
+            dSprintf( buffer, sizeof(buffer), "Line %d", index );
+            pWriter->pushLine( buffer );
+        }
+
+        const U32 droppedLines = pWriter->getDroppedLineCount();
+        const bool flushed = pWriter->flush();
+        delete pWriter;
+        ASSERT_EQ( droppedLines, (U32)10 );
+        ASSERT_TRUE( flushed );
+    }
+
+    Vector<U32> lineValues;
+    U32 droppedNotices;
+    ASSERT_EQ( readConsoleLogWriterTestLines( lineValues, droppedNotices ), (U32)ConsoleLogWriter::QueueCapacity + 1 );
+    ASSERT_EQ( droppedNotices, (U32)1 );
+    ASSERT_EQ( lineValues.last(), (U32)ConsoleLogWriter::QueueCapacity - 1 );
+
+    ASSERT_TRUE( Platform::fileDelete( CONSOLE_LOG_WRITER_UNITTEST_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleLogWriterTests, KeepTest )
+{
+    // Lines that must not be dropped (errors and asserts) make room by flushing on the calling thread.
+    {
+        ConsoleLogWriter* pWriter = new ConsoleLogWriter;
+        pWriter->setOutput( CONSOLE_LOG_WRITER_UNITTEST_FILE, false );
+
+        char buffer[32];
+        for( U32 index = 0; index < ConsoleLogWriter::QueueCapacity + 10; ++index )
+        {
+            dSprintf( buffer, sizeof(buffer), "Line %d", index );
+            pWriter->pushLine( buffer, false );
+        }
+
+        const U32 droppedLines = pWriter->getDroppedLineCount();
+        const bool flushed = pWriter->flush();
+        delete pWriter;
+        ASSERT_EQ( droppedLines, (U32)0 );
+        ASSERT_TRUE( flushed );
+    }
+
+    Vector<U32> lineValues;
+    U32 droppedNotices;
+    ASSERT_EQ( readConsoleLogWriterTestLines( lineValues, droppedNotices ), (U32)ConsoleLogWriter::QueueCapacity + 10 );
+    ASSERT_EQ( droppedNotices, (U32)0 );
+    for( U32 index = 0; index < (U32)lineValues.size(); ++index )
+        ASSERT_EQ( lineValues[index], index );
+
+    ASSERT_TRUE( Platform::fileDelete( CONSOLE_LOG_WRITER_UNITTEST_FILE ) );
+}
+
+#endif // TORQUE_SHIPPING
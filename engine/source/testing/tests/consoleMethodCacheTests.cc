@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleMethodCacheTests, CallSiteCache )
+{
+    Con::evaluate( "function MethodCacheTestClass::getValue(%this) { return 5; }" );
+    Con::evaluate( "$MethodCacheTestObject = new ScriptObject() { class = MethodCacheTestClass; };" );
+
+    const char* pLoop = "%r = 0; for(%i = 0; %i < 4; %i++) %r += $MethodCacheTestObject.getValue(); return %r;";
+
+    // Repeated calls from the same call site should hit the cache.
+    CodeBlock::smMethodCacheHits = 0;
+    CodeBlock::smMethodCacheMisses = 0;
+    ASSERT_STREQ( "20", Con::evaluate( pLoop ) );
+    ASSERT_EQ( 1U, CodeBlock::smMethodCacheMisses );
+    ASSERT_EQ( 3U, CodeBlock::smMethodCacheHits );
+
+    // Redefining the method must invalidate the cache.
+    Con::evaluate( "function MethodCacheTestClass::getValue(%this) { return 6; }" );
+    ASSERT_STREQ( "24", Con::evaluate( pLoop ) );
+
+    Con::evaluate( "$MethodCacheTestObject.delete();" );
+}
+
+#endif // TORQUE_SHIPPING
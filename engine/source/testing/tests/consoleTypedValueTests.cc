@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedValueTests, NumericArgumentsAndReturns )
+{
+    Con::evaluate( "function typedValueTestAdd(%a, %b) { return %a + %b; }" );
+    Con::evaluate( "function typedValueTestCat(%a, %b) { return %a @ \",\" @ %b; }" );
+    Con::evaluate( "function typedValueTestEcho(%a) { return %a; }" );
+
+    // Unboxed returns used numerically.
+    ASSERT_STREQ( "7", Con::evaluate( "return typedValueTestAdd(1, 2.5) * 2;" ) );
+
+    // Unboxed arguments used as strings.
+    ASSERT_STREQ( "6,1.5", Con::evaluate( "%x = 3; return typedValueTestCat(%x * 2, %x / 2);" ) );
+    ASSERT_STREQ( "-5", Con::evaluate( "return typedValueTestEcho(1 - 6);" ) );
+    ASSERT_STREQ( "1234567.5", Con::evaluate( "return typedValueTestEcho(1234567 + 0.5);" ) );
+
+    // Unboxed arguments passed to a native function.
+    ASSERT_STREQ( "3", Con::evaluate( "return strlen(10 * 10);" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedValueTests, FloatFormatting )
+{
+    Con::evaluate( "function typedValueTestFloatEcho(%a) { return %a; }" );
+
+    // Float locals keep their single precision formatting.
+    ASSERT_STREQ( "0.333333343", Con::evaluate( "%x = 1 / 3; return %x;" ) );
+    ASSERT_STREQ( "0.333333343", Con::evaluate( "%x = 1 / 3; return typedValueTestFloatEcho(%x);" ) );
+
+    // Computed float arguments keep the evaluator's formatting.
+    ASSERT_STREQ( "0.333333333", Con::evaluate( "return typedValueTestFloatEcho(1 / 3);" ) );
+    ASSERT_STREQ( "0.25", Con::evaluate( "return typedValueTestFloatEcho(1 / 4);" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleTypedValueTests, ArgumentLimit )
+{
+    Con::evaluate( "function typedValueTestLastArg(%a1, %a2, %a3, %a4, %a5, %a6, %a7, %a8, %a9, %a10, %a11, %a12, %a13, %a14, %a15, %a16, %a17, %a18, %a19, %a20) { return %a20; }" );
+
+    // Twenty arguments can still be passed.
+    ASSERT_STREQ( "40", Con::evaluate( "return typedValueTestLastArg(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 * 2);" ) );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,140 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _GL_RECORDER_H_
+#include "graphics/glRecorder.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+#ifndef _DEBUG_STATS_H_
+#include "2d/scene/DebugStats.h"
+#endif
+
+// The recorder can only rebind the GL functions on some platforms.
+#ifdef TORQUE_GL_RECORDER
+
+//-----------------------------------------------------------------------------
+
+#define GLRECORDER_UNITTEST_QUADCOUNT       256
+
+//-----------------------------------------------------------------------------
+
+TEST( GLRecorderTests, BatchRenderQuadTest )
+{
+    // Install the recorder.
+    ASSERT_TRUE( GLRecorder::install() );
+
+    // Create a batch renderer.
+    DebugStats debugStats;
+    BatchRender* pBatchRenderer = new BatchRender();
+    pBatchRenderer->setDebugStats( &debugStats );
+
+    // Submit quads using the same texture.
+    TextureHandle texture = BadTextureHandle;
+    for( U32 index = 0; index < GLRECORDER_UNITTEST_QUADCOUNT; ++index )
+    {
+        const F32 offset = (F32)index;
+        pBatchRenderer->SubmitQuad(
+            Vector2( offset, 0.0f ), Vector2( offset + 1.0f, 0.0f ), Vector2( offset + 1.0f, 1.0f ), Vector2( offset, 1.0f ),
+            Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ),
+            texture );
+    }
+    pBatchRenderer->flush();
+
+    // The quads should have been drawn as a single batch.
+    const GLRecorder::Trace& trace = GLRecorder::getTrace();
+    EXPECT_EQ( 1u, trace.drawCalls );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 4u, trace.vertices );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 6u, trace.indices );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 2u, trace.triangles );
+
+    // Clean up.
+    delete pBatchRenderer;
+    GLRecorder::uninstall();
+    EXPECT_FALSE( GLRecorder::isInstalled() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GLRecorderTests, BatchRenderReplayTest )
+{
+    // Install the recorder.
+    ASSERT_TRUE( GLRecorder::install() );
+
+    // Create a recording batch renderer and a batch renderer to replay into.
+    DebugStats debugStats;
+    BatchRenderCommandBuffer commandBuffer;
+    BatchRender* pBatchRecorder = new BatchRender( &commandBuffer );
+    BatchRender* pBatchRenderer = new BatchRender();
+    pBatchRecorder->setDebugStats( &debugStats );
+    pBatchRenderer->setDebugStats( &debugStats );
+    EXPECT_TRUE( pBatchRecorder->isRecording() );
+    EXPECT_FALSE( pBatchRenderer->isRecording() );
+
+    // Record quads using the same texture.
+    TextureHandle texture = BadTextureHandle;
+    for( U32 index = 0; index < GLRECORDER_UNITTEST_QUADCOUNT; ++index )
+    {
+        const F32 offset = (F32)index;
+        pBatchRecorder->setBlendMode( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+        pBatchRecorder->SubmitQuad(
+            Vector2( offset, 0.0f ), Vector2( offset + 1.0f, 0.0f ), Vector2( offset + 1.0f, 1.0f ), Vector2( offset, 1.0f ),
+            Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ),
+            texture );
+    }
+    pBatchRecorder->flush();
+
+    // Recording should not have drawn anything.
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 2u + 1u, commandBuffer.getCommandCount() );
+    EXPECT_EQ( 0u, GLRecorder::getTrace().drawCalls );
+    EXPECT_EQ( 0u, debugStats.batchTrianglesSubmitted );
+
+    // Replay the commands.
+    pBatchRenderer->replay( commandBuffer, 0, commandBuffer.getCommandCount() );
+
+    // The quads should have been drawn as a single batch.
+    const GLRecorder::Trace& trace = GLRecorder::getTrace();
+    EXPECT_EQ( 1u, trace.drawCalls );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 4u, trace.vertices );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 2u, trace.triangles );
+    EXPECT_EQ( GLRECORDER_UNITTEST_QUADCOUNT * 2u, debugStats.batchTrianglesSubmitted );
+
+    // Clean up.
+    delete pBatchRecorder;
+    delete pBatchRenderer;
+    GLRecorder::uninstall();
+    EXPECT_FALSE( GLRecorder::isInstalled() );
+}
+
+#endif // TORQUE_GL_RECORDER
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_H_
+#include "2d/assets/ParticleAsset.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_ASSET_FIELD_UNITTEST_FILE      "_unitTestParticleAsset_RemoveMe.asset.taml"
+#define PARTICLE_ASSET_FIELD_UNITTEST_TOLERANCE 0.05f
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BakedTamlReadTest )
+{
+    // A baked asset whose own fields are read after its field accuracy has been set.
+    const char* pAssetText =
+        "<ParticleAsset AssetName=\"BakedTest\" FieldAccuracy=\"BAKED\">\n"
+        "    <ParticleAsset.Fields>\n"
+        "        <SizeXScale Keys=\"0 1 250 4 600 0.5 1000 2\" />\n"
+        "        <SpinScale Keys=\"0 -1 1000 1\" />\n"
+        "    </ParticleAsset.Fields>\n"
+        "</ParticleAsset>\n";
+
+    FileStream stream;
+    ASSERT_TRUE( stream.open( PARTICLE_ASSET_FIELD_UNITTEST_FILE, FileStream::Write ) );
+    stream.write( dStrlen(pAssetText), pAssetText );
+    stream.close();
+
+    Taml taml;
+    taml.registerObject();
+    ParticleAsset* pParticleAsset = taml.read<ParticleAsset>( PARTICLE_ASSET_FIELD_UNITTEST_FILE );
+    ASSERT_TRUE( pParticleAsset != NULL );
+    ASSERT_EQ( pParticleAsset->getFieldAccuracy(), ParticleAsset::BAKED );
+
+    const char* pFieldNames[2] = { "SizeXScale", "SpinScale" };
+    for( U32 fieldIndex = 0; fieldIndex < 2; ++fieldIndex )
+    {
+        ParticleAssetField* pField = pParticleAsset->getParticleFields().findField( pFieldNames[fieldIndex] );
+        ASSERT_TRUE( pField != NULL );
+        ASSERT_TRUE( pField->isBaked() );
+
+        // The baked samples must follow the keys that were read.
+        for( F32 time = 0.0f; time <= pField->getMaxTime(); time += 12.5f )
+        {
+            ASSERT_NEAR( pField->getFieldValue( time ), pField->getExactFieldValue( time ), PARTICLE_ASSET_FIELD_UNITTEST_TOLERANCE );
+        }
+    }
+
+    ParticleAssetField* pSizeField = pParticleAsset->getParticleFields().findField( "SizeXScale" );
+    ASSERT_NEAR( pSizeField->getFieldValue( 0.0f ), 1.0f, PARTICLE_ASSET_FIELD_UNITTEST_TOLERANCE );
+    ASSERT_NEAR( pSizeField->getFieldValue( 1000.0f ), 2.0f, PARTICLE_ASSET_FIELD_UNITTEST_TOLERANCE );
+
+    pParticleAsset->deleteObject();
+    taml.unregisterObject();
+
+    ASSERT_TRUE( Platform::fileDelete( PARTICLE_ASSET_FIELD_UNITTEST_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BakedDegenerateTimeTest )
+{
+    ParticleAssetField field;
+    field.setFieldName( "DegenerateTest" );
+    field.setBakedEvaluation( true );
+
+    // A single key is constant so is never baked.
+    field.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+    ASSERT_EQ( field.setSingleDataKey( 4.0f ), 0 );
+    ASSERT_FALSE( field.isBaked() );
+    ASSERT_EQ( field.getFieldValue( 0.5f ), 4.0f );
+
+    // A time range too small to sample must use the exact evaluation.
+    // NOTE:-   The smallest denormal time gives a zero sample time and a scale that is not finite.
+    const F32 minimumTime = 1.401298464e-45f;
+    field.initialize( minimumTime, 0.0f, 10.0f, 1.0f );
+    field.clearDataKeys();
+    ASSERT_EQ( field.addDataKey( 0.0f, 2.0f ), 0 );
+    ASSERT_EQ( field.addDataKey( minimumTime, 6.0f ), 1 );
+    ASSERT_FALSE( field.isBaked() );
+    ASSERT_EQ( field.getFieldValue( 0.0f ), field.getExactFieldValue( 0.0f ) );
+    ASSERT_EQ( field.getFieldValue( minimumTime ), field.getExactFieldValue( minimumTime ) );
+
+    // A sampleable time range bakes again.
+    field.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+    ASSERT_EQ( field.addDataKey( 1.0f, 6.0f ), 2 );
+    ASSERT_TRUE( field.isBaked() );
+    ASSERT_NEAR( field.getFieldValue( 1.0f ), field.getExactFieldValue( 1.0f ), PARTICLE_ASSET_FIELD_UNITTEST_TOLERANCE );
+}
+
+#endif // TORQUE_SHIPPING
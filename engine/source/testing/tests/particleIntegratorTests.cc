@@ -0,0 +1,284 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_INTEGRATOR_H_
+#include "2d/core/ParticleIntegrator.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+#ifndef _PLATFORM_TIMER_H_
+#include "platform/platformTimer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Deliberately not a multiple of the batch or vector width so the scalar tails are exercised.
+#define PARTICLE_UNITTEST_INTEGRATOR_PARTICLECOUNT      10007
+#define PARTICLE_UNITTEST_INTEGRATOR_TICKCOUNT          8
+#define PARTICLE_UNITTEST_INTEGRATOR_TOLERANCE          1.0e-4f
+#define PARTICLE_UNITTEST_INTEGRATOR_BENCHMARKCOUNT     100
+
+//-----------------------------------------------------------------------------
+
+static void populateParticleStore( ParticleSystem::ParticleStore& particleStore, const S32 seed )
+{
+    // Use a fixed seed so each store is identical.
+    RandomLCG random( seed );
+
+    for( U32 index = 0; index < PARTICLE_UNITTEST_INTEGRATOR_PARTICLECOUNT; ++index )
+    {
+        const U32 particleIndex = particleStore.createParticle();
+
+        particleStore.mParticleLifetime[particleIndex] = random.randRangeF( 1.0f, 5.0f );
+        particleStore.mParticleAge[particleIndex] = random.randRangeF( 0.0f, 1.0f );
+        particleStore.mPositionX[particleIndex] = random.randRangeF( -50.0f, 50.0f );
+        particleStore.mPositionY[particleIndex] = random.randRangeF( -50.0f, 50.0f );
+        particleStore.mVelocityX[particleIndex] = random.randRangeF( -5.0f, 5.0f );
+        particleStore.mVelocityY[particleIndex] = random.randRangeF( -5.0f, 5.0f );
+        particleStore.mOrientationAngle[particleIndex] = random.randRangeF( 0.0f, 360.0f );
+        particleStore.mSizeX[particleIndex] = random.randRangeF( 0.5f, 2.0f );
+        particleStore.mSizeY[particleIndex] = random.randRangeF( 0.5f, 2.0f );
+        particleStore.mSpeed[particleIndex] = random.randRangeF( 0.5f, 2.0f );
+        particleStore.mSpin[particleIndex] = random.randRangeF( -90.0f, 90.0f );
+        // Leave some fixed forces at zero so the masked force path is exercised.
+        particleStore.mFixedForce[particleIndex] = (index % 3) == 0 ? 0.0f : random.randRangeF( -10.0f, 10.0f );
+        particleStore.mRandomMotion[particleIndex] = 0.0f;
+        particleStore.mPostTickPositionX[particleIndex] = particleStore.mPositionX[particleIndex];
+        particleStore.mPostTickPositionY[particleIndex] = particleStore.mPositionY[particleIndex];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+class ParticleIntegratorTestPlayer : public ParticlePlayer
+{
+public:
+    ParticleIntegratorTestPlayer( ParticleAssetEmitter* pParticleAssetEmitter ) :
+        mLegacyEmitterNode( this, pParticleAssetEmitter ),
+        mBatchEmitterNode( this, pParticleAssetEmitter )
+    {
+        populateParticleStore( mLegacyEmitterNode.getParticleStore(), 1234 );
+        populateParticleStore( mBatchEmitterNode.getParticleStore(), 1234 );
+    }
+
+    inline ParticleSystem::ParticleStore& getLegacyParticleStore( void ) { return mLegacyEmitterNode.getParticleStore(); }
+    inline ParticleSystem::ParticleStore& getBatchParticleStore( void ) { return mBatchEmitterNode.getParticleStore(); }
+
+    void integrateLegacy( const F32 elapsedTime )
+    {
+        // Integrate each particle as the player did before the batch integrator.
+        ParticleSystem::ParticleStore& particleStore = mLegacyEmitterNode.getParticleStore();
+        for( U32 particleIndex = 0; particleIndex < particleStore.getCount(); ++particleIndex )
+        {
+            integrateParticle( &mLegacyEmitterNode, particleIndex, particleStore.mParticleAge[particleIndex] / particleStore.mParticleLifetime[particleIndex], elapsedTime );
+        }
+    }
+
+    void integrateBatch( const F32 elapsedTime )
+    {
+        integrateParticles( &mBatchEmitterNode, elapsedTime );
+    }
+
+private:
+    EmitterNode mLegacyEmitterNode;
+    EmitterNode mBatchEmitterNode;
+};
+
+//-----------------------------------------------------------------------------
+
+static void configureEmitter( ParticleAssetEmitter* pParticleAssetEmitter )
+{
+    pParticleAssetEmitter->setFixedForceAngle( -90.0f );
+
+    // Give the life fields a shape so each particle age samples something different.
+    pParticleAssetEmitter->getSizeXLifeField().addDataKey( 1.0f, 0.5f );
+    pParticleAssetEmitter->getSizeYLifeField().addDataKey( 1.0f, 2.0f );
+    pParticleAssetEmitter->getSpeedLifeField().addDataKey( 0.5f, 1.5f );
+    pParticleAssetEmitter->getSpinLifeField().addDataKey( 1.0f, 0.25f );
+    pParticleAssetEmitter->getFixedForceLifeField().addDataKey( 1.0f, 2.0f );
+    pParticleAssetEmitter->getRedChannelLifeField().addDataKey( 1.0f, 0.0f );
+    pParticleAssetEmitter->getGreenChannelLifeField().addDataKey( 0.5f, 0.25f );
+    pParticleAssetEmitter->getAlphaChannelLifeField().addDataKey( 1.0f, 0.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+static void compareStreams( const F32* pExpected, const F32* pActual, const U32 count, const char* pStreamName )
+{
+    for( U32 index = 0; index < count; ++index )
+    {
+        const F32 tolerance = PARTICLE_UNITTEST_INTEGRATOR_TOLERANCE * getMax( 1.0f, mFabs(pExpected[index]) );
+        ASSERT_NEAR( pExpected[index], pActual[index], tolerance ) << "Stream '" << pStreamName << "' differs at particle " << index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegratorTests, LegacyMatchTest )
+{
+    const ParticleIntegrator::InstructionSet bestInstructionSet = ParticleIntegrator::getBestInstructionSet();
+    const ParticleIntegrator::InstructionSet previousInstructionSet = ParticleIntegrator::getInstructionSet();
+
+    // Create a private particle asset with a single emitter.
+    ParticleAsset* pParticleAsset = new ParticleAsset();
+    ASSERT_TRUE( pParticleAsset->registerObject() );
+    ParticleAssetEmitter* pParticleAssetEmitter = pParticleAsset->createEmitter();
+    ASSERT_TRUE( pParticleAssetEmitter != NULL );
+    configureEmitter( pParticleAssetEmitter );
+    pParticleAsset->getAlphaChannelScaleField().setSingleDataKey( 0.75f );
+    StringTableEntry assetId = AssetDatabase.addPrivateAsset( pParticleAsset );
+    ASSERT_NE( assetId, StringTable->EmptyString );
+
+    // Hold the asset so it outlives each player.
+    AssetPtr<ParticleAsset> particleAsset( assetId );
+
+    // Check each instruction set available against the per-particle integration.
+    for( U32 instructionSet = ParticleIntegrator::INSTRUCTION_SET_SCALAR; instructionSet <= (U32)bestInstructionSet; ++instructionSet )
+    {
+        ASSERT_TRUE( ParticleIntegrator::setInstructionSet( (ParticleIntegrator::InstructionSet)instructionSet ) );
+
+        ParticleIntegratorTestPlayer* pParticlePlayer = new ParticleIntegratorTestPlayer( pParticleAssetEmitter );
+        pParticlePlayer->setParticle( assetId );
+
+        for( U32 tick = 0; tick < PARTICLE_UNITTEST_INTEGRATOR_TICKCOUNT; ++tick )
+        {
+            pParticlePlayer->integrateLegacy( 1.0f / 60.0f );
+            pParticlePlayer->integrateBatch( 1.0f / 60.0f );
+        }
+
+        const ParticleSystem::ParticleStore& legacyStore = pParticlePlayer->getLegacyParticleStore();
+        const ParticleSystem::ParticleStore& batchStore = pParticlePlayer->getBatchParticleStore();
+        const U32 count = legacyStore.getCount();
+        ASSERT_EQ( batchStore.getCount(), count );
+        compareStreams( legacyStore.mPositionX, batchStore.mPositionX, count, "PositionX" );
+        compareStreams( legacyStore.mPositionY, batchStore.mPositionY, count, "PositionY" );
+        compareStreams( legacyStore.mVelocityX, batchStore.mVelocityX, count, "VelocityX" );
+        compareStreams( legacyStore.mVelocityY, batchStore.mVelocityY, count, "VelocityY" );
+        compareStreams( legacyStore.mOrientationAngle, batchStore.mOrientationAngle, count, "OrientationAngle" );
+        compareStreams( legacyStore.mRenderSizeX, batchStore.mRenderSizeX, count, "RenderSizeX" );
+        compareStreams( legacyStore.mRenderSizeY, batchStore.mRenderSizeY, count, "RenderSizeY" );
+        compareStreams( legacyStore.mRenderSpeed, batchStore.mRenderSpeed, count, "RenderSpeed" );
+        compareStreams( legacyStore.mRenderFixedForce, batchStore.mRenderFixedForce, count, "RenderFixedForce" );
+        compareStreams( legacyStore.mRenderRandomMotion, batchStore.mRenderRandomMotion, count, "RenderRandomMotion" );
+        compareStreams( legacyStore.mColorRed, batchStore.mColorRed, count, "ColorRed" );
+        compareStreams( legacyStore.mColorGreen, batchStore.mColorGreen, count, "ColorGreen" );
+        compareStreams( legacyStore.mColorBlue, batchStore.mColorBlue, count, "ColorBlue" );
+        compareStreams( legacyStore.mColorAlpha, batchStore.mColorAlpha, count, "ColorAlpha" );
+        compareStreams( legacyStore.mPreTickPositionX, batchStore.mPreTickPositionX, count, "PreTickPositionX" );
+        compareStreams( legacyStore.mPreTickPositionY, batchStore.mPreTickPositionY, count, "PreTickPositionY" );
+        compareStreams( legacyStore.mPostTickPositionX, batchStore.mPostTickPositionX, count, "PostTickPositionX" );
+        compareStreams( legacyStore.mPostTickPositionY, batchStore.mPostTickPositionY, count, "PostTickPositionY" );
+        for( U32 corner = 0; corner < 4; ++corner )
+        {
+            compareStreams( legacyStore.mRenderOOBBX[corner], batchStore.mRenderOOBBX[corner], count, "RenderOOBBX" );
+            compareStreams( legacyStore.mRenderOOBBY[corner], batchStore.mRenderOOBBY[corner], count, "RenderOOBBY" );
+        }
+
+        delete pParticlePlayer;
+    }
+
+    // Releasing the private asset removes it.
+    particleAsset.clear();
+    ASSERT_FALSE( AssetDatabase.isDeclaredAsset( assetId ) );
+
+    ParticleIntegrator::setInstructionSet( previousInstructionSet );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegratorTests, ThroughputBenchmark )
+{
+    const ParticleIntegrator::InstructionSet bestInstructionSet = ParticleIntegrator::getBestInstructionSet();
+    const ParticleIntegrator::InstructionSet previousInstructionSet = ParticleIntegrator::getInstructionSet();
+
+    // Create a private particle asset with a single emitter.
+    ParticleAsset* pParticleAsset = new ParticleAsset();
+    ASSERT_TRUE( pParticleAsset->registerObject() );
+    ParticleAssetEmitter* pParticleAssetEmitter = pParticleAsset->createEmitter();
+    ASSERT_TRUE( pParticleAssetEmitter != NULL );
+    configureEmitter( pParticleAssetEmitter );
+    StringTableEntry assetId = AssetDatabase.addPrivateAsset( pParticleAsset );
+    ASSERT_NE( assetId, StringTable->EmptyString );
+
+    // Hold the asset so it outlives each player.
+    AssetPtr<ParticleAsset> particleAsset( assetId );
+
+    PlatformTimer timer;
+    const U32 particleCount = PARTICLE_UNITTEST_INTEGRATOR_PARTICLECOUNT * PARTICLE_UNITTEST_INTEGRATOR_BENCHMARKCOUNT;
+
+    // Time the per-particle and batch integration of the same emitter with each instruction set available.
+    for( U32 instructionSet = ParticleIntegrator::INSTRUCTION_SET_SCALAR; instructionSet <= (U32)bestInstructionSet; ++instructionSet )
+    {
+        ASSERT_TRUE( ParticleIntegrator::setInstructionSet( (ParticleIntegrator::InstructionSet)instructionSet ) );
+        const char* pInstructionSetDescription = ParticleIntegrator::getInstructionSetDescription( (ParticleIntegrator::InstructionSet)instructionSet );
+
+        ParticleIntegratorTestPlayer* pParticlePlayer = new ParticleIntegratorTestPlayer( pParticleAssetEmitter );
+        pParticlePlayer->setParticle( assetId );
+
+        timer.reset();
+        for( U32 tick = 0; tick < PARTICLE_UNITTEST_INTEGRATOR_BENCHMARKCOUNT; ++tick )
+            pParticlePlayer->integrateLegacy( 1.0f / 60.0f );
+        const F32 legacyTime = getMax( timer.getElapsedMs(), 0.001f );
+
+        timer.reset();
+        for( U32 tick = 0; tick < PARTICLE_UNITTEST_INTEGRATOR_BENCHMARKCOUNT; ++tick )
+            pParticlePlayer->integrateBatch( 1.0f / 60.0f );
+        const F32 batchTime = getMax( timer.getElapsedMs(), 0.001f );
+
+        // Integration must not change the particle count.
+        ASSERT_EQ( pParticlePlayer->getLegacyParticleStore().getCount(), (U32)PARTICLE_UNITTEST_INTEGRATOR_PARTICLECOUNT );
+        ASSERT_EQ( pParticlePlayer->getBatchParticleStore().getCount(), (U32)PARTICLE_UNITTEST_INTEGRATOR_PARTICLECOUNT );
+
+        RecordProperty( avar( "%sLegacyParticlesPerMs", pInstructionSetDescription ), (int)(particleCount / legacyTime) );
+        RecordProperty( avar( "%sBatchParticlesPerMs", pInstructionSetDescription ), (int)(particleCount / batchTime) );
+
+        delete pParticlePlayer;
+    }
+
+    particleAsset.clear();
+
+    ParticleIntegrator::setInstructionSet( previousInstructionSet );
+}
+
+#endif // TORQUE_SHIPPING
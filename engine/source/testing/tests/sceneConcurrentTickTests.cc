@@ -0,0 +1,227 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_UNITTEST_TICK_OBJECTCOUNT     1024
+#define SCENE_UNITTEST_TICK_COUNT           120
+#define SCENE_UNITTEST_TICK_MAINTHREADSTEP  37
+
+//-----------------------------------------------------------------------------
+
+static Scene* createTickTestScene( const bool concurrentTick )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2( 0.0f, -9.8f ) );
+    pScene->setConcurrentTick( concurrentTick );
+
+    // Add a floor for the bodies to land on.
+    SceneObject* pFloor = new SceneObject();
+    pFloor->registerObject();
+    pFloor->setBodyType( b2_staticBody );
+    pFloor->createPolygonBoxCollisionShape( 100.0f, 1.0f );
+    pScene->addToScene( pFloor );
+    pFloor->setPosition( Vector2( 32.0f, -10.0f ) );
+
+    // Populate the scene with colliding bodies.
+    for( U32 index = 0; index < SCENE_UNITTEST_TICK_OBJECTCOUNT; ++index )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->registerObject();
+        pSceneObject->setBodyType( b2_dynamicBody );
+        pSceneObject->setSize( Vector2( 1.0f + (index % 7) * 0.25f, 1.0f + (index % 5) * 0.5f ) );
+        if ( (index % 2) == 0 )
+            pSceneObject->createPolygonBoxCollisionShape( pSceneObject->getSize().x, pSceneObject->getSize().y );
+        else
+            pSceneObject->createCircleCollisionShape( pSceneObject->getSize().x * 0.5f );
+
+        // A long lifetime forces integration on the main thread without ever expiring.
+        if ( (index % SCENE_UNITTEST_TICK_MAINTHREADSTEP) == 0 )
+            pSceneObject->setLifetime( 1000.0f );
+
+        pScene->addToScene( pSceneObject );
+        pSceneObject->setPosition( Vector2( (F32)(index % 32) * 2.0f, (F32)(index / 32) * 2.0f ) );
+        pSceneObject->setLinearVelocity( Vector2( (F32)(index % 11) - 5.0f, (F32)(index % 13) - 6.0f ) );
+        pSceneObject->setAngularVelocity( (F32)(index % 3) - 1.0f );
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+class SceneTickOrderTestObject : public SceneObject
+{
+public:
+    SceneTickOrderTestObject( const bool mainThreadOnly ) :
+        mMainThreadOnly( mainThreadOnly ),
+        mpTickOrder( NULL ),
+        mIntegrateCount( 0 ),
+        mOrderErrors( 0 )
+    {
+    }
+
+    virtual bool getConcurrentTickAllowed( const Scene::TickStage tickStage ) const
+    {
+        return !mMainThreadOnly && SceneObject::getConcurrentTickAllowed( tickStage );
+    }
+
+    virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+    {
+        SceneObject::integrateObject( totalTime, elapsedTime, pDebugStats );
+
+        // Objects on the main thread must find every object before them integrated and none after them.
+        if ( mMainThreadOnly && mpTickOrder != NULL )
+        {
+            U32 expectedCount = mIntegrateCount + 1;
+            for( U32 index = 0; index < (U32)mpTickOrder->size(); ++index )
+            {
+                const SceneTickOrderTestObject* pSceneObject = static_cast<const SceneTickOrderTestObject*>( (*mpTickOrder)[index] );
+                if ( pSceneObject == this )
+                {
+                    expectedCount = mIntegrateCount;
+                    continue;
+                }
+
+                if ( pSceneObject->mIntegrateCount != expectedCount )
+                    mOrderErrors++;
+            }
+        }
+
+        mIntegrateCount++;
+    }
+
+    bool                            mMainThreadOnly;
+    const typeSceneObjectVector*    mpTickOrder;
+    U32                             mIntegrateCount;
+    U32                             mOrderErrors;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneConcurrentTickTests, DeterminismTest )
+{
+    // Create a serial and a concurrent scene.
+    Scene* pSerialScene = createTickTestScene( false );
+    Scene* pConcurrentScene = createTickTestScene( true );
+
+    // Tick both scenes.
+    for( U32 tick = 0; tick < SCENE_UNITTEST_TICK_COUNT; ++tick )
+    {
+        pSerialScene->processTick();
+        pConcurrentScene->processTick();
+    }
+
+    // Fetch the scene objects.
+    typeSceneObjectVector serialObjects;
+    typeSceneObjectVector concurrentObjects;
+    pSerialScene->getSceneObjects( serialObjects );
+    pConcurrentScene->getSceneObjects( concurrentObjects );
+
+    // Check.
+    ASSERT_EQ( serialObjects.size(), concurrentObjects.size() ) << "Scene object counts differ.";
+    ASSERT_GT( pSerialScene->getWorld()->GetContactCount(), 0 ) << "The bodies never collided.";
+
+    // Both scenes must have integrated identically.
+    for( U32 index = 0; index < (U32)serialObjects.size(); ++index )
+    {
+        const SceneObject* pSerialObject = serialObjects[index];
+        const SceneObject* pConcurrentObject = concurrentObjects[index];
+
+        const Vector2 serialPosition = pSerialObject->getPosition();
+        const Vector2 concurrentPosition = pConcurrentObject->getPosition();
+        ASSERT_EQ( serialPosition.x, concurrentPosition.x ) << "Position differs at object " << index;
+        ASSERT_EQ( serialPosition.y, concurrentPosition.y ) << "Position differs at object " << index;
+        ASSERT_EQ( pSerialObject->getAngle(), pConcurrentObject->getAngle() ) << "Angle differs at object " << index;
+
+        const Vector2 serialVelocity = pSerialObject->getLinearVelocity();
+        const Vector2 concurrentVelocity = pConcurrentObject->getLinearVelocity();
+        ASSERT_EQ( serialVelocity.x, concurrentVelocity.x ) << "Velocity differs at object " << index;
+        ASSERT_EQ( serialVelocity.y, concurrentVelocity.y ) << "Velocity differs at object " << index;
+
+        const b2AABB serialAABB = pSerialObject->getAABB();
+        const b2AABB concurrentAABB = pConcurrentObject->getAABB();
+        ASSERT_EQ( serialAABB.lowerBound.x, concurrentAABB.lowerBound.x ) << "AABB differs at object " << index;
+        ASSERT_EQ( serialAABB.lowerBound.y, concurrentAABB.lowerBound.y ) << "AABB differs at object " << index;
+        ASSERT_EQ( serialAABB.upperBound.x, concurrentAABB.upperBound.x ) << "AABB differs at object " << index;
+        ASSERT_EQ( serialAABB.upperBound.y, concurrentAABB.upperBound.y ) << "AABB differs at object " << index;
+    }
+
+    // Destroy the scenes.
+    pSerialScene->deleteObject();
+    pConcurrentScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneConcurrentTickTests, TickOrderTest )
+{
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setConcurrentTick( true );
+
+    // Scatter main-thread objects between runs of concurrent ones.
+    for( U32 index = 0; index < SCENE_UNITTEST_TICK_OBJECTCOUNT; ++index )
+    {
+        SceneTickOrderTestObject* pSceneObject = new SceneTickOrderTestObject( (index % SCENE_UNITTEST_TICK_MAINTHREADSTEP) == 0 );
+        pSceneObject->registerObject();
+        pSceneObject->createCircleCollisionShape( 0.5f );
+        pScene->addToScene( pSceneObject );
+    }
+
+    typeSceneObjectVector tickOrder;
+    pScene->getSceneObjects( tickOrder );
+    for( U32 index = 0; index < (U32)tickOrder.size(); ++index )
+        static_cast<SceneTickOrderTestObject*>( tickOrder[index] )->mpTickOrder = &tickOrder;
+
+    for( U32 tick = 0; tick < SCENE_UNITTEST_TICK_COUNT; ++tick )
+        pScene->processTick();
+
+    // Every object ticked every time and the main-thread objects saw the serial order.
+    for( U32 index = 0; index < (U32)tickOrder.size(); ++index )
+    {
+        const SceneTickOrderTestObject* pSceneObject = static_cast<const SceneTickOrderTestObject*>( tickOrder[index] );
+        ASSERT_EQ( pSceneObject->mIntegrateCount, (U32)SCENE_UNITTEST_TICK_COUNT ) << "Tick count differs at object " << index;
+        ASSERT_EQ( pSceneObject->mOrderErrors, (U32)0 ) << "Tick order differs at object " << index;
+    }
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
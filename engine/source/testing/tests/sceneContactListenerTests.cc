@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class TestContactListener : public SceneContactListener
+{
+public:
+    TestContactListener() : mBeginContactCount(0), mEndContactCount(0), mObjectIdA(0), mObjectIdB(0) {}
+
+    virtual void onSceneContacts( Scene* pScene, const SceneContact* pBeginContacts, const U32 beginContactCount, const SceneContact* pEndContacts, const U32 endContactCount )
+    {
+        mBeginContactCount += beginContactCount;
+        mEndContactCount += endContactCount;
+
+        if ( beginContactCount > 0 )
+        {
+            mObjectIdA = pBeginContacts[0].mSceneObjectIdA;
+            mObjectIdB = pBeginContacts[0].mSceneObjectIdB;
+        }
+    }
+
+    U32 mBeginContactCount;
+    U32 mEndContactCount;
+    SimObjectId mObjectIdA;
+    SimObjectId mObjectIdB;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneContactListenerTests, BatchedContactsTest )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setBatchContactCallback( true );
+
+    // Add two overlapping objects.
+    SceneObject* pSceneObjects[2];
+    for( U32 index = 0; index < 2; ++index )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->registerObject();
+        pSceneObject->setBodyType( b2_dynamicBody );
+        pSceneObject->createPolygonBoxCollisionShape( 2.0f, 2.0f );
+        pSceneObject->setCollisionCallback( true );
+        pScene->addToScene( pSceneObject );
+        pSceneObject->setPosition( Vector2( (F32)index, 0.0f ) );
+        pSceneObjects[index] = pSceneObject;
+    }
+
+    TestContactListener listener;
+    pScene->addContactListener( &listener );
+
+    // Tick the scene.
+    pScene->processTick();
+
+    // The contact should have been delivered natively and kept for script.
+    ASSERT_EQ( 1U, listener.mBeginContactCount );
+    ASSERT_EQ( 1, pScene->getTickBeginContacts().size() );
+    ASSERT_TRUE(
+        (listener.mObjectIdA == pSceneObjects[0]->getId() && listener.mObjectIdB == pSceneObjects[1]->getId()) ||
+        (listener.mObjectIdA == pSceneObjects[1]->getId() && listener.mObjectIdB == pSceneObjects[0]->getId()) );
+
+    // Removed listeners are no longer informed.
+    pScene->removeContactListener( &listener );
+    pSceneObjects[1]->setPosition( Vector2( 10.0f, 0.0f ) );
+    pScene->processTick();
+    ASSERT_EQ( 0U, listener.mEndContactCount );
+
+    // Destroy the scene.
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,212 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+
+struct SimDictionaryTestReader
+{
+    SimIdDictionary*    mpDictionary;
+    SimObjectId         mId;
+    std::atomic<bool>   mFound;
+    std::atomic<bool>   mRemoving;
+    std::atomic<bool>   mLeft;
+    SimObjectId         mFoundId;
+};
+
+//-----------------------------------------------------------------------------
+
+static void simDictionaryTestReaderFunction( void* pArg )
+{
+    SimDictionaryTestReader* pReader = (SimDictionaryTestReader*)pArg;
+
+    {
+        // Hold what the lookup returns whilst the object is removed.
+        SimDictionaryEpoch::ReadScope readScope;
+        SimObject* pObject = pReader->mpDictionary->find( pReader->mId );
+        pReader->mFound.store( true );
+
+        while( !pReader->mRemoving.load() )
+            Platform::sleep( 1 );
+        Platform::sleep( 50 );
+
+        pReader->mFoundId = pObject ? pObject->getId() : 0;
+        pReader->mLeft.store( true );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, IdDictionaryTest )
+{
+    SimIdDictionary dictionary;
+
+    // Ids spread over several pages as well as one beyond the dense range.
+    const SimObjectId ids[] = { 5, 4100, 123456, 1 << 25 };
+    const U32 idCount = sizeof(ids) / sizeof(SimObjectId);
+
+    SimObject* pObjects[idCount];
+    for ( U32 index = 0; index < idCount; ++index )
+    {
+        pObjects[index] = new SimObject();
+        pObjects[index]->setId( ids[index] );
+        dictionary.insert( pObjects[index] );
+    }
+
+    for ( U32 index = 0; index < idCount; ++index )
+        ASSERT_EQ( pObjects[index], dictionary.find( ids[index] ) );
+
+    ASSERT_TRUE( dictionary.find( 6 ) == NULL );
+    ASSERT_TRUE( dictionary.find( -1 ) == NULL );
+
+    // The newest object registered with an id wins until it is removed.
+    SimObject* pDuplicate = new SimObject();
+    pDuplicate->setId( ids[0] );
+    dictionary.insert( pDuplicate );
+    ASSERT_EQ( pDuplicate, dictionary.find( ids[0] ) );
+    dictionary.remove( pDuplicate );
+    ASSERT_EQ( pObjects[0], dictionary.find( ids[0] ) );
+    delete pDuplicate;
+
+    for ( U32 index = 0; index < idCount; ++index )
+    {
+        dictionary.remove( pObjects[index] );
+        ASSERT_TRUE( dictionary.find( ids[index] ) == NULL );
+        delete pObjects[index];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, NameDictionaryTest )
+{
+    SimNameDictionary dictionary;
+
+    // Enough names to grow the table a few times.
+    const U32 objectCount = 200;
+    SimObject* pObjects[objectCount];
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        pObjects[index] = new SimObject();
+        pObjects[index]->assignName( avar( "SimDictionaryTestObject%d", index ) );
+        dictionary.insert( pObjects[index] );
+    }
+
+    // Remove every other object.
+    for ( U32 index = 0; index < objectCount; index += 2 )
+        dictionary.remove( pObjects[index] );
+
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        SimObject* pFound = dictionary.find( pObjects[index]->getName() );
+        ASSERT_EQ( (index & 1) ? pObjects[index] : NULL, pFound );
+    }
+
+    for ( U32 index = 1; index < objectCount; index += 2 )
+        dictionary.remove( pObjects[index] );
+
+    for ( U32 index = 0; index < objectCount; ++index )
+        delete pObjects[index];
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, DuplicateNameTest )
+{
+    SimNameDictionary dictionary;
+
+    // Objects that are not registered can share a name.
+    SimObject* pObjects[3];
+    for ( U32 index = 0; index < 3; ++index )
+    {
+        pObjects[index] = new SimObject();
+        pObjects[index]->assignName( "SimDictionaryTestDuplicate" );
+        dictionary.insert( pObjects[index] );
+    }
+
+    StringTableEntry name = StringTable->insert( "SimDictionaryTestDuplicate" );
+
+    // The newest object is found first.
+    ASSERT_EQ( pObjects[2], dictionary.find( name ) );
+    dictionary.remove( pObjects[2] );
+    ASSERT_EQ( pObjects[1], dictionary.find( name ) );
+    dictionary.remove( pObjects[1] );
+    ASSERT_EQ( pObjects[0], dictionary.find( name ) );
+    dictionary.remove( pObjects[0] );
+    ASSERT_TRUE( dictionary.find( name ) == NULL );
+
+    for ( U32 index = 0; index < 3; ++index )
+        delete pObjects[index];
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, ReadScopeTest )
+{
+    SimIdDictionary dictionary;
+
+    SimObject* pObject = new SimObject();
+    pObject->setId( 42 );
+    dictionary.insert( pObject );
+
+    SimDictionaryTestReader reader;
+    reader.mpDictionary = &dictionary;
+    reader.mId = 42;
+    reader.mFound.store( false );
+    reader.mRemoving.store( false );
+    reader.mLeft.store( false );
+    reader.mFoundId = 0;
+
+    Thread* pThread = new Thread( &simDictionaryTestReaderFunction, &reader, true );
+    while( !reader.mFound.load() )
+        Platform::sleep( 1 );
+
+    // Removing must wait for the reader to leave its scope before the object can be deleted.
+    reader.mRemoving.store( true );
+    dictionary.remove( pObject );
+    ASSERT_TRUE( reader.mLeft.load() );
+    ASSERT_TRUE( dictionary.find( 42 ) == NULL );
+    delete pObject;
+
+    pThread->join();
+    delete pThread;
+
+    ASSERT_EQ( (U32)42, (U32)reader.mFoundId );
+}
+
+#endif // TORQUE_SHIPPING
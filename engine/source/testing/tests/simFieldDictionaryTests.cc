@@ -0,0 +1,182 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIM_FIELD_DICTIONARY_H_
+#include "sim/simFieldDictionary.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _PLATFORM_TIMER_H_
+#include "platform/platformTimer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT         100
+#define SIM_UNITTEST_FIELDDICTIONARY_OVERWRITECOUNT     1000
+#define SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT     200000
+
+//-----------------------------------------------------------------------------
+
+static void createFieldNames( StringTableEntry* pFieldNames, const U32 fieldCount )
+{
+    for( U32 index = 0; index < fieldCount; ++index )
+        pFieldNames[index] = StringTable->insert( avar( "fieldDictionaryTest%d", index ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, SetGetRemoveTest )
+{
+    StringTableEntry fieldNames[SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT];
+    createFieldNames( fieldNames, SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT );
+
+    SimFieldDictionary dictionary;
+
+    // Add fields one at a time so both the inline and table storage are exercised.
+    for( U32 index = 0; index < SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT; ++index )
+    {
+        dictionary.setFieldValue( fieldNames[index], avar( "%d", index ) );
+        ASSERT_EQ( index + 1, dictionary.getFieldCount() );
+
+        for( U32 check = 0; check <= index; ++check )
+            ASSERT_STREQ( avar( "%d", check ), dictionary.getFieldValue( fieldNames[check] ) );
+    }
+
+    // Overwriting a field does not add another.
+    dictionary.setFieldValue( fieldNames[0], "overwritten" );
+    ASSERT_STREQ( "overwritten", dictionary.getFieldValue( fieldNames[0] ) );
+    ASSERT_EQ( (U32)SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT, dictionary.getFieldCount() );
+
+    // An empty value removes the field.
+    for( U32 index = 0; index < SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT; index += 3 )
+        dictionary.setFieldValue( fieldNames[index], "" );
+
+    U32 iteratedCount = 0;
+    for( SimFieldDictionaryIterator itr( &dictionary ); *itr; ++itr )
+        iteratedCount++;
+    ASSERT_EQ( dictionary.getFieldCount(), iteratedCount );
+
+    for( U32 index = 1; index < SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT; ++index )
+    {
+        const char* pValue = dictionary.getFieldValue( fieldNames[index] );
+        if ( (index % 3) == 0 )
+            ASSERT_TRUE( pValue == NULL );
+        else
+            ASSERT_STREQ( avar( "%d", index ), pValue );
+    }
+
+    // Copying keeps every field.
+    SimFieldDictionary copy;
+    copy.assignFrom( &dictionary );
+    ASSERT_EQ( dictionary.getFieldCount(), copy.getFieldCount() );
+    for( SimFieldDictionaryIterator itr( &dictionary ); *itr; ++itr )
+        ASSERT_STREQ( (*itr)->value, copy.getFieldValue( (*itr)->slotName ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, OverwriteTest )
+{
+    StringTableEntry fieldNames[SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT];
+    createFieldNames( fieldNames, SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT );
+
+    // Repeatedly overwriting fields must neither add nor lose any, whether stored inline or in the table.
+    const U32 fieldCounts[] = { 1, 10, 100 };
+    for( U32 countIndex = 0; countIndex < sizeof(fieldCounts) / sizeof(U32); ++countIndex )
+    {
+        const U32 fieldCount = fieldCounts[countIndex];
+
+        SimFieldDictionary dictionary;
+        for( U32 index = 0; index < fieldCount; ++index )
+            dictionary.setFieldValue( fieldNames[index], "1" );
+
+        for( U32 iteration = 0; iteration < SIM_UNITTEST_FIELDDICTIONARY_OVERWRITECOUNT; ++iteration )
+        {
+            const StringTableEntry fieldName = fieldNames[iteration % fieldCount];
+            const char* pValue = (iteration & 1) ? "1" : "0";
+            dictionary.setFieldValue( fieldName, pValue );
+            ASSERT_STREQ( pValue, dictionary.getFieldValue( fieldName ) );
+        }
+
+        ASSERT_EQ( fieldCount, dictionary.getFieldCount() );
+        for( U32 index = 0; index < fieldCount; ++index )
+            ASSERT_TRUE( dictionary.getFieldValue( fieldNames[index] ) != NULL );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, ThroughputBenchmark )
+{
+    StringTableEntry fieldNames[SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT];
+    createFieldNames( fieldNames, SIM_UNITTEST_FIELDDICTIONARY_FIELDCOUNT );
+
+    // Record get and set throughput for objects with few and many fields.
+    const U32 fieldCounts[] = { 1, 10, 100 };
+    for( U32 countIndex = 0; countIndex < sizeof(fieldCounts) / sizeof(U32); ++countIndex )
+    {
+        const U32 fieldCount = fieldCounts[countIndex];
+
+        SimFieldDictionary dictionary;
+        for( U32 index = 0; index < fieldCount; ++index )
+            dictionary.setFieldValue( fieldNames[index], "1" );
+
+        PlatformTimer timer;
+        timer.reset();
+        U32 foundCount = 0;
+        for( U32 iteration = 0; iteration < SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT; ++iteration )
+        {
+            if ( dictionary.getFieldValue( fieldNames[iteration % fieldCount] ) != NULL )
+                foundCount++;
+        }
+        const F64 getElapsedMs = getMax( (F64)timer.getElapsedMs(), 1.0e-3 );
+        ASSERT_EQ( (U32)SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT, foundCount );
+
+        timer.reset();
+        for( U32 iteration = 0; iteration < SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT; ++iteration )
+        {
+            dictionary.setFieldValue( fieldNames[iteration % fieldCount], (iteration & 1) ? "1" : "0" );
+        }
+        const F64 setElapsedMs = getMax( (F64)timer.getElapsedMs(), 1.0e-3 );
+        ASSERT_EQ( fieldCount, dictionary.getFieldCount() );
+
+        RecordProperty( avar( "Fields%dGetsPerMs", fieldCount ), (int)(SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT / getElapsedMs) );
+        RecordProperty( avar( "Fields%dSetsPerMs", fieldCount ), (int)(SIM_UNITTEST_FIELDDICTIONARY_BENCHMARKCOUNT / setElapsedMs) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
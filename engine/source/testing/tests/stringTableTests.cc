@@ -0,0 +1,171 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_TIMER_H_
+#include "platform/platformTimer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define STRINGTABLE_UNITTEST_MAX_THREADS        16
+#define STRINGTABLE_UNITTEST_STRING_COUNT       20000
+#define STRINGTABLE_UNITTEST_INSERTS_PER_THREAD 100000
+
+//-----------------------------------------------------------------------------
+
+struct StringTableTestWorker
+{
+    U32                 mRun;
+    U32                 mThreadIndex;
+    U32                 mInsertCount;
+    StringTableEntry*   mpResults;
+};
+
+//-----------------------------------------------------------------------------
+
+static void stringTableTestWorkerFunction( void* pArg )
+{
+    StringTableTestWorker* pWorker = (StringTableTestWorker*)pArg;
+
+    // Every thread inserts the same set of strings in a different order and case.
+    char buffer[64];
+    for( U32 index = 0; index < pWorker->mInsertCount; ++index )
+    {
+        const U32 stringIndex = (index * 7 + pWorker->mThreadIndex * 131) % STRINGTABLE_UNITTEST_STRING_COUNT;
+        dSprintf( buffer, sizeof(buffer), (pWorker->mThreadIndex & 1) ? "STRINGTABLETEST_%d_%d" : "StringTableTest_%d_%d", pWorker->mRun, stringIndex );
+        pWorker->mpResults[stringIndex] = StringTable->insert( buffer );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static F64 runStringTableTestWorkers( const U32 run, const U32 threadCount, const U32 insertCount, StringTableEntry* pResults )
+{
+    StringTableTestWorker workers[STRINGTABLE_UNITTEST_MAX_THREADS];
+    Thread* pThreads[STRINGTABLE_UNITTEST_MAX_THREADS];
+
+    PlatformTimer timer;
+    timer.reset();
+
+    for( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+    {
+        workers[threadIndex].mRun = run;
+        workers[threadIndex].mThreadIndex = threadIndex;
+        workers[threadIndex].mInsertCount = insertCount;
+        workers[threadIndex].mpResults = pResults + threadIndex * STRINGTABLE_UNITTEST_STRING_COUNT;
+        pThreads[threadIndex] = new Thread( &stringTableTestWorkerFunction, &workers[threadIndex], true );
+    }
+
+    for( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+    {
+        pThreads[threadIndex]->join();
+        delete pThreads[threadIndex];
+    }
+
+    return (F64)timer.getElapsedMs();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, CaseTest )
+{
+    // Case-insensitive inserts share the first entry added.
+    StringTableEntry first = StringTable->insert( "StringTableCaseTest" );
+    ASSERT_EQ( StringTable->insert( "STRINGTABLECASETEST" ), first );
+    ASSERT_STREQ( first, "StringTableCaseTest" );
+
+    // Case-sensitive inserts get their own entry but don't change the shared one.
+    StringTableEntry upper = StringTable->insert( "STRINGTABLECASETEST", true );
+    ASSERT_NE( upper, first );
+    ASSERT_STREQ( upper, "STRINGTABLECASETEST" );
+    ASSERT_EQ( StringTable->insert( "STRINGTABLECASETEST", true ), upper );
+    ASSERT_EQ( StringTable->insert( "stringtablecasetest" ), first );
+    ASSERT_EQ( StringTable->lookup( "stringtablecasetest", true ), (StringTableEntry)NULL );
+
+    // Length-limited versions.
+    ASSERT_EQ( StringTable->insertn( "StringTableCaseTest_Suffix", 19 ), first );
+    ASSERT_EQ( StringTable->lookupn( "STRINGTABLECASETEST_Suffix", 19, true ), upper );
+    ASSERT_EQ( StringTable->lookupn( "StringTableCaseTes", 18 ), (StringTableEntry)NULL );
+
+    // Hashes ignore case.
+    ASSERT_EQ( _StringTable::hashString( "StringTableCaseTest" ), _StringTable::hashString( "stringTABLEcaseTEST" ) );
+    ASSERT_EQ( _StringTable::hashStringn( "StringTableCaseTest_Suffix", 19 ), _StringTable::hashString( "StringTableCaseTest" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, ConcurrentInsertTest )
+{
+    const U32 threadCount = 8;
+    StringTableEntry* pResults = new StringTableEntry[threadCount * STRINGTABLE_UNITTEST_STRING_COUNT];
+
+    runStringTableTestWorkers( 0, threadCount, STRINGTABLE_UNITTEST_STRING_COUNT, pResults );
+
+    // Every thread must have got the same entry for each string.
+    char buffer[64];
+    for( U32 stringIndex = 0; stringIndex < STRINGTABLE_UNITTEST_STRING_COUNT; ++stringIndex )
+    {
+        dSprintf( buffer, sizeof(buffer), "stringtabletest_0_%d", stringIndex );
+        StringTableEntry entry = StringTable->lookup( buffer );
+        ASSERT_TRUE( entry != NULL );
+
+        for( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+            ASSERT_EQ( pResults[threadIndex * STRINGTABLE_UNITTEST_STRING_COUNT + stringIndex], entry );
+    }
+
+    delete [] pResults;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, InsertBenchmark )
+{
+    StringTableEntry* pResults = new StringTableEntry[STRINGTABLE_UNITTEST_MAX_THREADS * STRINGTABLE_UNITTEST_STRING_COUNT];
+
+    // Record the insert throughput for 1, 2, 4, 8 and 16 threads.
+    for( U32 threadCount = 1, run = 1; threadCount <= STRINGTABLE_UNITTEST_MAX_THREADS; threadCount *= 2, ++run )
+    {
+        const F64 elapsedMs = runStringTableTestWorkers( run, threadCount, STRINGTABLE_UNITTEST_INSERTS_PER_THREAD, pResults );
+        const F64 insertsPerMs = (threadCount * STRINGTABLE_UNITTEST_INSERTS_PER_THREAD) / getMax( elapsedMs, 0.001 );
+
+        RecordProperty( avar( "Threads%dInsertsPerMs", threadCount ), (int)insertsPerMs );
+    }
+
+    delete [] pResults;
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,309 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SIMSET_H_
+#include "sim/simSet.h"
+#endif
+
+#ifndef _PLATFORM_FILEIO_H_
+#include "platform/platformFileIO.h"
+#endif
+
+#ifndef _ZIPSUBSTREAM_H_
+#include "io/zip/zipSubStream.h"
+#endif
+
+#ifndef _PLATFORM_TIMER_H_
+#include "platform/platformTimer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_BINARY_UNITTEST_XML_FILE       "_unitTestTaml_RemoveMe.taml"
+#define TAML_BINARY_UNITTEST_BINARY_FILE    "_unitTestTaml_RemoveMe.baml"
+#define TAML_BINARY_UNITTEST_CHILD_COUNT    2000
+#define TAML_BINARY_UNITTEST_LEGACY_FILE    "_unitTestTamlLegacy_RemoveMe.baml"
+#define TAML_BINARY_UNITTEST_LEGACY_VERSION 2
+#define TAML_BINARY_UNITTEST_BENCHMARKCOUNT 5
+
+//-----------------------------------------------------------------------------
+
+static SimSet* createTamlBinaryTestSet( void )
+{
+    SimSet* pSimSet = new SimSet();
+    pSimSet->registerObject();
+
+    char valueBuffer[32];
+    for( U32 index = 0; index < TAML_BINARY_UNITTEST_CHILD_COUNT; ++index )
+    {
+        SimObject* pChild = new SimObject();
+        pChild->registerObject();
+
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%d", index );
+        pChild->setDataField( StringTable->insert( "Index" ), NULL, valueBuffer );
+        pChild->setDataField( StringTable->insert( "Layer" ), NULL, "Background" );
+        pSimSet->addObject( pChild );
+    }
+
+    return pSimSet;
+}
+
+//-----------------------------------------------------------------------------
+
+static void verifyTamlBinaryTestSet( SimObject* pSimObject )
+{
+    SimSet* pSimSet = dynamic_cast<SimSet*>( pSimObject );
+    ASSERT_TRUE( pSimSet != NULL );
+    ASSERT_EQ( pSimSet->size(), (U32)TAML_BINARY_UNITTEST_CHILD_COUNT );
+
+    SimObject* pLastChild = pSimSet->at( TAML_BINARY_UNITTEST_CHILD_COUNT-1 );
+    ASSERT_EQ( dAtoi( pLastChild->getDataField( StringTable->insert( "Index" ), NULL ) ), TAML_BINARY_UNITTEST_CHILD_COUNT-1 );
+    ASSERT_STREQ( pLastChild->getDataField( StringTable->insert( "Layer" ), NULL ), "Background" );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, ReadWriteTest )
+{
+    SimSet* pSimSet = createTamlBinaryTestSet();
+
+    Taml taml;
+    taml.registerObject();
+
+    // Both compressed and uncompressed blocks must read back.
+    for( U32 pass = 0; pass < 2; ++pass )
+    {
+        taml.setBinaryCompression( pass == 1 );
+        ASSERT_TRUE( taml.write( pSimSet, TAML_BINARY_UNITTEST_BINARY_FILE ) );
+
+        SimObject* pReadObject = taml.read( TAML_BINARY_UNITTEST_BINARY_FILE );
+        verifyTamlBinaryTestSet( pReadObject );
+        pReadObject->deleteObject();
+    }
+
+    // A truncated file must be rejected without crashing.
+    {
+        FileMapping fileMapping;
+        ASSERT_TRUE( fileMapping.open( TAML_BINARY_UNITTEST_BINARY_FILE ) );
+        const U32 truncatedSize = fileMapping.getSize() / 2;
+
+        FileStream stream;
+        ASSERT_TRUE( stream.open( TAML_BINARY_UNITTEST_XML_FILE, FileStream::Write ) );
+        stream.write( truncatedSize, fileMapping.getData() );
+        stream.close();
+        fileMapping.close();
+
+        taml.setFormatMode( Taml::BinaryFormat );
+        taml.setAutoFormat( false );
+        ASSERT_TRUE( taml.read( TAML_BINARY_UNITTEST_XML_FILE ) == NULL );
+        taml.setAutoFormat( true );
+    }
+
+    pSimSet->deleteObjects();
+    pSimSet->deleteObject();
+    taml.unregisterObject();
+
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_XML_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_BINARY_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeLegacyTamlBinaryElement( Stream& stream, const char* pElementName, const U32 attributeCount, const char** pAttributes, const U32 childCount )
+{
+    // Element name, object name, reference Id and reference-to Id.
+    stream.writeString( pElementName );
+    stream.writeString( StringTable->EmptyString );
+    stream.write( (U32)0 );
+    stream.write( (U32)0 );
+
+    // Attribute name/value pairs.
+    stream.write( attributeCount );
+    for( U32 index = 0; index < attributeCount; ++index )
+    {
+        stream.writeString( pAttributes[index*2] );
+        stream.writeLongString( 4096, pAttributes[(index*2)+1] );
+    }
+
+    // Children count, the children themselves follow the element.
+    stream.write( childCount );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeLegacyTamlBinaryTestSet( Stream& stream )
+{
+    writeLegacyTamlBinaryElement( stream, "SimSet", 0, NULL, TAML_BINARY_UNITTEST_CHILD_COUNT );
+
+    char valueBuffer[32];
+    for( U32 index = 0; index < TAML_BINARY_UNITTEST_CHILD_COUNT; ++index )
+    {
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%d", index );
+        const char* pAttributes[4] = { "Index", valueBuffer, "Layer", "Background" };
+        writeLegacyTamlBinaryElement( stream, "SimObject", 2, pAttributes, 0 );
+
+        // No custom elements on the child.
+        stream.write( (U32)0 );
+    }
+
+    // No custom elements on the set.
+    stream.write( (U32)0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, LegacyReadTest )
+{
+    Taml taml;
+    taml.registerObject();
+
+    // Files written before the block format must still read through the stream parser.
+    for( U32 pass = 0; pass < 2; ++pass )
+    {
+        const bool compressed = pass == 1;
+
+        FileStream stream;
+        ASSERT_TRUE( stream.open( TAML_BINARY_UNITTEST_BINARY_FILE, FileStream::Write ) );
+        stream.writeString( StringTable->insert( TAML_SIGNATURE ) );
+        stream.write( (U32)TAML_BINARY_UNITTEST_LEGACY_VERSION );
+        stream.write( compressed );
+
+        if ( compressed )
+        {
+            ZipSubWStream zipStream;
+            zipStream.attachStream( &stream );
+            writeLegacyTamlBinaryTestSet( zipStream );
+            zipStream.detachStream();
+        }
+        else
+        {
+            writeLegacyTamlBinaryTestSet( stream );
+        }
+        stream.close();
+
+        SimObject* pReadObject = taml.read( TAML_BINARY_UNITTEST_BINARY_FILE );
+        verifyTamlBinaryTestSet( pReadObject );
+
+        // The legacy and current formats must produce the same objects.
+        taml.setBinaryCompression( compressed );
+        taml.setFormatMode( Taml::BinaryFormat );
+        taml.setAutoFormat( false );
+        ASSERT_TRUE( taml.write( pReadObject, TAML_BINARY_UNITTEST_XML_FILE ) );
+        SimObject* pCurrentObject = taml.read( TAML_BINARY_UNITTEST_XML_FILE );
+        taml.setAutoFormat( true );
+        verifyTamlBinaryTestSet( pCurrentObject );
+
+        SimSet* pLegacySet = static_cast<SimSet*>( pReadObject );
+        SimSet* pCurrentSet = static_cast<SimSet*>( pCurrentObject );
+        for( U32 index = 0; index < TAML_BINARY_UNITTEST_CHILD_COUNT; ++index )
+        {
+            ASSERT_STREQ( pLegacySet->at(index)->getDataField( StringTable->insert( "Index" ), NULL ), pCurrentSet->at(index)->getDataField( StringTable->insert( "Index" ), NULL ) );
+            ASSERT_STREQ( pLegacySet->at(index)->getDataField( StringTable->insert( "Layer" ), NULL ), pCurrentSet->at(index)->getDataField( StringTable->insert( "Layer" ), NULL ) );
+        }
+
+        pLegacySet->deleteObjects();
+        pLegacySet->deleteObject();
+        pCurrentSet->deleteObjects();
+        pCurrentSet->deleteObject();
+    }
+
+    taml.unregisterObject();
+
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_XML_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_BINARY_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, ReadBenchmark )
+{
+    Taml taml;
+    taml.registerObject();
+
+    // Write the same level as XML, the current binary format and the legacy binary format.
+    SimSet* pSimSet = createTamlBinaryTestSet();
+    ASSERT_TRUE( taml.write( pSimSet, TAML_BINARY_UNITTEST_XML_FILE ) );
+    ASSERT_TRUE( taml.write( pSimSet, TAML_BINARY_UNITTEST_BINARY_FILE ) );
+    pSimSet->deleteObjects();
+    pSimSet->deleteObject();
+
+    {
+        FileStream stream;
+        ASSERT_TRUE( stream.open( TAML_BINARY_UNITTEST_LEGACY_FILE, FileStream::Write ) );
+        stream.writeString( StringTable->insert( TAML_SIGNATURE ) );
+        stream.write( (U32)TAML_BINARY_UNITTEST_LEGACY_VERSION );
+        stream.write( taml.getBinaryCompression() );
+        if ( taml.getBinaryCompression() )
+        {
+            ZipSubWStream zipStream;
+            zipStream.attachStream( &stream );
+            writeLegacyTamlBinaryTestSet( zipStream );
+            zipStream.detachStream();
+        }
+        else
+        {
+            writeLegacyTamlBinaryTestSet( stream );
+        }
+        stream.close();
+    }
+
+    // Record the time to read each file.
+    const char* pFiles[3] = { TAML_BINARY_UNITTEST_XML_FILE, TAML_BINARY_UNITTEST_LEGACY_FILE, TAML_BINARY_UNITTEST_BINARY_FILE };
+    const char* pProperties[3] = { "XmlReadUs", "BinaryV2ReadUs", "BinaryV3ReadUs" };
+    PlatformTimer timer;
+    for( U32 fileIndex = 0; fileIndex < 3; ++fileIndex )
+    {
+        F64 elapsedMs = 0.0;
+        for( U32 iteration = 0; iteration < TAML_BINARY_UNITTEST_BENCHMARKCOUNT; ++iteration )
+        {
+            timer.reset();
+            SimObject* pReadObject = taml.read( pFiles[fileIndex] );
+            elapsedMs += timer.getElapsedMs();
+
+            verifyTamlBinaryTestSet( pReadObject );
+            SimSet* pReadSet = static_cast<SimSet*>( pReadObject );
+            pReadSet->deleteObjects();
+            pReadSet->deleteObject();
+        }
+
+        RecordProperty( pProperties[fileIndex], (int)(elapsedMs * 1000.0 / TAML_BINARY_UNITTEST_BENCHMARKCOUNT) );
+    }
+
+    taml.unregisterObject();
+
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_XML_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_BINARY_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( TAML_BINARY_UNITTEST_LEGACY_FILE ) );
+}
+
+#endif // TORQUE_SHIPPING